@@ -24,6 +24,7 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/buffer-builder.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -56,6 +57,7 @@ Status AdaptiveIntBuilderBase::Resize(int64_t capacity) {
   capacity = std::max(capacity, kMinBuilderCapacity);
 
   int64_t nbytes = capacity * int_size_;
+  ScopedMemoryTag tag(internal::BuilderMemoryTag());
   if (capacity_ == 0) {
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &data_));
   } else {
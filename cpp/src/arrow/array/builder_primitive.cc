@@ -27,6 +27,7 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/buffer-builder.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -59,6 +60,7 @@ Status PrimitiveBuilder<T>::Resize(int64_t capacity) {
   capacity = std::max(capacity, kMinBuilderCapacity);
 
   int64_t nbytes = TypeTraits<T>::bytes_required(capacity);
+  ScopedMemoryTag tag(internal::BuilderMemoryTag());
   if (capacity_ == 0) {
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &data_));
   } else {
@@ -160,6 +162,7 @@ Status BooleanBuilder::Resize(int64_t capacity) {
   capacity = std::max(capacity, kMinBuilderCapacity);
 
   const int64_t new_bitmap_size = BitUtil::BytesForBits(capacity);
+  ScopedMemoryTag tag(internal::BuilderMemoryTag());
   if (capacity_ == 0) {
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, new_bitmap_size, &data_));
     raw_data_ = reinterpret_cast<uint8_t*>(data_->mutable_data());
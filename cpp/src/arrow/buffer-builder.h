@@ -26,6 +26,7 @@
 #include <string>
 
 #include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/macros.h"
@@ -33,6 +34,16 @@
 
 namespace arrow {
 
+namespace internal {
+
+/// \brief The tag attributing the allocations of builders in TaggingMemoryPool
+inline const MemoryTag& BuilderMemoryTag() {
+  static const MemoryTag tag("builder");
+  return tag;
+}
+
+}  // namespace internal
+
 // ----------------------------------------------------------------------
 // Buffer builder classes
 
@@ -58,6 +69,7 @@ class ARROW_EXPORT BufferBuilder {
     }
     int64_t old_capacity = capacity_;
 
+    ScopedMemoryTag tag(internal::BuilderMemoryTag());
     if (buffer_ == NULLPTR) {
       ARROW_RETURN_NOT_OK(AllocateResizableBuffer(pool_, new_capacity, &buffer_));
     } else {
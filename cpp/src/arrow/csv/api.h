@@ -20,5 +20,6 @@
 
 #include "arrow/csv/options.h"
 #include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
 
 #endif  // ARROW_CSV_API_H
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <numeric>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -253,5 +254,21 @@ TEST_P(BaseChunkerTest, EscapingNewline) {
   }
 }
 
+TEST_P(BaseChunkerTest, LongFields) {
+  // Special characters at all positions relative to the 64-byte windows
+  // of the lexer
+  std::vector<std::string> lines;
+  std::vector<uint32_t> lengths;
+  for (int length = 0; length < 150; length += 7) {
+    const std::string prefix(length, 'x');
+    const std::string newline = options_.newlines_in_values ? "\n" : "";
+    lines.push_back(prefix + ",\"" + prefix + newline + ",\"\"" + prefix + "\"\n");
+    lengths.push_back(static_cast<uint32_t>(lines.back().size()));
+  }
+  auto csv = MakeCSVData(lines);
+  Chunker chunker(options_);
+  AssertChunking(chunker, csv, lengths);
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 
+#include "arrow/csv/lexing-internal.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 
@@ -48,10 +49,9 @@ const char* FindNewlineReverse(const char* data, uint32_t size) {
 
 Chunker::Chunker(ParseOptions options) : options_(options) {}
 
-// NOTE: cvsmonkey (https://github.com/dw/csvmonkey) has optimization ideas
-
 template <bool quoting, bool escaping>
-inline const char* Chunker::ReadLine(const char* data, const char* data_end) {
+inline const char* Chunker::ReadLine(SpecialCharScanner* scanner, const char* data,
+                                     const char* data_end) {
   DCHECK_EQ(quoting, options_.quoting);
   DCHECK_EQ(escaping, options_.escaping);
 
@@ -70,6 +70,7 @@ FieldStart:
 
 InField:
   // Inside a non-quoted part of a field
+  data = scanner->NextUnquoted(data);
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -97,6 +98,7 @@ InField:
 
 InQuotedField:
   // Inside a quoted part of a field
+  data = scanner->NextQuoted(data);
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -138,9 +140,10 @@ Status Chunker::ProcessSpecialized(const char* start, uint32_t size, uint32_t* o
 
   const char* data = start;
   const char* data_end = start + size;
+  SpecialCharScanner scanner(options_, data_end);
 
   while (data < data_end) {
-    const char* line_end = ReadLine<quoting, escaping>(data, data_end);
+    const char* line_end = ReadLine<quoting, escaping>(&scanner, data, data_end);
     if (line_end == nullptr) {
       // Cannot read any further
       break;
@@ -28,6 +28,8 @@
 namespace arrow {
 namespace csv {
 
+class SpecialCharScanner;
+
 /// \class Chunker
 /// \brief A reusable block-based chunker for CSV data
 ///
@@ -58,7 +60,8 @@ class ARROW_EXPORT Chunker {
   // Detect a single line from the data pointer.  Return the line end,
   // or nullptr if the remaining line is truncated.
   template <bool quoting, bool escaping>
-  inline const char* ReadLine(const char* data, const char* data_end);
+  inline const char* ReadLine(SpecialCharScanner* scanner, const char* data,
+                              const char* data_end);
 
   ParseOptions options_;
 };
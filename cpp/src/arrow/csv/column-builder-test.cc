@@ -21,6 +21,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
 #include "arrow/csv/column-builder.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/test-common.h"
@@ -247,6 +248,21 @@ TEST(InferringColumnBuilder, MultipleChunkTimestamp) {
   AssertChunkedEqual(*expected, *actual);
 }
 
+TEST(InferringColumnBuilder, MultipleChunkTimestampFraction) {
+  auto tg = TaskGroup::MakeSerial();
+  std::shared_ptr<ColumnBuilder> builder;
+  ASSERT_OK(ColumnBuilder::Make(0, ConvertOptions::Defaults(), tg, &builder));
+
+  // Fractions of second make the column nanosecond-based
+  std::shared_ptr<ChunkedArray> actual;
+  AssertBuilding(builder, {{"1970-01-01"}, {"2018-11-13 17:11:10.5"}}, &actual);
+
+  std::shared_ptr<ChunkedArray> expected;
+  ChunkedArrayFromVector<TimestampType>(timestamp(TimeUnit::NANO), {{true}, {true}},
+                                        {{0}, {1542129070500000000LL}}, &expected);
+  AssertChunkedEqual(*expected, *actual);
+}
+
 TEST(InferringColumnBuilder, SingleChunkString) {
   auto tg = TaskGroup::MakeSerial();
   std::shared_ptr<ColumnBuilder> builder;
@@ -316,6 +332,101 @@ TEST(InferringColumnBuilder, MultipleChunkBinary) {
   AssertChunkedEqual(*expected, *actual);
 }
 
+static ConvertOptions DictEncodeOptions(int32_t max_cardinality = 50) {
+  auto options = ConvertOptions::Defaults();
+  options.auto_dict_encode = true;
+  options.auto_dict_max_cardinality = max_cardinality;
+  return options;
+}
+
+static std::shared_ptr<Array> MakeDictArray(const std::shared_ptr<Array>& dict,
+                                            const std::string& indices) {
+  return std::make_shared<DictionaryArray>(dictionary(int8(), dict),
+                                           ArrayFromJSON(int8(), indices));
+}
+
+TEST(InferringColumnBuilder, SingleChunkStringDict) {
+  auto tg = TaskGroup::MakeSerial();
+  std::shared_ptr<ColumnBuilder> builder;
+  ASSERT_OK(ColumnBuilder::Make(0, DictEncodeOptions(), tg, &builder));
+
+  std::shared_ptr<ChunkedArray> actual;
+  AssertBuilding(builder, {{"", "foo", "baré", "foo"}}, &actual);
+
+  auto dict = ArrayFromJSON(utf8(), R"(["", "foo", "baré"])");
+  ChunkedArray expected({MakeDictArray(dict, "[0, 1, 2, 1]")});
+  AssertChunkedEqual(expected, *actual);
+}
+
+TEST(InferringColumnBuilder, MultipleChunkStringDict) {
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])");
+  ChunkedArray expected({MakeDictArray(dict, "[0, 1]"), MakeDictArray(dict, "[1]"),
+                         MakeDictArray(dict, "[2, 0]")});
+
+  for (auto tg : {TaskGroup::MakeSerial(), TaskGroup::MakeThreaded(GetCpuThreadPool())}) {
+    std::shared_ptr<ColumnBuilder> builder;
+    ASSERT_OK(ColumnBuilder::Make(0, DictEncodeOptions(), tg, &builder));
+
+    // Chunks have different dictionaries, which get unified
+    std::shared_ptr<ChunkedArray> actual;
+    AssertBuilding(builder, {{"foo", "bar"}, {"bar"}, {"baz", "foo"}}, &actual);
+    AssertChunkedEqual(expected, *actual);
+  }
+}
+
+TEST(InferringColumnBuilder, MultipleChunkBinaryDict) {
+  auto tg = TaskGroup::MakeSerial();
+  std::shared_ptr<ColumnBuilder> builder;
+  ASSERT_OK(ColumnBuilder::Make(0, DictEncodeOptions(), tg, &builder));
+
+  std::shared_ptr<ChunkedArray> actual;
+  AssertBuilding(builder, {{"foo", "bar"}, {"bar\xff", "foo"}}, &actual);
+
+  std::shared_ptr<Array> dict;
+  ArrayFromVector<BinaryType, std::string>({"foo", "bar", "bar\xff"}, &dict);
+  ChunkedArray expected({MakeDictArray(dict, "[0, 1]"), MakeDictArray(dict, "[2, 0]")});
+  AssertChunkedEqual(expected, *actual);
+}
+
+TEST(InferringColumnBuilder, DictCardinalityFallback) {
+  auto tg = TaskGroup::MakeSerial();
+  std::shared_ptr<ColumnBuilder> builder;
+  std::shared_ptr<ChunkedArray> actual;
+  std::shared_ptr<ChunkedArray> expected;
+
+  // The second chunk has too many distinct values
+  ASSERT_OK(ColumnBuilder::Make(0, DictEncodeOptions(2), tg, &builder));
+  AssertBuilding(builder, {{"a", "b", "a"}, {"a", "b", "c"}}, &actual);
+
+  ChunkedArrayFromVector<StringType, std::string>({{"a", "b", "a"}, {"a", "b", "c"}},
+                                                  &expected);
+  AssertChunkedEqual(*expected, *actual);
+
+  // Same with binary data
+  tg = TaskGroup::MakeSerial();
+  ASSERT_OK(ColumnBuilder::Make(0, DictEncodeOptions(2), tg, &builder));
+  AssertBuilding(builder, {{"a", "b\xff", "a"}, {"a", "b", "c"}}, &actual);
+
+  ChunkedArrayFromVector<BinaryType, std::string>(
+      {{"a", "b\xff", "a"}, {"a", "b", "c"}}, &expected);
+  AssertChunkedEqual(*expected, *actual);
+}
+
+TEST(InferringColumnBuilder, DictCumulativeCardinalityFallback) {
+  std::shared_ptr<ChunkedArray> expected;
+  ChunkedArrayFromVector<StringType, std::string>({{"a", "b"}, {"c", "a"}, {"d", "b"}},
+                                                  &expected);
+
+  for (auto tg : {TaskGroup::MakeSerial(), TaskGroup::MakeThreaded(GetCpuThreadPool())}) {
+    // Each chunk has few enough distinct values, but not the whole column
+    std::shared_ptr<ColumnBuilder> builder;
+    ASSERT_OK(ColumnBuilder::Make(0, DictEncodeOptions(3), tg, &builder));
+    std::shared_ptr<ChunkedArray> actual;
+    AssertBuilding(builder, {{"a", "b"}, {"c", "a"}, {"d", "b"}}, &actual);
+    AssertChunkedEqual(*expected, *actual);
+  }
+}
+
 TEST(InferringColumnBuilder, MultipleChunkIntegerParallel) {
   auto tg = TaskGroup::MakeThreaded(GetCpuThreadPool());
   std::shared_ptr<ColumnBuilder> builder;
@@ -32,6 +32,8 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/task-group.h"
 
@@ -40,6 +42,7 @@ namespace csv {
 
 class BlockParser;
 
+using internal::checked_cast;
 using internal::TaskGroup;
 
 void ColumnBuilder::SetTaskGroup(const std::shared_ptr<internal::TaskGroup>& task_group) {
@@ -153,8 +156,11 @@ class InferringColumnBuilder : public ColumnBuilder {
   Status Finish(std::shared_ptr<ChunkedArray>* out) override;
 
  protected:
-  Status LoosenType();
+  Status LoosenType(const Status& conversion_error);
   Status UpdateType();
+  Status MakeDictConverter();
+  Status UpdateDictCardinality(const Array& chunk);
+  Status UnifyChunkDictionaries(std::shared_ptr<DataType>* out_type);
   Status TryConvertChunk(size_t chunk_index);
   // This must be called unlocked!
   void ScheduleConvertChunk(size_t chunk_index);
@@ -167,12 +173,26 @@ class InferringColumnBuilder : public ColumnBuilder {
   std::shared_ptr<Converter> converter_;
 
   // Current inference status
-  enum class InferKind { Null, Integer, Real, Timestamp, Text, Binary };
-
+  enum class InferKind {
+    Null,
+    Integer,
+    Real,
+    Timestamp,
+    TimestampNano,
+    TextDict,
+    BinaryDict,
+    Text,
+    Binary
+  };
+
+  // For dictionary-encoded kinds, this is the dictionary value type
   std::shared_ptr<DataType> infer_type_;
   InferKind infer_kind_;
   bool can_loosen_type_;
 
+  // For dictionary-encoded kinds, the distinct values of all converted chunks
+  std::unique_ptr<internal::BinaryMemoTable> dict_memo_table_;
+
   // The parsers corresponding to each chunk (for reconverting)
   std::vector<std::shared_ptr<BlockParser>> parsers_;
 };
@@ -182,7 +202,7 @@ Status InferringColumnBuilder::Init() {
   return UpdateType();
 }
 
-Status InferringColumnBuilder::LoosenType() {
+Status InferringColumnBuilder::LoosenType(const Status& conversion_error) {
   // We are locked
 
   DCHECK(can_loosen_type_);
@@ -194,10 +214,21 @@ Status InferringColumnBuilder::LoosenType() {
       infer_kind_ = InferKind::Timestamp;
       break;
     case InferKind::Timestamp:
+      infer_kind_ = InferKind::TimestampNano;
+      break;
+    case InferKind::TimestampNano:
       infer_kind_ = InferKind::Real;
       break;
     case InferKind::Real:
-      infer_kind_ = InferKind::Text;
+      infer_kind_ = options_.auto_dict_encode ? InferKind::TextDict : InferKind::Text;
+      break;
+    case InferKind::TextDict:
+      // Too many distinct values: switch to dense encoding
+      infer_kind_ = conversion_error.IsCapacityError() ? InferKind::Text
+                                                       : InferKind::BinaryDict;
+      break;
+    case InferKind::BinaryDict:
+      infer_kind_ = InferKind::Binary;
       break;
     case InferKind::Text:
       infer_kind_ = InferKind::Binary;
@@ -221,14 +252,26 @@ Status InferringColumnBuilder::UpdateType() {
       can_loosen_type_ = true;
       break;
     case InferKind::Timestamp:
-      // We don't support parsing second fractions for now
       infer_type_ = timestamp(TimeUnit::SECOND);
       can_loosen_type_ = true;
       break;
+    case InferKind::TimestampNano:
+      // Only if there are fractions of second
+      infer_type_ = timestamp(TimeUnit::NANO);
+      can_loosen_type_ = true;
+      break;
     case InferKind::Real:
       infer_type_ = float64();
       can_loosen_type_ = true;
       break;
+    case InferKind::TextDict:
+      infer_type_ = utf8();
+      can_loosen_type_ = true;
+      return MakeDictConverter();
+    case InferKind::BinaryDict:
+      infer_type_ = binary();
+      can_loosen_type_ = true;
+      return MakeDictConverter();
     case InferKind::Text:
       infer_type_ = utf8();
       can_loosen_type_ = true;
@@ -241,6 +284,55 @@ Status InferringColumnBuilder::UpdateType() {
   return Converter::Make(infer_type_, options_, pool_, &converter_);
 }
 
+Status InferringColumnBuilder::MakeDictConverter() {
+  // We are locked
+
+  std::shared_ptr<DictionaryConverter> dict_converter;
+  RETURN_NOT_OK(DictionaryConverter::Make(infer_type_, options_, pool_, &dict_converter));
+  dict_converter->SetMaxCardinality(options_.auto_dict_max_cardinality);
+  converter_ = dict_converter;
+  dict_memo_table_.reset(new internal::BinaryMemoTable());
+  return Status::OK();
+}
+
+Status InferringColumnBuilder::UpdateDictCardinality(const Array& chunk) {
+  // We are locked
+
+  // The converter only bounds the distinct values of each chunk, so bound
+  // those of the whole column here
+  const auto& dict_type = checked_cast<const DictionaryType&>(*chunk.type());
+  const auto& dict = checked_cast<const BinaryArray&>(*dict_type.dictionary());
+  for (int64_t i = 0; i < dict.length(); ++i) {
+    dict_memo_table_->GetOrInsert(dict.GetView(i));
+  }
+  if (dict_memo_table_->size() > options_.auto_dict_max_cardinality) {
+    return Status::CapacityError("CSV conversion to dictionary of ",
+                                 infer_type_->ToString(), ": more than ",
+                                 options_.auto_dict_max_cardinality,
+                                 " distinct values in column");
+  }
+  return Status::OK();
+}
+
+Status InferringColumnBuilder::UnifyChunkDictionaries(
+    std::shared_ptr<DataType>* out_type) {
+  // We are locked
+
+  // The dictionary is part of the type, so all chunks must be transposed
+  // to a common dictionary.  This also narrows the index type if possible.
+  std::vector<const DataType*> types;
+  for (const auto& chunk : chunks_) {
+    types.push_back(chunk->type().get());
+  }
+  std::vector<std::vector<int32_t>> transpose_maps;
+  RETURN_NOT_OK(DictionaryType::Unify(pool_, types, out_type, &transpose_maps));
+  for (size_t i = 0; i < chunks_.size(); ++i) {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*chunks_[i]);
+    RETURN_NOT_OK(dict_array.Transpose(pool_, *out_type, transpose_maps[i], &chunks_[i]));
+  }
+  return Status::OK();
+}
+
 void InferringColumnBuilder::ScheduleConvertChunk(size_t chunk_index) {
   // We're careful that all values in the closure outlive the Append() call
   task_group_->Append([=]() { return TryConvertChunk(chunk_index); });
@@ -266,6 +358,10 @@ Status InferringColumnBuilder::TryConvertChunk(size_t chunk_index) {
     return Status::OK();
   }
 
+  if (st.ok() && (kind == InferKind::TextDict || kind == InferKind::BinaryDict)) {
+    st = UpdateDictCardinality(*res);
+  }
+
   if (st.ok()) {
     // Conversion succeeded
     chunks_[chunk_index] = std::move(res);
@@ -276,7 +372,7 @@ Status InferringColumnBuilder::TryConvertChunk(size_t chunk_index) {
     return Status::OK();
   } else if (can_loosen_type_) {
     // Conversion failed, try another type
-    RETURN_NOT_OK(LoosenType());
+    RETURN_NOT_OK(LoosenType(st));
 
     // Reconvert past finished chunks
     // (unfinished chunks will notice by themselves if they need reconverting)
@@ -329,16 +425,22 @@ Status InferringColumnBuilder::Finish(std::shared_ptr<ChunkedArray>* out) {
   // Unnecessary iff all tasks have finished
   std::lock_guard<std::mutex> lock(mutex_);
 
+  const bool dict_encoded =
+      infer_kind_ == InferKind::TextDict || infer_kind_ == InferKind::BinaryDict;
   for (const auto& chunk : chunks_) {
     if (chunk == nullptr) {
       return Status::Invalid("A chunk failed converting for an unknown reason");
     }
     // XXX Perhaps we must instead do a last equalization pass
     // in this serial step
-    DCHECK_EQ(chunk->type()->id(), infer_type_->id())
+    DCHECK_EQ(chunk->type()->id(), dict_encoded ? Type::DICTIONARY : infer_type_->id())
         << "Inference didn't equalize types!";
   }
-  *out = std::make_shared<ChunkedArray>(chunks_, infer_type_);
+  std::shared_ptr<DataType> type = infer_type_;
+  if (dict_encoded && !chunks_.empty()) {
+    RETURN_NOT_OK(UnifyChunkDictionaries(&type));
+  }
+  *out = std::make_shared<ChunkedArray>(chunks_, type);
   chunks_.clear();
   parsers_.clear();
 
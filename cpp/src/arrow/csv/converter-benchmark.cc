@@ -42,6 +42,20 @@ static std::shared_ptr<BlockParser> BuildInt64Data(int32_t num_rows) {
   return result;
 }
 
+// Large integers without nulls
+static std::shared_ptr<BlockParser> BuildLargeInt64Data(int32_t num_rows) {
+  const std::vector<std::string> base_rows = {"1542129070\n", "-317005557\n",
+                                              "98765432101234\n", "12345678\n"};
+  std::vector<std::string> rows;
+  for (int32_t i = 0; i < num_rows; ++i) {
+    rows.push_back(base_rows[i % base_rows.size()]);
+  }
+
+  std::shared_ptr<BlockParser> result;
+  MakeCSVParser(rows, &result);
+  return result;
+}
+
 static std::shared_ptr<BlockParser> BuildFloatData(int32_t num_rows) {
   const std::vector<std::string> base_rows = {"0\n", "123.456\n", "-3170.55766\n", "\n",
                                               "N/A\n"};
@@ -55,6 +69,20 @@ static std::shared_ptr<BlockParser> BuildFloatData(int32_t num_rows) {
   return result;
 }
 
+static std::shared_ptr<BlockParser> BuildTimestampData(int32_t num_rows) {
+  const std::vector<std::string> base_rows = {
+      "1970-01-01 00:00:00\n", "2018-11-13 17:11:10\n", "2016-02-29 11:22:33Z\n",
+      "2000-01-01T23:59:59\n", "\n", "1999-12-31\n"};
+  std::vector<std::string> rows;
+  for (int32_t i = 0; i < num_rows; ++i) {
+    rows.push_back(base_rows[i % base_rows.size()]);
+  }
+
+  std::shared_ptr<BlockParser> result;
+  MakeCSVParser(rows, &result);
+  return result;
+}
+
 static void BenchmarkConversion(benchmark::State& state,  // NOLINT non-const reference
                                 BlockParser& parser,
                                 const std::shared_ptr<DataType>& type,
@@ -82,6 +110,15 @@ static void BM_Int64Conversion(benchmark::State& state) {  // NOLINT non-const r
   BenchmarkConversion(state, *parser, int64(), options);
 }
 
+static void BM_LargeInt64Conversion(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 10000;
+  auto parser = BuildLargeInt64Data(num_rows);
+  auto options = ConvertOptions::Defaults();
+
+  BenchmarkConversion(state, *parser, int64(), options);
+}
+
 static void BM_FloatConversion(benchmark::State& state) {  // NOLINT non-const reference
   const int32_t num_rows = 10000;
   auto parser = BuildFloatData(num_rows);
@@ -90,8 +127,19 @@ static void BM_FloatConversion(benchmark::State& state) {  // NOLINT non-const r
   BenchmarkConversion(state, *parser, float64(), options);
 }
 
+static void BM_TimestampConversion(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 10000;
+  auto parser = BuildTimestampData(num_rows);
+  auto options = ConvertOptions::Defaults();
+
+  BenchmarkConversion(state, *parser, timestamp(TimeUnit::NANO), options);
+}
+
 BENCHMARK(BM_Int64Conversion)->Repetitions(3);
+BENCHMARK(BM_LargeInt64Conversion)->Repetitions(3);
 BENCHMARK(BM_FloatConversion)->Repetitions(3);
+BENCHMARK(BM_TimestampConversion)->Repetitions(3);
 
 }  // namespace csv
 }  // namespace arrow
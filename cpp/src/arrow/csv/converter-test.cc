@@ -27,6 +27,7 @@
 #include "arrow/csv/converter.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/test-common.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/test-util.h"
 #include "arrow/type.h"
@@ -200,6 +201,34 @@ TEST(IntegerConversion, CustomNulls) {
                                      options);
 }
 
+TEST(IntegerConversion, NumericNulls) {
+  // Null spellings that are also valid values
+  auto options = ConvertOptions::Defaults();
+  options.null_values = {"0", "-1"};
+
+  AssertConversion<Int32Type, int32_t>(int32(), {"0,1\n", "-1,\"0\"\n", "12345678,-10\n"},
+                                       {{0, 0, 12345678}, {1, 0, -10}},
+                                       {{false, false, true}, {true, true, true}},
+                                       options);
+}
+
+TEST(IntegerConversion, NullBitmap) {
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<Converter> converter;
+  std::shared_ptr<Array> array;
+  ASSERT_OK(Converter::Make(int64(), ConvertOptions::Defaults(), &converter));
+  MakeCSVParser({"1,\n", "2,3\n"}, &parser);
+
+  // No null bitmap is allocated if there are no nulls
+  ASSERT_OK(converter->Convert(*parser, 0, &array));
+  ASSERT_EQ(array->null_count(), 0);
+  ASSERT_EQ(array->data()->buffers[0], nullptr);
+
+  ASSERT_OK(converter->Convert(*parser, 1, &array));
+  ASSERT_EQ(array->null_count(), 1);
+  ASSERT_NE(array->data()->buffers[0], nullptr);
+}
+
 TEST(IntegerConversion, Whitespace) {
   AssertConversion<Int32Type, int32_t>(int32(), {" 12,34 \n", " 56 ,78\n"},
                                        {{12, 56}, {34, 78}});
@@ -229,6 +258,15 @@ TEST(FloatingPointConversion, CustomNulls) {
                                      {{true, false}, {false, true}}, options);
 }
 
+TEST(FloatingPointConversion, NumericNulls) {
+  auto options = ConvertOptions::Defaults();
+  options.null_values = {"0.0", "-1e10"};
+
+  AssertConversion<DoubleType, double>(float64(), {"1.5,0.0\n", "-1e10,0\n"},
+                                       {{1.5, 0.}, {0., 0.}},
+                                       {{true, false}, {false, true}}, options);
+}
+
 TEST(FloatingPointConversion, Whitespace) {
   AssertConversion<DoubleType, double>(float64(), {" 12,34.5\n", " 0 ,-1e100 \n"},
                                        {{12., 0.}, {34.5, -1e100}});
@@ -278,6 +316,12 @@ TEST(TimestampConversion, Nulls) {
                                            {{true}, {false}, {false}});
 }
 
+TEST(TimestampConversion, Errors) {
+  auto type = timestamp(TimeUnit::SECOND);
+  AssertConversionError(type, {"1970-01-01,1970-02-30,1970-01-01 00:00:00,19700101\n"},
+                        {1, 3});
+}
+
 TEST(TimestampConversion, CustomNulls) {
   auto options = ConvertOptions::Defaults();
   options.null_values = {"xxx", "zzz"};
@@ -288,6 +332,57 @@ TEST(TimestampConversion, CustomNulls) {
                                            {{true}, {false}, {false}}, options);
 }
 
+void AssertDictConversion(const std::shared_ptr<DataType>& value_type,
+                          const std::vector<std::string>& csv_string,
+                          const std::shared_ptr<Array>& expected_dict,
+                          const std::string& expected_indices,
+                          ConvertOptions options = ConvertOptions::Defaults()) {
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<DictionaryConverter> converter;
+  std::shared_ptr<Array> array;
+
+  ASSERT_OK(DictionaryConverter::Make(value_type, options, default_memory_pool(),
+                                      &converter));
+  MakeCSVParser(csv_string, &parser);
+  ASSERT_OK(converter->Convert(*parser, 0, &array));
+  DictionaryArray expected(dictionary(int32(), expected_dict),
+                           ArrayFromJSON(int32(), expected_indices));
+  AssertArraysEqual(expected, *array);
+}
+
+TEST(DictionaryConversion, Basics) {
+  AssertDictConversion(utf8(), {"ab,x\n", "cdé,y\n", "ab,z\n", ",x\n"},
+                       ArrayFromJSON(utf8(), R"(["ab", "cdé", ""])"), "[0, 1, 0, 2]");
+
+  std::shared_ptr<Array> dict;
+  ArrayFromVector<BinaryType, std::string>({"\xffgh", "ab"}, &dict);
+  AssertDictConversion(binary(), {"\xffgh,x\n", "ab,y\n", "\xffgh,z\n"}, dict,
+                       "[0, 1, 0]");
+}
+
+TEST(DictionaryConversion, Errors) {
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<DictionaryConverter> converter;
+  std::shared_ptr<Array> array;
+
+  // Invalid UTF8
+  ASSERT_OK(DictionaryConverter::Make(utf8(), ConvertOptions::Defaults(),
+                                      default_memory_pool(), &converter));
+  MakeCSVParser({"ab\n", "\xff\n"}, &parser);
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 0, &array));
+
+  // Too many distinct values
+  converter->SetMaxCardinality(2);
+  MakeCSVParser({"ab\n", "cd\n", "ab\n"}, &parser);
+  ASSERT_OK(converter->Convert(*parser, 0, &array));
+  MakeCSVParser({"ab\n", "cd\n", "ef\n"}, &parser);
+  ASSERT_RAISES(CapacityError, converter->Convert(*parser, 0, &array));
+
+  ASSERT_RAISES(NotImplemented,
+                DictionaryConverter::Make(int64(), ConvertOptions::Defaults(),
+                                          default_memory_pool(), &converter));
+}
+
 TEST(DecimalConversion, NotImplemented) {
   std::shared_ptr<Converter> converter;
   ASSERT_RAISES(NotImplemented,
@@ -18,17 +18,24 @@
 #include "arrow/csv/converter.h"
 
 #include <cstring>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/buffer-builder.h"
+#include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/csv/parser.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/parsing.h"  // IWYU pragma: keep
 #include "arrow/util/trie.h"
 #include "arrow/util/utf8.h"
@@ -151,6 +158,67 @@ class VarSizeBinaryConverter : public ConcreteConverter {
   }
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Concrete Converter for dictionary-encoded var-sized binary strings
+
+template <typename T, bool CheckUTF8>
+class VarSizeBinaryDictConverter : public DictionaryConverter {
+ public:
+  VarSizeBinaryDictConverter(const std::shared_ptr<DataType>& value_type,
+                             const ConvertOptions& options, MemoryPool* pool)
+      : DictionaryConverter(value_type, options, pool),
+        max_cardinality_(std::numeric_limits<int32_t>::max()) {}
+
+  void SetMaxCardinality(int32_t max_length) override { max_cardinality_ = max_length; }
+
+  Status Convert(const BlockParser& parser, int32_t col_index,
+                 std::shared_ptr<Array>* out) override {
+    internal::BinaryMemoTable memo_table;
+    TypedBufferBuilder<int32_t> indices_builder(pool_);
+
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      bool inserted = false;
+      const int32_t index = memo_table.GetOrInsert(
+          data, static_cast<int32_t>(size), [](int32_t) {},
+          [&](int32_t) { inserted = true; });
+      // Only values not seen before need checking
+      if (ARROW_PREDICT_FALSE(inserted)) {
+        if (CheckUTF8 && ARROW_PREDICT_FALSE(!util::ValidateUTF8(data, size))) {
+          return Status::Invalid("CSV conversion error to ", type_->ToString(),
+                                 ": invalid UTF8 data");
+        }
+        if (ARROW_PREDICT_FALSE(memo_table.size() > max_cardinality_)) {
+          return Status::CapacityError("CSV conversion to dictionary of ",
+                                       type_->ToString(), ": more than ",
+                                       max_cardinality_, " distinct values");
+        }
+      }
+      indices_builder.UnsafeAppend(index);
+      return Status::OK();
+    };
+    RETURN_NOT_OK(indices_builder.Resize(parser.num_rows()));
+    RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+
+    std::shared_ptr<Buffer> indices_buffer;
+    RETURN_NOT_OK(indices_builder.Finish(&indices_buffer));
+    std::shared_ptr<ArrayData> dict_data;
+    RETURN_NOT_OK(internal::DictionaryTraits<T>::GetDictionaryArrayData(
+        pool_, type_, memo_table, 0 /* start_offset */, &dict_data));
+    auto indices = std::make_shared<Int32Array>(parser.num_rows(), indices_buffer);
+    *out = std::make_shared<DictionaryArray>(dictionary(int32(), MakeArray(dict_data)),
+                                             indices);
+    return Status::OK();
+  }
+
+ protected:
+  Status Initialize() override {
+    util::InitializeUTF8();
+    return Status::OK();
+  }
+
+  int32_t max_cardinality_;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Concrete Converter for fixed-sized binary strings
 
@@ -184,10 +252,9 @@ Status FixedSizeBinaryConverter::Convert(const BlockParser& parser, int32_t col_
 }
 
 /////////////////////////////////////////////////////////////////////////
-// Concrete Converter for numbers
+// Concrete Converter for booleans
 
-template <typename T>
-class NumericConverter : public ConcreteConverter {
+class BooleanConverter : public ConcreteConverter {
  public:
   using ConcreteConverter::ConcreteConverter;
 
@@ -195,23 +262,130 @@ class NumericConverter : public ConcreteConverter {
                  std::shared_ptr<Array>* out) override;
 };
 
+Status BooleanConverter::Convert(const BlockParser& parser, int32_t col_index,
+                                 std::shared_ptr<Array>* out) {
+  BooleanBuilder builder(type_, pool_);
+  StringConverter<BooleanType> converter;
+
+  auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+    bool value;
+    if (IsNull(data, size, quoted)) {
+      builder.UnsafeAppendNull();
+      return Status::OK();
+    }
+    if (ARROW_PREDICT_FALSE(
+            !converter(reinterpret_cast<const char*>(data), size, &value))) {
+      return GenericConversionError(type_, data, size);
+    }
+    builder.UnsafeAppend(value);
+    return Status::OK();
+  };
+  RETURN_NOT_OK(builder.Resize(parser.num_rows()));
+  RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+  RETURN_NOT_OK(builder.Finish(out));
+
+  return Status::OK();
+}
+
+/////////////////////////////////////////////////////////////////////////
+// Base class for Converters to fixed-width primitive types
+//
+// Converted values are written directly into a preallocated buffer.  Most
+// columns don't have any nulls, so the null bitmap is only allocated when
+// the first null is seen.  Also, if no null spelling is itself a valid value,
+// values are converted first and the null spellings are only looked up
+// for values that fail conversion.
+
+// The conversion attempted before looking up null spellings.  For floating-point
+// types it is restricted to plain decimal numbers, since the full conversion
+// also accepts some null spellings such as "NaN".
+template <typename T, typename Enable = void>
+struct FastValueParser {
+  template <typename StringConverterType, typename value_type>
+  static bool Parse(StringConverterType& converter, const char* s, size_t length,
+                    value_type* out) {
+    return converter(s, length, out);
+  }
+};
+
+template <typename T>
+struct FastValueParser<T, enable_if_floating_point<T>> {
+  template <typename StringConverterType, typename value_type>
+  static bool Parse(StringConverterType& converter, const char* s, size_t length,
+                    value_type* out) {
+    return converter.ParseSimple(s, length, out);
+  }
+};
+
 template <typename T>
-Status NumericConverter<T>::Convert(const BlockParser& parser, int32_t col_index,
-                                    std::shared_ptr<Array>* out) {
-  using BuilderType = typename TypeTraits<T>::BuilderType;
-  using value_type = typename StringConverter<T>::value_type;
+class PrimitiveConverter : public ConcreteConverter {
+ public:
+  using ConcreteConverter::ConcreteConverter;
+
+ protected:
+  using value_type = typename T::c_type;
+
+  // Whether some null spelling could be mistaken for a value
+  template <typename StringConverterType>
+  bool HasAmbiguousNulls(StringConverterType& converter) const {
+    for (const auto& s : options_.null_values) {
+      value_type value;
+      if (FastValueParser<T>::Parse(converter, s.data(), s.length(), &value)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <bool TrimWhitespace, typename StringConverterType>
+  Status ConvertColumn(StringConverterType& converter, const BlockParser& parser,
+                       int32_t col_index, std::shared_ptr<Array>* out);
 
-  BuilderType builder(type_, pool_);
-  StringConverter<T> converter;
+  bool ambiguous_nulls_ = true;
+};
+
+template <typename T>
+template <bool TrimWhitespace, typename StringConverterType>
+Status PrimitiveConverter<T>::ConvertColumn(StringConverterType& converter,
+                                            const BlockParser& parser, int32_t col_index,
+                                            std::shared_ptr<Array>* out) {
+  const int64_t length = parser.num_rows();
+  std::shared_ptr<Buffer> values_buffer;
+  std::shared_ptr<Buffer> null_bitmap;
+  int64_t null_count = 0;
+  RETURN_NOT_OK(
+      AllocateBuffer(pool_, length * static_cast<int64_t>(sizeof(value_type)),
+                     &values_buffer));
+  auto values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
+  int64_t index = 0;
+
+  auto append_null = [&]() -> Status {
+    if (ARROW_PREDICT_FALSE(null_bitmap == nullptr)) {
+      const int64_t null_bitmap_size = BitUtil::BytesForBits(length);
+      RETURN_NOT_OK(AllocateBuffer(pool_, null_bitmap_size, &null_bitmap));
+      std::memset(null_bitmap->mutable_data(), 0xff,
+                  static_cast<size_t>(null_bitmap_size));
+    }
+    BitUtil::ClearBit(null_bitmap->mutable_data(), index);
+    values[index++] = value_type{};
+    ++null_count;
+    return Status::OK();
+  };
 
   auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
     // XXX should quoted values be allowed at all?
     value_type value;
-    if (IsNull(data, size, quoted)) {
-      builder.UnsafeAppendNull();
+    if (ARROW_PREDICT_TRUE(!ambiguous_nulls_) &&
+        ARROW_PREDICT_TRUE(FastValueParser<T>::Parse(
+            converter, reinterpret_cast<const char*>(data), size, &value))) {
+      // A valid value, it can't be null
+      values[index++] = value;
       return Status::OK();
     }
-    if (!std::is_same<BooleanType, T>::value) {
+    if (IsNull(data, size, quoted)) {
+      return append_null();
+    }
+    if (TrimWhitespace) {
       // Skip trailing whitespace
       if (ARROW_PREDICT_TRUE(size > 0) &&
           ARROW_PREDICT_FALSE(IsWhitespace(data[size - 1]))) {
@@ -233,47 +407,59 @@ Status NumericConverter<T>::Convert(const BlockParser& parser, int32_t col_index
             !converter(reinterpret_cast<const char*>(data), size, &value))) {
       return GenericConversionError(type_, data, size);
     }
-    builder.UnsafeAppend(value);
+    values[index++] = value;
     return Status::OK();
   };
-  RETURN_NOT_OK(builder.Resize(parser.num_rows()));
   RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
-  RETURN_NOT_OK(builder.Finish(out));
+  DCHECK_EQ(index, length);
 
+  *out = MakeArray(ArrayData::Make(type_, length, {null_bitmap, values_buffer},
+                                   null_count));
   return Status::OK();
 }
 
 /////////////////////////////////////////////////////////////////////////
-// Concrete Converter for timestamps
+// Concrete Converter for numbers
 
-class TimestampConverter : public ConcreteConverter {
+template <typename T>
+class NumericConverter : public PrimitiveConverter<T> {
  public:
-  using ConcreteConverter::ConcreteConverter;
+  using PrimitiveConverter<T>::PrimitiveConverter;
 
   Status Convert(const BlockParser& parser, int32_t col_index,
                  std::shared_ptr<Array>* out) override {
-    using value_type = TimestampType::c_type;
+    StringConverter<T> converter;
+    return this->template ConvertColumn<true /* TrimWhitespace */>(converter, parser,
+                                                                   col_index, out);
+  }
 
-    TimestampBuilder builder(type_, pool_);
-    StringConverter<TimestampType> converter(type_);
+ protected:
+  Status Initialize() override {
+    RETURN_NOT_OK(PrimitiveConverter<T>::Initialize());
+    StringConverter<T> converter;
+    this->ambiguous_nulls_ = this->HasAmbiguousNulls(converter);
+    return Status::OK();
+  }
+};
 
-    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-      value_type value = 0;
-      if (IsNull(data, size, quoted)) {
-        builder.UnsafeAppendNull();
-        return Status::OK();
-      }
-      if (ARROW_PREDICT_FALSE(
-              !converter(reinterpret_cast<const char*>(data), size, &value))) {
-        return GenericConversionError(type_, data, size);
-      }
-      builder.UnsafeAppend(value);
-      return Status::OK();
-    };
-    RETURN_NOT_OK(builder.Resize(parser.num_rows()));
-    RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
-    RETURN_NOT_OK(builder.Finish(out));
+/////////////////////////////////////////////////////////////////////////
+// Concrete Converter for timestamps
+
+class TimestampConverter : public PrimitiveConverter<TimestampType> {
+ public:
+  using PrimitiveConverter<TimestampType>::PrimitiveConverter;
 
+  Status Convert(const BlockParser& parser, int32_t col_index,
+                 std::shared_ptr<Array>* out) override {
+    StringConverter<TimestampType> converter(type_);
+    return ConvertColumn<false /* TrimWhitespace */>(converter, parser, col_index, out);
+  }
+
+ protected:
+  Status Initialize() override {
+    RETURN_NOT_OK(PrimitiveConverter<TimestampType>::Initialize());
+    StringConverter<TimestampType> converter(type_);
+    ambiguous_nulls_ = HasAmbiguousNulls(converter);
     return Status::OK();
   }
 };
@@ -309,7 +495,7 @@ Status Converter::Make(const std::shared_ptr<DataType>& type,
     CONVERTER_CASE(Type::UINT64, NumericConverter<UInt64Type>)
     CONVERTER_CASE(Type::FLOAT, NumericConverter<FloatType>)
     CONVERTER_CASE(Type::DOUBLE, NumericConverter<DoubleType>)
-    CONVERTER_CASE(Type::BOOL, NumericConverter<BooleanType>)
+    CONVERTER_CASE(Type::BOOL, BooleanConverter)
     CONVERTER_CASE(Type::TIMESTAMP, TimestampConverter)
     CONVERTER_CASE(Type::BINARY, (VarSizeBinaryConverter<BinaryType, false>))
     CONVERTER_CASE(Type::FIXED_SIZE_BINARY, FixedSizeBinaryConverter)
@@ -338,5 +524,35 @@ Status Converter::Make(const std::shared_ptr<DataType>& type,
   return Make(type, options, default_memory_pool(), out);
 }
 
+Status DictionaryConverter::Make(const std::shared_ptr<DataType>& value_type,
+                                 const ConvertOptions& options, MemoryPool* pool,
+                                 std::shared_ptr<DictionaryConverter>* out) {
+  DictionaryConverter* result;
+
+  switch (value_type->id()) {
+    case Type::BINARY:
+      result =
+          new VarSizeBinaryDictConverter<BinaryType, false>(value_type, options, pool);
+      break;
+
+    case Type::STRING:
+      if (options.check_utf8) {
+        result =
+            new VarSizeBinaryDictConverter<StringType, true>(value_type, options, pool);
+      } else {
+        result =
+            new VarSizeBinaryDictConverter<StringType, false>(value_type, options, pool);
+      }
+      break;
+
+    default: {
+      return Status::NotImplemented("CSV dictionary conversion to ",
+                                    value_type->ToString(), " is not supported");
+    }
+  }
+  out->reset(result);
+  return result->Initialize();
+}
+
 }  // namespace csv
 }  // namespace arrow
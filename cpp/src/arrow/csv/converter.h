@@ -62,6 +62,23 @@ class ARROW_EXPORT Converter {
   std::shared_ptr<DataType> type_;
 };
 
+/// \brief A Converter producing dictionary-encoded arrays
+///
+/// Each converted chunk is a DictionaryArray with int32 indices and its own
+/// dictionary of `type()` values.
+class ARROW_EXPORT DictionaryConverter : public Converter {
+ public:
+  using Converter::Converter;
+
+  /// Make conversion fail with Status::CapacityError if a chunk has more than
+  /// `max_length` distinct values.
+  virtual void SetMaxCardinality(int32_t max_length) = 0;
+
+  static Status Make(const std::shared_ptr<DataType>& value_type,
+                     const ConvertOptions& options, MemoryPool* pool,
+                     std::shared_ptr<DictionaryConverter>* out);
+};
+
 }  // namespace csv
 }  // namespace arrow
 
@@ -0,0 +1,206 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vectorized lookup of the special characters of CSV data
+
+#ifndef ARROW_CSV_LEXING_INTERNAL_H
+#define ARROW_CSV_LEXING_INTERNAL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/csv/options.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/sse-util.h"
+
+#if defined(ARROW_USE_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace arrow {
+namespace csv {
+
+// A scanner locating the characters that interrupt a run of ordinary field
+// characters, so that the parsing state machines can jump from one such
+// character to the next instead of examining every byte.
+//
+// Data is classified 64 bytes at a time (with AVX2 or SSE2 when available)
+// into two bitmaps: the characters ending an unquoted run (delimiter, line
+// separators and escape character) and those ending a quoted run (quote and
+// escape characters).  The bitmaps of the current window are reused by
+// successive lookups.
+class SpecialCharScanner {
+ public:
+  static constexpr int64_t kWindowSize = 64;
+  // Byte-at-a-time lexing is faster for the short fields of typical CSV data,
+  // so the state machines only use the scanner after this many ordinary
+  // characters in a row
+  static constexpr int32_t kMinRunLength = 8;
+
+  SpecialCharScanner(const ParseOptions& options, const char* data_end)
+      : delimiter_(options.delimiter),
+        // Disabled special characters are made to alias another character
+        // of the same bitmap
+        quote_(options.quoting ? options.quote_char : options.delimiter),
+        unquoted_escape_(options.escaping ? options.escape_char : options.delimiter),
+        quoted_escape_(options.escaping ? options.escape_char : quote_),
+        data_end_(data_end),
+        window_start_(nullptr),
+        window_end_(nullptr),
+        unquoted_mask_(0),
+        quoted_mask_(0) {}
+
+  // Return the first character at or after `data` that may end a run of
+  // unquoted field characters, or the end of data
+  const char* NextUnquoted(const char* data) { return Next<false>(data); }
+
+  // Return the first character at or after `data` that may end a run of
+  // quoted field characters, or the end of data
+  const char* NextQuoted(const char* data) { return Next<true>(data); }
+
+ protected:
+  template <bool Quoted>
+  const char* Next(const char* data) {
+    // Fast path: the special character is in the current window
+    if (ARROW_PREDICT_TRUE(data >= window_start_ && data < window_end_)) {
+      const char* special = NextInWindow<Quoted>(data);
+      if (ARROW_PREDICT_TRUE(special != nullptr)) {
+        return special;
+      }
+      data = window_end_;
+    }
+    return NextInNewWindows<Quoted>(data);
+  }
+
+  template <bool Quoted>
+  const char* NextInWindow(const char* data) const {
+    const uint64_t mask = (Quoted ? quoted_mask_ : unquoted_mask_) >>
+                          static_cast<int>(data - window_start_);
+    return mask != 0 ? data + BitUtil::CountTrailingZeros(mask) : nullptr;
+  }
+
+  template <bool Quoted>
+  const char* NextInNewWindows(const char* data) {
+    while (data < data_end_) {
+      LoadWindow(data);
+      const char* special = NextInWindow<Quoted>(data);
+      if (special != nullptr) {
+        return special;
+      }
+      data = window_end_;
+    }
+    return data_end_;
+  }
+
+  void LoadWindow(const char* data) {
+    const int64_t size = std::min(kWindowSize, static_cast<int64_t>(data_end_ - data));
+    window_start_ = data;
+    window_end_ = data + size;
+    if (ARROW_PREDICT_TRUE(size == kWindowSize)) {
+      ClassifyWindow(data);
+    } else {
+      char padded[kWindowSize] = {};
+      std::memcpy(padded, data, static_cast<size_t>(size));
+      ClassifyWindow(padded);
+      const uint64_t valid = (uint64_t(1) << size) - 1;
+      unquoted_mask_ &= valid;
+      quoted_mask_ &= valid;
+    }
+  }
+
+#if defined(ARROW_USE_SIMD) && defined(__AVX2__)
+  void ClassifyWindow(const char* data) {
+    const __m256i delimiter = _mm256_set1_epi8(delimiter_);
+    const __m256i quote = _mm256_set1_epi8(quote_);
+    const __m256i unquoted_escape = _mm256_set1_epi8(unquoted_escape_);
+    const __m256i quoted_escape = _mm256_set1_epi8(quoted_escape_);
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+    unquoted_mask_ = quoted_mask_ = 0;
+    for (int i = 0; i < 2; ++i) {
+      const __m256i v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 32));
+      const __m256i unquoted = _mm256_or_si256(
+          _mm256_or_si256(_mm256_cmpeq_epi8(v, delimiter),
+                          _mm256_cmpeq_epi8(v, unquoted_escape)),
+          _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, lf)));
+      const __m256i quoted = _mm256_or_si256(_mm256_cmpeq_epi8(v, quote),
+                                             _mm256_cmpeq_epi8(v, quoted_escape));
+      unquoted_mask_ |= static_cast<uint64_t>(static_cast<uint32_t>(
+                            _mm256_movemask_epi8(unquoted)))
+                        << (i * 32);
+      quoted_mask_ |=
+          static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(quoted)))
+          << (i * 32);
+    }
+  }
+#elif defined(ARROW_HAVE_SSE2)
+  void ClassifyWindow(const char* data) {
+    const __m128i delimiter = _mm_set1_epi8(delimiter_);
+    const __m128i quote = _mm_set1_epi8(quote_);
+    const __m128i unquoted_escape = _mm_set1_epi8(unquoted_escape_);
+    const __m128i quoted_escape = _mm_set1_epi8(quoted_escape_);
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    unquoted_mask_ = quoted_mask_ = 0;
+    for (int i = 0; i < 4; ++i) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16));
+      const __m128i unquoted = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(v, delimiter), _mm_cmpeq_epi8(v, unquoted_escape)),
+          _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)));
+      const __m128i quoted =
+          _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, quoted_escape));
+      unquoted_mask_ |= static_cast<uint64_t>(_mm_movemask_epi8(unquoted)) << (i * 16);
+      quoted_mask_ |= static_cast<uint64_t>(_mm_movemask_epi8(quoted)) << (i * 16);
+    }
+  }
+#else
+  void ClassifyWindow(const char* data) {
+    unquoted_mask_ = quoted_mask_ = 0;
+    for (int i = 0; i < kWindowSize; ++i) {
+      const char c = data[i];
+      const uint64_t bit = uint64_t(1) << i;
+      if (c == delimiter_ || c == unquoted_escape_ || c == '\r' || c == '\n') {
+        unquoted_mask_ |= bit;
+      }
+      if (c == quote_ || c == quoted_escape_) {
+        quoted_mask_ |= bit;
+      }
+    }
+  }
+#endif
+
+  const char delimiter_;
+  const char quote_;
+  const char unquoted_escape_;
+  const char quoted_escape_;
+  const char* const data_end_;
+
+  // The window of data whose bitmaps are computed
+  const char* window_start_;
+  const char* window_end_;
+  uint64_t unquoted_mask_;
+  uint64_t quoted_mask_;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_LEXING_INTERNAL_H
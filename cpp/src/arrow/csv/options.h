@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -70,6 +71,20 @@ struct ARROW_EXPORT ConvertOptions {
   // Recognized spellings for null values
   std::vector<std::string> null_values;
 
+  // If non-empty, names of the columns to read, in the order they should
+  // appear in the output.  Other columns are only delimited, not converted.
+  std::vector<std::string> include_columns;
+  // Like include_columns, but with column indices (0-based).  Can't be used
+  // together with include_columns.
+  std::vector<int32_t> include_column_indices;
+
+  // Whether to dictionary-encode inferred string and binary columns.
+  // A column is only dictionary-encoded while it has at most
+  // auto_dict_max_cardinality distinct values over all its chunks; otherwise
+  // it is read as a regular string or binary column.
+  bool auto_dict_encode = false;
+  int32_t auto_dict_max_cardinality = 50;
+
   static ConvertOptions Defaults();
 };
 
@@ -81,10 +96,34 @@ struct ARROW_EXPORT ReadOptions {
   // Block size we request from the IO layer; also determines the size of
   // chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
+  // Maximum number of blocks read concurrently ahead of parsing; reads only
+  // overlap if the input is a RandomAccessFile
+  int32_t max_outstanding_reads = 1;
+  // Whether to adapt the size of blocks read to the I/O throughput, starting
+  // from block_size
+  bool adaptive_readahead = false;
+  // Compression of the input stream, decompressed ahead of parsing.  When
+  // use_threads is true, independent zstd frames or BGZF blocks are
+  // decompressed in parallel.
+  Compression::type compression = Compression::UNCOMPRESSED;
 
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  // Whether to write a first line with the column names
+  bool include_header = true;
+  // Maximum number of rows formatted at once; also determines the size of
+  // the work units when use_threads is true
+  int32_t batch_size = 1024;
+  // Whether to use the global CPU thread pool
+  bool use_threads = true;
+
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
 
@@ -46,6 +46,19 @@ static std::string BuildEscapedData(int32_t num_rows = 10000) {
   return ss.str();
 }
 
+// Rows with longer text fields, as in logs or free-form descriptions
+static std::string BuildTextData(int32_t num_rows = 10000) {
+  std::string one_row =
+      "2019-01-01 12:00:00,\"GET /index.html HTTP/1.1\",200,"
+      "\"Mozilla/5.0 (X11; Linux x86_64; rv:60.0) Gecko/20100101 Firefox/60.0\","
+      "a free-form description of the request\n";
+  std::stringstream ss;
+  for (int32_t i = 0; i < num_rows; ++i) {
+    ss << one_row;
+  }
+  return ss.str();
+}
+
 static void BenchmarkCSVChunking(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& csv, ParseOptions options) {
   Chunker chunker(options);
@@ -98,6 +111,17 @@ static void BM_ChunkCSVNoNewlinesBlock(
   BenchmarkCSVChunking(state, csv, options);
 }
 
+static void BM_ChunkCSVTextBlock(benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto csv = BuildTextData(num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+  options.newlines_in_values = true;
+
+  BenchmarkCSVChunking(state, csv, options);
+}
+
 static void BenchmarkCSVParsing(benchmark::State& state,  // NOLINT non-const reference
                                 const std::string& csv, int32_t num_rows,
                                 ParseOptions options) {
@@ -151,11 +175,23 @@ static void BM_ParseCSVEscapedBlock(
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void BM_ParseCSVTextBlock(benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto csv = BuildTextData(num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
 BENCHMARK(BM_ChunkCSVQuotedBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_ChunkCSVEscapedBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_ChunkCSVNoNewlinesBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ChunkCSVTextBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_ParseCSVQuotedBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_ParseCSVEscapedBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseCSVTextBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
 }  // namespace csv
 }  // namespace arrow
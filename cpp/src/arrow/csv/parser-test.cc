@@ -457,5 +457,61 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Special characters at all positions relative to the 64-byte windows
+  // of the lexer
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+  std::vector<std::string> lines;
+  std::vector<std::string> unquoted, quoted, escaped;
+  for (int length = 0; length < 150; length += 7) {
+    const std::string prefix(length, 'x');
+    lines.push_back(prefix + ",\"" + prefix + ",\"\"" + prefix + "\"," + prefix +
+                    "\\," + prefix + "\n");
+    unquoted.push_back(prefix);
+    quoted.push_back(prefix + ",\"" + prefix);
+    escaped.push_back(prefix + "," + prefix);
+  }
+  auto csv = MakeCSVData(lines);
+  BlockParser parser(options);
+  AssertParseOk(parser, csv);
+  AssertColumnsEq(parser, {unquoted, quoted, escaped});
+
+  // Truncated in the middle of a long field
+  BlockParser truncated_parser(options);
+  AssertParsePartial(truncated_parser, csv.substr(0, csv.size() - 20),
+                     static_cast<uint32_t>(csv.size() - lines.back().size()));
+}
+
+TEST(BlockParser, ColumnSelection) {
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+  const std::string long_field(100, 'x');
+  auto csv = MakeCSVData({"ab,\"c,\"\"d\",ef\n", "g\\,h,i\\\"j,\"\"\n",
+                          long_field + "," + long_field + "," + long_field + "\n"});
+  {
+    BlockParser parser(options);
+    parser.SetColumnSelection({false, true, false});
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{"", "", ""}, {"c,\"d", "i\"j", long_field}, {"", "", ""}});
+  }
+  {
+    BlockParser parser(options);
+    parser.SetColumnSelection({true, false});
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser,
+                    {{"ab", "g,h", long_field}, {"", "", ""}, {"ef", "", long_field}});
+  }
+  {
+    // Skipped fields are still delimited when truncated or at end of data
+    BlockParser parser(options);
+    parser.SetColumnSelection({true, true, false});
+    AssertParsePartial(parser, "a,b,c\nd,e,\"f", 6);
+    AssertColumnsEq(parser, {{"a"}, {"b"}, {""}});
+    AssertParseFinal(parser, "a,b,c\nd,e,\"f");
+    AssertColumnsEq(parser, {{"a", "d"}, {"b", "e"}, {"", ""}});
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -19,9 +19,11 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <sstream>
 #include <utility>
 
+#include "arrow/csv/lexing-internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -70,6 +72,20 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  void PushFieldChars(const char* data, int64_t size) {
+    DCHECK_LE(parsed_size_ + size, parsed_capacity_);
+    uint8_t* out = parsed_ + parsed_size_;
+    parsed_size_ += size;
+    if (size > 16) {
+      std::memcpy(out, data, static_cast<size_t>(size));
+    } else {
+      // Typical fields are short, avoid the memcpy() call overhead
+      for (int64_t i = 0; i < size; ++i) {
+        out[i] = static_cast<uint8_t>(data[i]);
+      }
+    }
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -189,10 +205,14 @@ class BlockParser::PresizedValuesWriter {
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
 Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                              const char* data, const char* data_end, bool is_final,
+                              SpecialCharScanner* scanner, const char* data,
+                              const char* data_end, bool is_final,
                               const char** out_data) {
   int32_t num_cols = 0;
+  int32_t run_length = 0;
   char c;
+  const uint8_t* skipped_columns = skipped_columns_.data();
+  const int32_t num_skipped_flags = static_cast<int32_t>(skipped_columns_.size());
 
   DCHECK_GT(data_end, data);
 
@@ -221,6 +241,10 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
 FieldStart:
   // At the start of a field
+  run_length = 0;
+  if (ARROW_PREDICT_FALSE(num_cols < num_skipped_flags && skipped_columns[num_cols])) {
+    goto SkippedFieldStart;
+  }
   // Quoting is only recognized at start of field
   if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
     ++data;
@@ -261,6 +285,13 @@ InField:
     }
   }
   parsed_writer->PushFieldChar(c);
+  if (ARROW_PREDICT_FALSE(++run_length == SpecialCharScanner::kMinRunLength)) {
+    // A long field: copy ordinary characters in bulk, up to the next special one
+    const char* special = scanner->NextUnquoted(data);
+    parsed_writer->PushFieldChars(data, special - data);
+    data = special;
+    run_length = 0;
+  }
   goto InField;
 
 InQuotedField:
@@ -288,8 +319,77 @@ InQuotedField:
     }
   }
   parsed_writer->PushFieldChar(c);
+  if (ARROW_PREDICT_FALSE(++run_length == SpecialCharScanner::kMinRunLength)) {
+    const char* special = scanner->NextQuoted(data);
+    parsed_writer->PushFieldChars(data, special - data);
+    data = special;
+    run_length = 0;
+  }
   goto InQuotedField;
 
+SkippedFieldStart:
+  // At the start of a field whose contents are not retained
+  values_writer->StartField(false /* quoted */);
+  if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
+    ++data;
+    goto InSkippedQuotedField;
+  }
+  goto InSkippedField;
+
+InSkippedField:
+  // Inside a non-quoted part of a skipped field: only look at special characters
+  data = scanner->NextUnquoted(data);
+  if (ARROW_PREDICT_FALSE(data == data_end)) {
+    goto AbortLine;
+  }
+  c = *data++;
+  if (SpecializedOptions::escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      goto AbortLine;
+    }
+    ++data;
+    goto InSkippedField;
+  }
+  if (c == options_.delimiter) {
+    goto FieldEnd;
+  }
+  if (c == '\r') {
+    if (ARROW_PREDICT_TRUE(data < data_end) && *data == '\n') {
+      data++;
+    }
+    goto LineEnd;
+  }
+  if (c == '\n') {
+    goto LineEnd;
+  }
+  goto InSkippedField;
+
+InSkippedQuotedField:
+  // Inside a quoted part of a skipped field
+  data = scanner->NextQuoted(data);
+  if (ARROW_PREDICT_FALSE(data == data_end)) {
+    goto AbortLine;
+  }
+  c = *data++;
+  if (SpecializedOptions::escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      goto AbortLine;
+    }
+    ++data;
+    goto InSkippedQuotedField;
+  }
+  if (c == options_.quote_char) {
+    if (options_.double_quote && ARROW_PREDICT_TRUE(data < data_end) &&
+        *data == options_.quote_char) {
+      // Double-quoting
+      ++data;
+      goto InSkippedQuotedField;
+    }
+    // End of single-quoting
+    goto InSkippedField;
+  }
+  goto InSkippedQuotedField;
+
 FieldEnd:
   // At the end of a field
   FinishField();
@@ -340,13 +440,13 @@ EmptyLine:
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
 Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                               const char* data, const char* data_end, bool is_final,
-                               int32_t rows_in_chunk, const char** out_data,
-                               bool* finished_parsing) {
+                               SpecialCharScanner* scanner, const char* data,
+                               const char* data_end, bool is_final, int32_t rows_in_chunk,
+                               const char** out_data, bool* finished_parsing) {
   while (data < data_end && rows_in_chunk > 0) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, scanner,
+                                                data, data_end, is_final, &line_end));
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -383,6 +483,7 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
   bool finished_parsing = false;
 
   PresizedParsedWriter parsed_writer(pool_, size);
+  SpecialCharScanner scanner(options_, data_end);
 
   if (num_cols_ == -1) {
     // Can't presize values when the number of columns is not known, first parse
@@ -391,9 +492,9 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
     ResizableValuesWriter values_writer(pool_);
     values_writer.Start(parsed_writer);
 
-    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                 data_end, is_final, rows_in_chunk, &data,
-                                                 &finished_parsing));
+    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+        &values_writer, &parsed_writer, &scanner, data, data_end, is_final,
+        rows_in_chunk, &data, &finished_parsing));
     if (num_cols_ == -1) {
       return ParseError("Empty CSV file or block: cannot infer number of columns");
     }
@@ -413,9 +514,9 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
     PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
     values_writer.Start(parsed_writer);
 
-    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                 data_end, is_final, rows_in_chunk, &data,
-                                                 &finished_parsing));
+    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+        &values_writer, &parsed_writer, &scanner, data, data_end, is_final,
+        rows_in_chunk, &data, &finished_parsing));
   }
 
   parsed_writer.Finish(&parsed_buffer_);
@@ -479,5 +580,12 @@ BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_col
 BlockParser::BlockParser(ParseOptions options, int32_t num_cols, int32_t max_num_rows)
     : BlockParser(default_memory_pool(), options, num_cols, max_num_rows) {}
 
+void BlockParser::SetColumnSelection(const std::vector<bool>& selected) {
+  skipped_columns_.resize(selected.size());
+  for (size_t i = 0; i < selected.size(); ++i) {
+    skipped_columns_[i] = selected[i] ? 0 : 1;
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
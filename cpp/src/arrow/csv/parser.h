@@ -35,6 +35,8 @@ class MemoryPool;
 
 namespace csv {
 
+class SpecialCharScanner;
+
 constexpr int32_t kMaxParserNumRows = 100000;
 
 /// \class BlockParser
@@ -68,6 +70,13 @@ class ARROW_EXPORT BlockParser {
   /// The last row may lack a trailing line separator.
   Status ParseFinal(const char* data, uint32_t size, uint32_t* out_size);
 
+  /// \brief Only retain the values of the selected columns
+  ///
+  /// Fields of unselected columns are delimited but their contents are not
+  /// stored: they are visited as empty values.  Columns beyond the end of
+  /// `selected` are retained.
+  void SetColumnSelection(const std::vector<bool>& selected);
+
   /// \brief Return the number of parsed rows
   int32_t num_rows() const { return num_rows_; }
   /// \brief Return the number of parsed columns
@@ -106,14 +115,15 @@ class ARROW_EXPORT BlockParser {
 
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
   Status ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                    const char* data, const char* data_end, bool is_final,
-                    int32_t rows_in_chunk, const char** out_data, bool* finished_parsing);
+                    SpecialCharScanner* scanner, const char* data, const char* data_end,
+                    bool is_final, int32_t rows_in_chunk, const char** out_data,
+                    bool* finished_parsing);
 
   // Parse a single line from the data pointer
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
   Status ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                   const char* data, const char* data_end, bool is_final,
-                   const char** out_data);
+                   SpecialCharScanner* scanner, const char* data, const char* data_end,
+                   bool is_final, const char** out_data);
 
   MemoryPool* pool_;
   const ParseOptions options_;
@@ -123,6 +133,8 @@ class ARROW_EXPORT BlockParser {
   int32_t num_cols_;
   // The maximum number of rows to parse from this block
   int32_t max_num_rows_;
+  // Non-zero for each column whose values are not retained
+  std::vector<uint8_t> skipped_columns_;
 
   // Linear scratchpad for parsed values
   struct ValueDesc {
@@ -0,0 +1,376 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+namespace csv {
+
+using internal::checked_cast;
+
+static std::string MakeNumberedData(int32_t num_rows) {
+  std::stringstream ss;
+  ss << "a,b,c\n";
+  for (int32_t i = 0; i < num_rows; ++i) {
+    ss << i << ",str" << i << "," << i * 0.5 << "\n";
+  }
+  return ss.str();
+}
+
+static std::shared_ptr<io::InputStream> MakeInput(const std::string& data) {
+  return std::make_shared<io::BufferReader>(Buffer::FromString(std::string(data)));
+}
+
+static void ReadTable(const std::string& data, const ReadOptions& read_options,
+                      const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options,
+                      std::shared_ptr<Table>* out) {
+  std::shared_ptr<TableReader> reader;
+  ASSERT_OK(TableReader::Make(default_memory_pool(), MakeInput(data), read_options,
+                              parse_options, convert_options, &reader));
+  ASSERT_OK(reader->Read(out));
+}
+
+static void ReadBatches(const std::string& data, const ReadOptions& read_options,
+                        const ParseOptions& parse_options,
+                        const ConvertOptions& convert_options,
+                        std::shared_ptr<Schema>* schema,
+                        std::vector<std::shared_ptr<RecordBatch>>* out) {
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(StreamingReader::Make(default_memory_pool(), MakeInput(data), read_options,
+                                  parse_options, convert_options, &reader));
+  *schema = reader->schema();
+  ASSERT_OK(reader->ReadAll(out));
+}
+
+class TestStreamingReader : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() {
+    read_options_ = ReadOptions::Defaults();
+    read_options_.use_threads = GetParam();
+    parse_options_ = ParseOptions::Defaults();
+    convert_options_ = ConvertOptions::Defaults();
+  }
+
+ protected:
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+};
+
+TEST_P(TestStreamingReader, SameAsTable) {
+  const std::string data = MakeNumberedData(1000);
+  read_options_.block_size = 256;
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadBatches(data, read_options_, parse_options_, convert_options_, &schema, &batches);
+  ASSERT_GT(batches.size(), 10);
+  for (const auto& batch : batches) {
+    ASSERT_GT(batch->num_rows(), 0);
+    AssertSchemaEqual(*schema, *batch->schema());
+  }
+  AssertSchemaEqual(*schema,
+                    *arrow::schema({field("a", int64()), field("b", utf8()),
+                                    field("c", float64())}));
+
+  std::shared_ptr<Table> actual, expected;
+  ASSERT_OK(Table::FromRecordBatches(batches, &actual));
+  ReadTable(data, read_options_, parse_options_, convert_options_, &expected);
+  AssertTablesEqual(*expected, *actual, false /* same_chunk_layout */);
+}
+
+// Compress slices of data as separate gzip members
+static std::string CompressData(const std::string& data, size_t member_size) {
+  std::unique_ptr<util::Codec> codec;
+  ABORT_NOT_OK(util::Codec::Create(Compression::GZIP, &codec));
+  std::string compressed;
+  for (size_t pos = 0; pos < data.size(); pos += member_size) {
+    auto member = data.substr(pos, member_size);
+    auto input = reinterpret_cast<const uint8_t*>(member.data());
+    int64_t max_len = codec->MaxCompressedLen(member.size(), input);
+    std::string out(max_len, '\0');
+    int64_t out_len;
+    ABORT_NOT_OK(codec->Compress(member.size(), input, max_len,
+                                 reinterpret_cast<uint8_t*>(&out[0]), &out_len));
+    compressed += out.substr(0, out_len);
+  }
+  return compressed;
+}
+
+TEST_P(TestStreamingReader, CompressedInput) {
+  const std::string data = MakeNumberedData(1000);
+  const std::string compressed = CompressData(data, 5000);
+  read_options_.block_size = 1000;
+
+  std::shared_ptr<Table> expected, actual;
+  ReadTable(data, read_options_, parse_options_, convert_options_, &expected);
+  read_options_.compression = Compression::GZIP;
+  ReadTable(compressed, read_options_, parse_options_, convert_options_, &actual);
+  AssertTablesEqual(*expected, *actual, false /* same_chunk_layout */);
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadBatches(compressed, read_options_, parse_options_, convert_options_, &schema,
+              &batches);
+  ASSERT_OK(Table::FromRecordBatches(batches, &actual));
+  AssertTablesEqual(*expected, *actual, false /* same_chunk_layout */);
+}
+
+TEST_P(TestStreamingReader, SingleBlock) {
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadBatches("a,b\n1,x\n2,y\n3,z\n", read_options_, parse_options_, convert_options_,
+              &schema, &batches);
+  ASSERT_EQ(batches.size(), 1);
+  ASSERT_EQ(batches[0]->num_rows(), 3);
+
+  // Without a trailing line separator, the last row is parsed separately
+  batches.clear();
+  ReadBatches("a,b\n1,x\n2,y\n3,z", read_options_, parse_options_, convert_options_,
+              &schema, &batches);
+  ASSERT_EQ(batches.size(), 2);
+  ASSERT_EQ(batches[0]->num_rows(), 2);
+  ASSERT_EQ(batches[1]->num_rows(), 1);
+}
+
+TEST_P(TestStreamingReader, HeaderOnly) {
+  const std::string data = "a,b\n";
+  convert_options_.column_types["b"] = int16();
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadBatches(data, read_options_, parse_options_, convert_options_, &schema, &batches);
+  ASSERT_EQ(batches.size(), 0);
+  AssertSchemaEqual(*schema, *arrow::schema({field("a", null()), field("b", int16())}));
+}
+
+TEST_P(TestStreamingReader, TypeFixedByFirstBlock) {
+  // Column "a" only gets a non-integer value after the first block
+  std::string data = MakeNumberedData(1000) + "xyz,str,1.5\n";
+  read_options_.block_size = 256;
+
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(StreamingReader::Make(default_memory_pool(), MakeInput(data), read_options_,
+                                  parse_options_, convert_options_, &reader));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Status st = reader->ReadAll(&batches);
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_NE(st.message().find("In column 'a'"), std::string::npos) << st.ToString();
+
+  // Overriding the column type allows reading the data
+  convert_options_.column_types["a"] = utf8();
+  std::shared_ptr<Schema> schema;
+  batches.clear();
+  ReadBatches(data, read_options_, parse_options_, convert_options_, &schema, &batches);
+  AssertSchemaEqual(*schema,
+                    *arrow::schema({field("a", utf8()), field("b", utf8()),
+                                    field("c", float64())}));
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 1001);
+}
+
+TEST_P(TestStreamingReader, NullColumnInFirstBlock) {
+  std::stringstream ss;
+  ss << "a,b\n";
+  for (int32_t i = 0; i < 100; ++i) {
+    ss << i << ",\n";
+  }
+  ss << "100,xyz\n";
+  read_options_.block_size = 64;
+
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(StreamingReader::Make(default_memory_pool(), MakeInput(ss.str()),
+                                  read_options_, parse_options_, convert_options_,
+                                  &reader));
+  AssertSchemaEqual(*reader->schema(),
+                    *arrow::schema({field("a", int64()), field("b", null())}));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Status st = reader->ReadAll(&batches);
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_NE(st.message().find("column_types"), std::string::npos) << st.ToString();
+}
+
+TEST_P(TestStreamingReader, Empty) {
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_RAISES(Invalid,
+                StreamingReader::Make(default_memory_pool(), MakeInput(""),
+                                      read_options_, parse_options_, convert_options_,
+                                      &reader));
+}
+
+TEST_P(TestStreamingReader, IncludeColumns) {
+  const std::string data = MakeNumberedData(1000);
+  read_options_.block_size = 256;
+  convert_options_.include_columns = {"c", "a"};
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadBatches(data, read_options_, parse_options_, convert_options_, &schema, &batches);
+  AssertSchemaEqual(*schema,
+                    *arrow::schema({field("c", float64()), field("a", int64())}));
+
+  std::shared_ptr<Table> actual, expected;
+  ASSERT_OK(Table::FromRecordBatches(batches, &actual));
+  ReadTable(data, read_options_, parse_options_, convert_options_, &expected);
+  AssertTablesEqual(*expected, *actual, false /* same_chunk_layout */);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Tests for column projection
+
+class TestIncludeColumns : public TestStreamingReader {
+ public:
+  void AssertReadTable(const std::string& data, const Table& expected) {
+    std::shared_ptr<Table> actual;
+    ReadTable(data, read_options_, parse_options_, convert_options_, &actual);
+    AssertTablesEqual(expected, *actual, false /* same_chunk_layout */);
+  }
+
+  void AssertReadFails(const std::string& data) {
+    std::shared_ptr<TableReader> reader;
+    std::shared_ptr<Table> table;
+    ASSERT_OK(TableReader::Make(default_memory_pool(), MakeInput(data), read_options_,
+                                parse_options_, convert_options_, &reader));
+    ASSERT_RAISES(Invalid, reader->Read(&table));
+  }
+};
+
+TEST_P(TestIncludeColumns, ByName) {
+  const std::string data = "a,b,c\n1,x,\"1,5\"\n2,y,zz\n";
+  std::vector<std::shared_ptr<Field>> fields = {field("c", utf8()), field("a", int64())};
+  std::shared_ptr<Array> c, a;
+  ArrayFromVector<StringType, std::string>({"1,5", "zz"}, &c);
+  ArrayFromVector<Int64Type>({1, 2}, &a);
+  auto expected = Table::Make(arrow::schema(fields), {c, a});
+
+  convert_options_.include_columns = {"c", "a"};
+  AssertReadTable(data, *expected);
+}
+
+TEST_P(TestIncludeColumns, ByIndex) {
+  const std::string data = "a,b,c\n1,x,1.5\n2,y,2.5\n";
+  std::vector<std::shared_ptr<Field>> fields = {field("b", utf8())};
+  std::shared_ptr<Array> b;
+  ArrayFromVector<StringType, std::string>({"x", "y"}, &b);
+  auto expected = Table::Make(arrow::schema(fields), {b});
+
+  convert_options_.include_column_indices = {1};
+  AssertReadTable(data, *expected);
+}
+
+TEST_P(TestIncludeColumns, Errors) {
+  const std::string data = "a,b,c\n1,x,1.5\n";
+  convert_options_.include_columns = {"a", "d"};
+  AssertReadFails(data);
+  convert_options_.include_columns = {"a", "a"};
+  AssertReadFails(data);
+  convert_options_.include_columns = {"a"};
+  convert_options_.include_column_indices = {0};
+  AssertReadFails(data);
+  convert_options_.include_columns.clear();
+  convert_options_.include_column_indices = {3};
+  AssertReadFails(data);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Tests for dictionary encoding
+
+class TestAutoDictEncode : public TestStreamingReader {};
+
+TEST_P(TestAutoDictEncode, TableReader) {
+  std::stringstream ss;
+  ss << "a,b\n";
+  for (int32_t i = 0; i < 1000; ++i) {
+    ss << "str" << i % 3 << ",str" << i << "\n";
+  }
+  read_options_.block_size = 256;
+  convert_options_.auto_dict_encode = true;
+  convert_options_.auto_dict_max_cardinality = 10;
+
+  std::shared_ptr<Table> table;
+  ReadTable(ss.str(), read_options_, parse_options_, convert_options_, &table);
+  ASSERT_GT(table->column(0)->data()->num_chunks(), 10);
+
+  // Column "a" has few distinct values, column "b" too many
+  ASSERT_EQ(table->schema()->field(0)->type()->id(), Type::DICTIONARY);
+  const auto& dict_type = checked_cast<const DictionaryType&>(
+      *table->schema()->field(0)->type());
+  ASSERT_EQ(dict_type.dictionary()->length(), 3);
+  ASSERT_TRUE(dict_type.index_type()->Equals(int8()));
+  ASSERT_TRUE(table->schema()->field(1)->type()->Equals(utf8()));
+
+  // Same values as without dictionary encoding
+  std::shared_ptr<Table> dense_table;
+  convert_options_.auto_dict_encode = false;
+  ReadTable(ss.str(), read_options_, parse_options_, convert_options_, &dense_table);
+  const auto& dict_values = checked_cast<const StringArray&>(*dict_type.dictionary());
+  int64_t row = 0;
+  for (const auto& chunk : table->column(0)->data()->chunks()) {
+    const auto& indices =
+        checked_cast<const Int8Array&>(*checked_cast<const DictionaryArray&>(*chunk)
+                                            .indices());
+    for (int64_t i = 0; i < indices.length(); ++i, ++row) {
+      std::stringstream expected;
+      expected << "str" << row % 3;
+      ASSERT_EQ(dict_values.GetString(indices.Value(i)), expected.str());
+    }
+  }
+  ASSERT_EQ(row, dense_table->num_rows());
+}
+
+TEST_P(TestAutoDictEncode, StreamingReaderIgnoresOption) {
+  convert_options_.auto_dict_encode = true;
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadBatches("a\nx\ny\nx\n", read_options_, parse_options_, convert_options_,
+              &schema, &batches);
+  AssertSchemaEqual(*schema, *arrow::schema({field("a", utf8())}));
+}
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestAutoDictEncode,
+                        ::testing::Values(false, true));
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestIncludeColumns,
+                        ::testing::Values(false, true));
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestStreamingReader,
+                        ::testing::Values(false, true));
+
+}  // namespace csv
+}  // namespace arrow
@@ -17,8 +17,11 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <future>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -27,12 +30,17 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/builder.h"
 #include "arrow/csv/chunker.h"
 #include "arrow/csv/column-builder.h"
+#include "arrow/csv/converter.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
+#include "arrow/io/compressed.h"
 #include "arrow/io/readahead.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -61,14 +69,26 @@ using io::internal::ReadaheadSpooler;
 static constexpr int64_t kDefaultLeftPadding = 2048;  // 2 kB
 static constexpr int64_t kDefaultRightPadding = 16;
 
+static io::ReadaheadOptions MakeReadaheadOptions(const ReadOptions& read_options,
+                                                 int32_t block_queue_size) {
+  io::ReadaheadOptions options = io::ReadaheadOptions::Defaults();
+  options.read_size = read_options.block_size;
+  options.readahead_queue_size = block_queue_size;
+  options.max_outstanding_reads = std::max(read_options.max_outstanding_reads, 1);
+  options.adaptive = read_options.adaptive_readahead;
+  options.min_read_size = std::min<int64_t>(options.min_read_size, options.read_size);
+  options.left_padding = kDefaultLeftPadding;
+  options.right_padding = kDefaultRightPadding;
+  return options;
+}
+
 /////////////////////////////////////////////////////////////////////////
 // Base class for common functionality
 
-class BaseTableReader : public csv::TableReader {
+class BaseReader {
  public:
-  BaseTableReader(MemoryPool* pool, const ReadOptions& read_options,
-                  const ParseOptions& parse_options,
-                  const ConvertOptions& convert_options)
+  BaseReader(MemoryPool* pool, const ReadOptions& read_options,
+             const ParseOptions& parse_options, const ConvertOptions& convert_options)
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
@@ -132,7 +152,7 @@ class BaseTableReader : public csv::TableReader {
     return Status::OK();
   }
 
-  // Read header and column names from current block, create column builders
+  // Read header and column names from current block
   Status ProcessHeader() {
     DCHECK_GT(cur_size_, 0);
     if (parse_options_.header_rows == 0) {
@@ -163,22 +183,97 @@ class BaseTableReader : public csv::TableReader {
         return Status::OK();
       };
       RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+    }
+
+    // Skip parsed header rows
+    cur_data_ += parsed_size;
+    cur_size_ -= parsed_size;
+    return ResolveIncludedColumns();
+  }
+
+  // Compute the indices of the columns to convert, in output order
+  Status ResolveIncludedColumns() {
+    const auto& include_names = convert_options_.include_columns;
+    const auto& include_indices = convert_options_.include_column_indices;
+    column_indices_.clear();
+    column_selection_.clear();
+
+    if (include_names.empty() && include_indices.empty()) {
+      // Convert all columns
+      for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        column_indices_.push_back(col_index);
+      }
+      return Status::OK();
+    }
+    if (!include_names.empty() && !include_indices.empty()) {
+      return Status::Invalid("Cannot specify both include_columns and ",
+                             "include_column_indices");
+    }
+
+    if (!include_names.empty()) {
+      std::unordered_map<std::string, int32_t> name_to_index;
+      for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        // In case of duplicate names, the first column wins
+        name_to_index.emplace(column_names_[col_index], col_index);
+      }
+      for (const auto& name : include_names) {
+        auto it = name_to_index.find(name);
+        if (it == name_to_index.end()) {
+          return Status::Invalid("Column '", name, "' in include_columns ",
+                                 "does not exist in CSV file");
+        }
+        column_indices_.push_back(it->second);
+      }
+    } else {
+      for (const auto col_index : include_indices) {
+        if (col_index < 0 || col_index >= num_cols_) {
+          return Status::Invalid("Column index ", col_index,
+                                 " in include_column_indices is out of bounds ",
+                                 "(CSV file has ", num_cols_, " columns)");
+        }
+        column_indices_.push_back(col_index);
+      }
+    }
+
+    column_selection_.assign(num_cols_, false);
+    for (const auto col_index : column_indices_) {
+      if (column_selection_[col_index]) {
+        return Status::Invalid("Column '", column_names_[col_index],
+                               "' is included several times");
+      }
+      column_selection_[col_index] = true;
+    }
+    return Status::OK();
+  }
+
+  // Create a parser for data rows, not retaining the values of excluded columns
+  std::shared_ptr<BlockParser> MakeDataParser() {
+    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
+    auto parser =
+        std::make_shared<BlockParser>(pool_, parse_options_, num_cols_, max_num_rows);
+    if (!column_selection_.empty()) {
+      parser->SetColumnSelection(column_selection_);
+    }
+    return parser;
+  }
+
+  // Create a column builder for each included column, on the given task group
+  Status MakeColumnBuilders(const std::shared_ptr<internal::TaskGroup>& task_group,
+                            std::vector<std::shared_ptr<ColumnBuilder>>* out) {
+    out->clear();
+    for (const auto col_index : column_indices_) {
       std::shared_ptr<ColumnBuilder> builder;
       // Does the named column have a fixed type?
       auto it = convert_options_.column_types.find(column_names_[col_index]);
       if (it == convert_options_.column_types.end()) {
         RETURN_NOT_OK(
-            ColumnBuilder::Make(col_index, convert_options_, task_group_, &builder));
+            ColumnBuilder::Make(col_index, convert_options_, task_group, &builder));
       } else {
         RETURN_NOT_OK(ColumnBuilder::Make(it->second, col_index, convert_options_,
-                                          task_group_, &builder));
+                                          task_group, &builder));
       }
-      column_builders_.push_back(builder);
+      out->push_back(builder);
     }
-
-    // Skip parsed header rows
-    cur_data_ += parsed_size;
-    cur_size_ -= parsed_size;
     return Status::OK();
   }
 
@@ -193,15 +288,16 @@ class BaseTableReader : public csv::TableReader {
   Status MakeTable(std::shared_ptr<Table>* out) {
     DCHECK_GT(num_cols_, 0);
     DCHECK_EQ(column_names_.size(), static_cast<uint32_t>(num_cols_));
-    DCHECK_EQ(column_builders_.size(), static_cast<uint32_t>(num_cols_));
+    DCHECK_EQ(column_builders_.size(), column_indices_.size());
 
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<Column>> columns;
 
-    for (int32_t i = 0; i < num_cols_; ++i) {
+    for (size_t i = 0; i < column_builders_.size(); ++i) {
       std::shared_ptr<ChunkedArray> array;
       RETURN_NOT_OK(column_builders_[i]->Finish(&array));
-      columns.push_back(std::make_shared<Column>(column_names_[i], array));
+      columns.push_back(
+          std::make_shared<Column>(column_names_[column_indices_[i]], array));
       fields.push_back(columns.back()->field());
     }
     *out = Table::Make(schema(fields), columns);
@@ -217,6 +313,10 @@ class BaseTableReader : public csv::TableReader {
   std::shared_ptr<ReadaheadSpooler> readahead_;
   // Column names
   std::vector<std::string> column_names_;
+  // Indices of the columns to convert, in output order
+  std::vector<int32_t> column_indices_;
+  // Whether each column is converted (empty if all columns are)
+  std::vector<bool> column_selection_;
   std::shared_ptr<internal::TaskGroup> task_group_;
   std::vector<std::shared_ptr<ColumnBuilder>> column_builders_;
 
@@ -236,20 +336,20 @@ class BaseTableReader : public csv::TableReader {
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
-class SerialTableReader : public BaseTableReader {
+class SerialTableReader : public TableReader, public BaseReader {
  public:
   SerialTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                     const ReadOptions& read_options, const ParseOptions& parse_options,
                     const ConvertOptions& convert_options)
-      : BaseTableReader(pool, read_options, parse_options, convert_options) {
-    // Since we're converting serially, no need to readahead more than one block
-    int32_t block_queue_size = 1;
+      : BaseReader(pool, read_options, parse_options, convert_options) {
+    // Since we're converting serially, no need to readahead more blocks than
+    // are read concurrently
+    int32_t block_queue_size = std::max(read_options_.max_outstanding_reads, 1);
     readahead_ = std::make_shared<ReadaheadSpooler>(
-        pool_, input, read_options_.block_size, block_queue_size, kDefaultLeftPadding,
-        kDefaultRightPadding);
+        pool_, input, MakeReadaheadOptions(read_options_, block_queue_size));
   }
 
-  Status Read(std::shared_ptr<Table>* out) {
+  Status Read(std::shared_ptr<Table>* out) override {
     task_group_ = internal::TaskGroup::MakeSerial();
 
     // First block
@@ -258,10 +358,9 @@ class SerialTableReader : public BaseTableReader {
       return Status::Invalid("Empty CSV file");
     }
     RETURN_NOT_OK(ProcessHeader());
+    RETURN_NOT_OK(MakeColumnBuilders(task_group_, &column_builders_));
 
-    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
-    auto parser =
-        std::make_shared<BlockParser>(pool_, parse_options_, num_cols_, max_num_rows);
+    auto parser = MakeDataParser();
     while (!eof_) {
       // Consume current block
       uint32_t parsed_size = 0;
@@ -300,32 +399,30 @@ class SerialTableReader : public BaseTableReader {
 /////////////////////////////////////////////////////////////////////////
 // Parallel TableReader implementation
 
-class ThreadedTableReader : public BaseTableReader {
+class ThreadedTableReader : public TableReader, public BaseReader {
  public:
   ThreadedTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                       ThreadPool* thread_pool, const ReadOptions& read_options,
                       const ParseOptions& parse_options,
                       const ConvertOptions& convert_options)
-      : BaseTableReader(pool, read_options, parse_options, convert_options),
+      : BaseReader(pool, read_options, parse_options, convert_options),
         thread_pool_(thread_pool) {
     // Readahead one block per worker thread
     int32_t block_queue_size = thread_pool->GetCapacity();
     readahead_ = std::make_shared<ReadaheadSpooler>(
-        pool_, input, read_options_.block_size, block_queue_size, kDefaultLeftPadding,
-        kDefaultRightPadding);
+        pool_, input, MakeReadaheadOptions(read_options_, block_queue_size));
   }
 
   ~ThreadedTableReader() {
     if (task_group_) {
       // In case of error, make sure all pending tasks are finished before
-      // we start destroying BaseTableReader members
+      // we start destroying BaseReader members
       ARROW_UNUSED(task_group_->Finish());
     }
   }
 
-  Status Read(std::shared_ptr<Table>* out) {
+  Status Read(std::shared_ptr<Table>* out) override {
     task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
-    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
     Chunker chunker(parse_options_);
 
     // Get first block and process header serially
@@ -334,6 +431,7 @@ class ThreadedTableReader : public BaseTableReader {
       return Status::Invalid("Empty CSV file");
     }
     RETURN_NOT_OK(ProcessHeader());
+    RETURN_NOT_OK(MakeColumnBuilders(task_group_, &column_builders_));
 
     while (!eof_ && task_group_->ok()) {
       // Consume current chunk
@@ -348,8 +446,7 @@ class ThreadedTableReader : public BaseTableReader {
 
         // "mutable" allows to modify captured by-copy chunk_buffer
         task_group_->Append([=]() mutable -> Status {
-          auto parser = std::make_shared<BlockParser>(pool_, parse_options_, num_cols_,
-                                                      max_num_rows);
+          auto parser = MakeDataParser();
           uint32_t parsed_size = 0;
           RETURN_NOT_OK(parser->Parse(reinterpret_cast<const char*>(chunk_data),
                                       chunk_size, &parsed_size));
@@ -381,8 +478,7 @@ class ThreadedTableReader : public BaseTableReader {
       for (auto& builder : column_builders_) {
         builder->SetTaskGroup(task_group_);
       }
-      auto parser =
-          std::make_shared<BlockParser>(pool_, parse_options_, num_cols_, max_num_rows);
+      auto parser = MakeDataParser();
       uint32_t parsed_size = 0;
       RETURN_NOT_OK(parser->ParseFinal(reinterpret_cast<const char*>(cur_data_),
                                        static_cast<uint32_t>(cur_size_), &parsed_size));
@@ -400,6 +496,252 @@ class ThreadedTableReader : public BaseTableReader {
   ThreadPool* thread_pool_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader implementation
+
+class StreamingReaderImpl : public StreamingReader, public BaseReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      ThreadPool* thread_pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options)
+      : BaseReader(pool, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool),
+        chunker_(parse_options_) {
+    // The schema is fixed after the first block, but a dictionary type
+    // embeds its dictionary
+    convert_options_.auto_dict_encode = false;
+    // Readahead one block per block in flight
+    int32_t block_queue_size = thread_pool_ != nullptr
+                                   ? thread_pool_->GetCapacity()
+                                   : std::max(read_options_.max_outstanding_reads, 1);
+    readahead_ = std::make_shared<ReadaheadSpooler>(
+        pool_, input, MakeReadaheadOptions(read_options_, block_queue_size));
+  }
+
+  ~StreamingReaderImpl() {
+    // Make sure all pending tasks are finished before we start destroying
+    // members they refer to
+    for (const auto& pending : pending_) {
+      pending->status.wait();
+    }
+  }
+
+  Status Init() {
+    // Get first block and process header
+    RETURN_NOT_OK(ReadNextBlock());
+    if (eof_) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader());
+
+    // Infer column types from the first chunk of data, which is converted
+    // along the way
+    Chunk chunk;
+    bool have_chunk = false;
+    RETURN_NOT_OK(NextChunk(&chunk, &have_chunk));
+
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> arrays;
+    int64_t num_rows = 0;
+    if (have_chunk) {
+      std::shared_ptr<BlockParser> parser;
+      RETURN_NOT_OK(ParseChunk(chunk, &parser));
+      num_rows = parser->num_rows();
+
+      auto task_group = internal::TaskGroup::MakeSerial();
+      std::vector<std::shared_ptr<ColumnBuilder>> builders;
+      RETURN_NOT_OK(MakeColumnBuilders(task_group, &builders));
+      for (auto& builder : builders) {
+        builder->Insert(0, parser);
+      }
+      RETURN_NOT_OK(task_group->Finish());
+      for (size_t i = 0; i < builders.size(); ++i) {
+        std::shared_ptr<ChunkedArray> array;
+        RETURN_NOT_OK(builders[i]->Finish(&array));
+        DCHECK_EQ(array->num_chunks(), 1);
+        fields.push_back(field(column_names_[column_indices_[i]], array->type()));
+        arrays.push_back(array->chunk(0));
+      }
+    } else {
+      // No data rows: only explicitly typed columns are not null-typed
+      for (const auto col_index : column_indices_) {
+        const auto& name = column_names_[col_index];
+        auto it = convert_options_.column_types.find(name);
+        fields.push_back(field(name,
+                               it == convert_options_.column_types.end() ? null()
+                                                                         : it->second));
+        std::unique_ptr<ArrayBuilder> builder;
+        std::shared_ptr<Array> array;
+        RETURN_NOT_OK(MakeBuilder(pool_, fields.back()->type(), &builder));
+        RETURN_NOT_OK(builder->Finish(&array));
+        arrays.push_back(array);
+      }
+    }
+    schema_ = ::arrow::schema(fields);
+
+    converters_.resize(fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+      RETURN_NOT_OK(
+          Converter::Make(fields[i]->type(), convert_options_, pool_, &converters_[i]));
+    }
+    if (num_rows > 0) {
+      first_batch_ = RecordBatch::Make(schema_, num_rows, arrays);
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (first_batch_) {
+      *out = std::move(first_batch_);
+      return Status::OK();
+    }
+    // Skip batches with no rows (e.g. a final chunk of empty lines)
+    do {
+      if (thread_pool_ != nullptr) {
+        RETURN_NOT_OK(ReadNextThreaded(out));
+      } else {
+        RETURN_NOT_OK(ReadNextSerial(out));
+      }
+    } while (*out && (*out)->num_rows() == 0);
+    return Status::OK();
+  }
+
+ protected:
+  // A chunk of whole CSV rows, keeping alive the block it points into
+  struct Chunk {
+    std::shared_ptr<Buffer> block;
+    const char* data;
+    uint32_t size;
+    // Whether this is the last chunk in the stream, which may lack a
+    // trailing line separator
+    bool is_final;
+  };
+
+  // A chunk submitted to the thread pool
+  struct PendingBatch {
+    std::future<Status> status;
+    std::shared_ptr<RecordBatch> batch;
+  };
+
+  // Cut the next chunk of rows from the current block, reading more blocks
+  // as necessary
+  Status NextChunk(Chunk* out, bool* have_chunk) {
+    while (!eof_) {
+      uint32_t chunk_size = 0;
+      RETURN_NOT_OK(chunker_.Process(reinterpret_cast<const char*>(cur_data_),
+                                     static_cast<uint32_t>(cur_size_), &chunk_size));
+      if (chunk_size > 0) {
+        *out = {cur_block_, reinterpret_cast<const char*>(cur_data_), chunk_size, false};
+        cur_data_ += chunk_size;
+        cur_size_ -= chunk_size;
+        *have_chunk = true;
+        return Status::OK();
+      }
+      // Need to fetch more data to get at least one row
+      RETURN_NOT_OK(ReadNextBlock());
+    }
+    if (cur_size_ > 0) {
+      // Remaining data
+      *out = {cur_block_, reinterpret_cast<const char*>(cur_data_),
+              static_cast<uint32_t>(cur_size_), true};
+      cur_data_ += cur_size_;
+      cur_size_ = 0;
+      *have_chunk = true;
+      return Status::OK();
+    }
+    *have_chunk = false;
+    return Status::OK();
+  }
+
+  Status ParseChunk(const Chunk& chunk, std::shared_ptr<BlockParser>* out) {
+    auto parser = MakeDataParser();
+    uint32_t parsed_size = 0;
+    if (chunk.is_final) {
+      RETURN_NOT_OK(parser->ParseFinal(chunk.data, chunk.size, &parsed_size));
+    } else {
+      RETURN_NOT_OK(parser->Parse(chunk.data, chunk.size, &parsed_size));
+      if (parsed_size != chunk.size) {
+        DCHECK_EQ(parsed_size, chunk.size);
+        return Status::Invalid("Chunker and parser disagree on block size: ",
+                               chunk.size, " vs ", parsed_size);
+      }
+    }
+    *out = parser;
+    return Status::OK();
+  }
+
+  // Parse and convert a chunk to a record batch of the stream schema
+  Status ProcessChunk(const Chunk& chunk, std::shared_ptr<RecordBatch>* out) {
+    std::shared_ptr<BlockParser> parser;
+    RETURN_NOT_OK(ParseChunk(chunk, &parser));
+
+    std::vector<std::shared_ptr<Array>> arrays(converters_.size());
+    for (size_t i = 0; i < converters_.size(); ++i) {
+      const int32_t col_index = column_indices_[i];
+      Status st = converters_[i]->Convert(*parser, col_index, &arrays[i]);
+      if (!st.ok()) {
+        std::stringstream ss;
+        ss << "In column '" << column_names_[col_index] << "': " << st.message();
+        if (converters_[i]->type()->id() == Type::NA) {
+          ss << " (column type was inferred as null from the first block of "
+                "data; specify it in ConvertOptions::column_types)";
+        }
+        return Status(st.code(), ss.str());
+      }
+    }
+    *out = RecordBatch::Make(schema_, parser->num_rows(), std::move(arrays));
+    return Status::OK();
+  }
+
+  Status ReadNextSerial(std::shared_ptr<RecordBatch>* out) {
+    Chunk chunk;
+    bool have_chunk = false;
+    RETURN_NOT_OK(NextChunk(&chunk, &have_chunk));
+    if (!have_chunk) {
+      out->reset();
+      return Status::OK();
+    }
+    return ProcessChunk(chunk, out);
+  }
+
+  Status ReadNextThreaded(std::shared_ptr<RecordBatch>* out) {
+    // Keep one chunk in flight per worker thread
+    const size_t capacity = static_cast<size_t>(thread_pool_->GetCapacity());
+    while (pending_.size() < capacity) {
+      Chunk chunk;
+      bool have_chunk = false;
+      RETURN_NOT_OK(NextChunk(&chunk, &have_chunk));
+      if (!have_chunk) {
+        break;
+      }
+      auto pending = std::make_shared<PendingBatch>();
+      pending->status = thread_pool_->Submit(
+          [this, chunk, pending]() { return ProcessChunk(chunk, &pending->batch); });
+      pending_.push_back(pending);
+    }
+    if (pending_.empty()) {
+      out->reset();
+      return Status::OK();
+    }
+    // Batches are returned in file order
+    auto pending = pending_.front();
+    pending_.pop_front();
+    RETURN_NOT_OK(pending->status.get());
+    *out = pending->batch;
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+  Chunker chunker_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<Converter>> converters_;
+  std::shared_ptr<RecordBatch> first_batch_;
+  std::deque<std::shared_ptr<PendingBatch>> pending_;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // TableReader factory function
 
@@ -408,6 +750,10 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
                          const ParseOptions& parse_options,
                          const ConvertOptions& convert_options,
                          std::shared_ptr<TableReader>* out) {
+  // Decompression happens in the readahead spooler, overlapping with parsing
+  RETURN_NOT_OK(io::MakeDecompressedInputStream(pool, read_options.compression,
+                                                read_options.use_threads, input,
+                                                &input));
   std::shared_ptr<TableReader> result;
   if (read_options.use_threads) {
     result = std::make_shared<ThreadedTableReader>(
@@ -422,5 +768,22 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   }
 }
 
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             const ConvertOptions& convert_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  RETURN_NOT_OK(io::MakeDecompressedInputStream(pool, read_options.compression,
+                                                read_options.use_threads, input,
+                                                &input));
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto result = std::make_shared<StreamingReaderImpl>(pool, input, thread_pool,
+                                                      read_options, parse_options,
+                                                      convert_options);
+  RETURN_NOT_OK(result->Init());
+  *out = result;
+  return Status::OK();
+}
+
 }  // namespace csv
 }  // namespace arrow
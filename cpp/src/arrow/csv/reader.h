@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -47,6 +48,30 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \class StreamingReader
+/// \brief A reader returning the contents of a CSV file as a stream of record
+/// batches, so that files larger than memory can be processed
+///
+/// One record batch is returned per parsed block of ReadOptions::block_size
+/// bytes.  Column types are inferred from the first block of data, then
+/// fixed: a value in a later block that cannot be converted to the type of
+/// its column is an error.  Use ConvertOptions::column_types to specify the
+/// type of columns the first block is not representative of.
+/// ConvertOptions::auto_dict_encode is ignored, since the dictionary of a
+/// dictionary type would have to be known upfront.
+///
+/// If ReadOptions::use_threads is true, blocks are parsed and converted in
+/// parallel on the global CPU thread pool, with at most one block in flight
+/// per thread; batches are still returned in file order.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&, const ConvertOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
 }  // namespace csv
 }  // namespace arrow
 
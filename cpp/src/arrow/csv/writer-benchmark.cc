@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace csv {
+
+// A table of int64, float64 and string columns
+static std::shared_ptr<Table> BuildTable(int32_t num_rows) {
+  std::vector<int64_t> ints;
+  std::vector<double> doubles;
+  std::vector<std::string> strings;
+  const std::vector<std::string> base_strings = {"foo", "some longer text",
+                                                 "with, delimiter", ""};
+  for (int32_t i = 0; i < num_rows; ++i) {
+    ints.push_back(static_cast<int64_t>(i) * 1000003 - 317005557);
+    doubles.push_back(i * 0.37);
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  std::shared_ptr<Array> int_array, double_array, string_array;
+  ArrayFromVector<Int64Type, int64_t>(ints, &int_array);
+  ArrayFromVector<DoubleType, double>(doubles, &double_array);
+  ArrayFromVector<StringType, std::string>(strings, &string_array);
+  return Table::Make(
+      schema({field("i", int64()), field("d", float64()), field("s", utf8())}),
+      {int_array, double_array, string_array});
+}
+
+static void BenchmarkWriteTable(benchmark::State& state,  // NOLINT non-const reference
+                                bool use_threads) {
+  const int32_t num_rows = 100000;
+  auto table = BuildTable(num_rows);
+  auto write_options = WriteOptions::Defaults();
+  write_options.use_threads = use_threads;
+  auto parse_options = ParseOptions::Defaults();
+
+  int64_t bytes_written = 0;
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::BufferOutputStream> stream;
+    ABORT_NOT_OK(io::BufferOutputStream::Create(1 << 20, default_memory_pool(), &stream));
+    ABORT_NOT_OK(WriteTable(default_memory_pool(), *table, write_options, parse_options,
+                            stream.get()));
+    std::shared_ptr<Buffer> buffer;
+    ABORT_NOT_OK(stream->Finish(&buffer));
+    bytes_written += buffer->size();
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_rows);
+  state.SetBytesProcessed(bytes_written);
+}
+
+static void BM_WriteTableSerial(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkWriteTable(state, false);
+}
+
+static void BM_WriteTableThreaded(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkWriteTable(state, true);
+}
+
+BENCHMARK(BM_WriteTableSerial)->Repetitions(3)->UseRealTime();
+BENCHMARK(BM_WriteTableThreaded)->Repetitions(3)->UseRealTime();
+
+}  // namespace csv
+}  // namespace arrow
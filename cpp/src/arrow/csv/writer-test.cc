@@ -0,0 +1,287 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+static std::shared_ptr<Table> MakeTable(
+    const std::vector<std::shared_ptr<Field>>& fields,
+    const std::vector<std::shared_ptr<Array>>& arrays) {
+  return Table::Make(schema(fields), arrays);
+}
+
+static std::shared_ptr<Array> MakeStrings(const std::vector<std::string>& values) {
+  std::shared_ptr<Array> out;
+  ArrayFromVector<StringType, std::string>(values, &out);
+  return out;
+}
+
+class TestWriter : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() {
+    write_options_ = WriteOptions::Defaults();
+    write_options_.use_threads = GetParam();
+    parse_options_ = ParseOptions::Defaults();
+  }
+
+  Status Write(const Table& table, std::string* out) {
+    std::shared_ptr<io::BufferOutputStream> stream;
+    RETURN_NOT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+    RETURN_NOT_OK(WriteTable(default_memory_pool(), table, write_options_,
+                             parse_options_, stream.get()));
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(stream->Finish(&buffer));
+    *out = buffer->ToString();
+    return Status::OK();
+  }
+
+  void AssertWritten(const Table& table, const std::string& expected) {
+    std::string actual;
+    ASSERT_OK(Write(table, &actual));
+    ASSERT_EQ(actual, expected);
+  }
+
+  void AssertStringsWritten(const std::vector<std::string>& values,
+                            const std::string& expected) {
+    auto table = MakeTable({field("s", utf8())}, {MakeStrings(values)});
+    AssertWritten(*table, expected);
+  }
+
+  void AssertStringsInvalid(const std::vector<std::string>& values) {
+    auto table = MakeTable({field("s", utf8())}, {MakeStrings(values)});
+    std::string actual;
+    ASSERT_RAISES(Invalid, Write(*table, &actual));
+  }
+
+  void ReadBack(const std::string& data, std::shared_ptr<Table>* out,
+                const ConvertOptions& convert_options = ConvertOptions::Defaults()) {
+    auto read_options = ReadOptions::Defaults();
+    read_options.use_threads = false;
+    auto input =
+        std::make_shared<io::BufferReader>(Buffer::FromString(std::string(data)));
+    std::shared_ptr<TableReader> reader;
+    ASSERT_OK(TableReader::Make(default_memory_pool(), input, read_options,
+                                parse_options_, convert_options, &reader));
+    ASSERT_OK(reader->Read(out));
+  }
+
+ protected:
+  WriteOptions write_options_;
+  ParseOptions parse_options_;
+};
+
+TEST_P(TestWriter, Basics) {
+  std::shared_ptr<Array> ints, doubles, strings, bools;
+  ArrayFromVector<Int64Type, int64_t>({true, false, true}, {1, 0, -3}, &ints);
+  ArrayFromVector<DoubleType, double>({1.5, 0.0, -2.25}, &doubles);
+  ArrayFromVector<StringType, std::string>({true, true, false}, {"x", "", ""}, &strings);
+  ArrayFromVector<BooleanType, bool>({true, false, true}, &bools);
+  auto table = MakeTable({field("i", int64()), field("d", float64()),
+                          field("s", utf8()), field("b", boolean())},
+                         {ints, doubles, strings, bools});
+
+  AssertWritten(*table, "i,d,s,b\n1,1.5,x,true\n,0.0,\"\",false\n-3,-2.25,,true\n");
+
+  write_options_.include_header = false;
+  parse_options_.delimiter = ';';
+  AssertWritten(*table, "1;1.5;x;true\n;0.0;\"\";false\n-3;-2.25;;true\n");
+}
+
+TEST_P(TestWriter, Temporal) {
+  std::shared_ptr<Array> dates, timestamps;
+  ArrayFromVector<Date32Type, int32_t>({0, 17849}, &dates);
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::MILLI),
+                                          {1542129070123LL, -1}, &timestamps);
+  auto table =
+      MakeTable({field("d", date32()), field("t", timestamp(TimeUnit::MILLI))},
+                {dates, timestamps});
+
+  AssertWritten(*table,
+                "d,t\n1970-01-01,2018-11-13 17:11:10.123\n"
+                "2018-11-14,1969-12-31 23:59:59.999\n");
+
+  // Formatted values containing the delimiter are quoted
+  parse_options_.delimiter = ' ';
+  AssertWritten(*table,
+                "d t\n1970-01-01 \"2018-11-13 17:11:10.123\"\n"
+                "2018-11-14 \"1969-12-31 23:59:59.999\"\n");
+}
+
+TEST_P(TestWriter, Quoting) {
+  AssertStringsWritten({"a,b", "say \"hi\"", "line\nbreak", "plain", "back\\slash"},
+                       "s\n\"a,b\"\n\"say \"\"hi\"\"\"\n\"line\nbreak\"\nplain\n"
+                       "back\\slash\n");
+
+  // Quotes are escaped if double quoting is disabled
+  parse_options_.double_quote = false;
+  parse_options_.escaping = true;
+  AssertStringsWritten({"a,b", "say \"hi\"", "back\\slash"},
+                       "s\n\"a,b\"\n\"say \\\"hi\\\"\"\n\"back\\\\slash\"\n");
+
+  parse_options_.escaping = false;
+  AssertStringsWritten({"a,b"}, "s\n\"a,b\"\n");
+  AssertStringsInvalid({"say \"hi\""});
+}
+
+TEST_P(TestWriter, Escaping) {
+  parse_options_.quoting = false;
+  parse_options_.escaping = true;
+  AssertStringsWritten({"a,b", "say \"hi\"", "back\\slash", ""},
+                       "s\na\\,b\nsay \"hi\"\nback\\\\slash\n\n");
+
+  parse_options_.escaping = false;
+  AssertStringsWritten({"plain", "say \"hi\""}, "s\nplain\nsay \"hi\"\n");
+  AssertStringsInvalid({"a,b"});
+  AssertStringsInvalid({"line\nbreak"});
+}
+
+TEST_P(TestWriter, Dictionary) {
+  auto dict = MakeStrings({"a", "b,c"});
+  std::shared_ptr<Array> indices;
+  ArrayFromVector<Int8Type, int8_t>({true, true, false, true}, {1, 0, 0, 1}, &indices);
+  auto array = std::make_shared<DictionaryArray>(dictionary(int8(), dict), indices);
+  auto table = MakeTable({field("d", array->type())}, {array});
+
+  // The null is quoted, as it is alone on its line
+  AssertWritten(*table, "d\n\"b,c\"\na\n\"\"\n\"b,c\"\n");
+}
+
+TEST_P(TestWriter, RecordBatch) {
+  std::shared_ptr<Array> ints;
+  ArrayFromVector<Int32Type, int32_t>({1, 2}, &ints);
+  auto batch = RecordBatch::Make(schema({field("x", int32())}), 2, {ints});
+
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+  ASSERT_OK(WriteRecordBatch(default_memory_pool(), *batch, write_options_,
+                             parse_options_, stream.get()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream->Finish(&buffer));
+  ASSERT_EQ(buffer->ToString(), "x\n1\n2\n");
+}
+
+TEST_P(TestWriter, RoundTrip) {
+  std::stringstream ss;
+  ss << "a,b,c\n";
+  for (int32_t i = 0; i < 1000; ++i) {
+    ss << i << ",\"str, " << i << "\"," << i * 0.5 << "\n";
+  }
+  std::shared_ptr<Table> expected, actual;
+  ReadBack(ss.str(), &expected);
+
+  // Many small slices, spanning the table chunks
+  write_options_.batch_size = 7;
+  std::string data;
+  ASSERT_OK(Write(*expected, &data));
+  ReadBack(data, &actual);
+  AssertTablesEqual(*expected, *actual, false /* same_chunk_layout */);
+}
+
+TEST_P(TestWriter, RoundTripTimestamps) {
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  auto convert_options = ConvertOptions::Defaults();
+  const std::vector<std::pair<TimeUnit::type, int64_t>> units_and_values = {
+      {TimeUnit::SECOND, 1542129070LL},
+      {TimeUnit::MILLI, 1542129070123LL},
+      {TimeUnit::MICRO, 1542129070123456LL},
+      {TimeUnit::NANO, 1542129070123456789LL}};
+  for (const auto& unit_and_value : units_and_values) {
+    auto type = timestamp(unit_and_value.first);
+    std::shared_ptr<Array> values;
+    ArrayFromVector<TimestampType, int64_t>(
+        type, {true, false, true}, {unit_and_value.second, 0, -1}, &values);
+    fields.push_back(field("t" + std::to_string(fields.size()), type));
+    columns.push_back(values);
+    convert_options.column_types[fields.back()->name()] = type;
+  }
+  auto expected = MakeTable(fields, columns);
+
+  std::string data;
+  ASSERT_OK(Write(*expected, &data));
+  std::shared_ptr<Table> actual;
+  ReadBack(data, &actual, convert_options);
+  AssertTablesEqual(*expected, *actual);
+
+  // Fractions of second are inferred as nanoseconds
+  auto nanos = MakeTable({fields[3]}, {columns[3]});
+  ASSERT_OK(Write(*nanos, &data));
+  ReadBack(data, &actual);
+  AssertTablesEqual(*nanos, *actual);
+}
+
+TEST_P(TestWriter, RoundTripSingleColumn) {
+  // Empty fields would make empty lines, which the reader skips
+  std::shared_ptr<Array> ints, strings, read_strings;
+  ArrayFromVector<Int64Type, int64_t>({true, false, true}, {1, 0, 3}, &ints);
+  ArrayFromVector<StringType, std::string>({true, true, false}, {"x", "", ""},
+                                           &strings);
+  auto int_table = MakeTable({field("i", int64())}, {ints});
+  AssertWritten(*int_table, "i\n1\nNULL\n3\n");
+  auto string_table = MakeTable({field("s", utf8())}, {strings});
+  AssertWritten(*string_table, "s\nx\n\"\"\n\"\"\n");
+
+  std::string data;
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(Write(*int_table, &data));
+  ReadBack(data, &actual);
+  AssertTablesEqual(*int_table, *actual);
+
+  // The reader has no null strings
+  ASSERT_OK(Write(*string_table, &data));
+  ReadBack(data, &actual);
+  AssertTablesEqual(*MakeTable({field("s", utf8())}, {MakeStrings({"x", "", ""})}),
+                    *actual);
+}
+
+TEST_P(TestWriter, Errors) {
+  std::shared_ptr<Array> half_floats;
+  ArrayFromVector<HalfFloatType, uint16_t>({1}, &half_floats);
+  auto table = MakeTable({field("h", float16())}, {half_floats});
+  std::string data;
+  ASSERT_RAISES(NotImplemented, Write(*table, &data));
+
+  write_options_.batch_size = 0;
+  table = MakeTable({field("s", utf8())}, {MakeStrings({"a"})});
+  ASSERT_RAISES(Invalid, Write(*table, &data));
+}
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestWriter, ::testing::Values(false, true));
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,646 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer-builder.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace csv {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+using internal::StringFormatter;
+using internal::ThreadPool;
+
+namespace {
+
+// All characters the formatters of non-binary types may output, e.g. in
+// "-1.5e-7", "inf", "false", "1.23E+5" or "2018-11-13 17:11:10.123"
+const char kFormattedAlphabet[] = "0123456789+-.: Eeinfatruls";
+
+/////////////////////////////////////////////////////////////////////////
+// Quoting and escaping of field values
+
+class FieldQuoter {
+ public:
+  explicit FieldQuoter(const ParseOptions& options) : options_(options) {
+    std::memset(special_, 0, sizeof(special_));
+    special_[static_cast<uint8_t>(options.delimiter)] = true;
+    special_['\r'] = true;
+    special_['\n'] = true;
+    if (options.quoting) {
+      special_[static_cast<uint8_t>(options.quote_char)] = true;
+    }
+    if (options.escaping) {
+      special_[static_cast<uint8_t>(options.escape_char)] = true;
+    }
+  }
+
+  bool HasSpecial(const uint8_t* data, int64_t length) const {
+    for (int64_t i = 0; i < length; ++i) {
+      if (special_[data[i]]) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool HasSpecial(const char* s) const {
+    return HasSpecial(reinterpret_cast<const uint8_t*>(s), std::strlen(s));
+  }
+
+  // Append a field value, quoted or escaped if it contains special characters
+  Status Append(const uint8_t* data, int64_t length, BufferBuilder* out) const {
+    if (ARROW_PREDICT_TRUE(!HasSpecial(data, length))) {
+      return out->Append(data, length);
+    }
+    return AppendSpecial(data, length, out);
+  }
+
+  // Append an empty non-null value, which is quoted so as to be told apart
+  // from a null value (if quoting is enabled)
+  Status AppendEmpty(BufferBuilder* out) const {
+    if (options_.quoting) {
+      return out->Append(2, static_cast<uint8_t>(options_.quote_char));
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status AppendSpecial(const uint8_t* data, int64_t length, BufferBuilder* out) const {
+    const auto quote_char = static_cast<uint8_t>(options_.quote_char);
+    const auto escape_char = static_cast<uint8_t>(options_.escape_char);
+
+    // At worst, each character is doubled or escaped
+    RETURN_NOT_OK(out->Reserve(2 * length + 2));
+    if (options_.quoting) {
+      out->UnsafeAppend(1, quote_char);
+      for (int64_t i = 0; i < length; ++i) {
+        const uint8_t c = data[i];
+        if (c == quote_char) {
+          if (options_.double_quote) {
+            out->UnsafeAppend(1, quote_char);
+          } else if (options_.escaping) {
+            out->UnsafeAppend(1, escape_char);
+          } else {
+            return Status::Invalid(
+                "CSV value contains the quote character, but neither double_quote "
+                "nor escaping is enabled");
+          }
+        } else if (options_.escaping && c == escape_char) {
+          out->UnsafeAppend(1, escape_char);
+        }
+        out->UnsafeAppend(1, c);
+      }
+      out->UnsafeAppend(1, quote_char);
+    } else if (options_.escaping) {
+      for (int64_t i = 0; i < length; ++i) {
+        const uint8_t c = data[i];
+        if (special_[c]) {
+          out->UnsafeAppend(1, escape_char);
+        }
+        out->UnsafeAppend(1, c);
+      }
+    } else {
+      return Status::Invalid(
+          "CSV value contains special characters, but neither quoting nor "
+          "escaping is enabled");
+    }
+    return Status::OK();
+  }
+
+  const ParseOptions options_;
+  bool special_[256];
+};
+
+/////////////////////////////////////////////////////////////////////////
+// Per-column formatting
+
+// The text of a column slice: field i spans data[offsets[i], offsets[i + 1])
+struct FormattedColumn {
+  explicit FormattedColumn(MemoryPool* pool) : data(pool), offsets(pool) {}
+
+  BufferBuilder data;
+  TypedBufferBuilder<int64_t> offsets;
+};
+
+// Formats the values of a column.  Format() may be called concurrently
+// on several slices of the column.
+class ColumnFormatter {
+ public:
+  explicit ColumnFormatter(const FieldQuoter& quoter) : quoter_(quoter) {}
+  virtual ~ColumnFormatter() = default;
+
+  virtual Status Format(const Array& array, FormattedColumn* out) const = 0;
+
+  static Status Make(const std::shared_ptr<DataType>& type, const FieldQuoter& quoter,
+                     MemoryPool* pool, std::unique_ptr<ColumnFormatter>* out);
+
+ protected:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ColumnFormatter);
+
+  const FieldQuoter& quoter_;
+};
+
+class NullColumnFormatter : public ColumnFormatter {
+ public:
+  NullColumnFormatter(const std::shared_ptr<DataType>& type, const FieldQuoter& quoter)
+      : ColumnFormatter(quoter) {}
+
+  Status Format(const Array& array, FormattedColumn* out) const override {
+    RETURN_NOT_OK(out->offsets.Reserve(array.length() + 1));
+    out->offsets.UnsafeAppend(array.length() + 1, out->data.length());
+    return Status::OK();
+  }
+};
+
+// Numbers, booleans and temporal values, formatted with StringFormatter
+template <typename ARROW_TYPE>
+class PrimitiveColumnFormatter : public ColumnFormatter {
+ public:
+  using ArrayType = typename TypeTraits<ARROW_TYPE>::ArrayType;
+  using FormatterType = StringFormatter<ARROW_TYPE>;
+
+  PrimitiveColumnFormatter(const std::shared_ptr<DataType>& type,
+                           const FieldQuoter& quoter)
+      : ColumnFormatter(quoter),
+        formatter_(type),
+        check_special_(quoter.HasSpecial(kFormattedAlphabet)) {}
+
+  Status Format(const Array& array, FormattedColumn* out) const override {
+    const auto& values = checked_cast<const ArrayType&>(array);
+    const int64_t length = values.length();
+    char buffer[FormatterType::kMaxLength];
+
+    RETURN_NOT_OK(out->offsets.Reserve(length + 1));
+    RETURN_NOT_OK(out->data.Reserve(length * FormatterType::kMaxLength));
+    out->offsets.UnsafeAppend(out->data.length());
+    for (int64_t i = 0; i < length; ++i) {
+      if (values.IsValid(i)) {
+        const int32_t n = formatter_(values.Value(i), buffer);
+        if (ARROW_PREDICT_FALSE(check_special_)) {
+          // The delimiter or quote character may be a digit, a letter...
+          RETURN_NOT_OK(
+              quoter_.Append(reinterpret_cast<const uint8_t*>(buffer), n, &out->data));
+        } else {
+          out->data.UnsafeAppend(buffer, n);
+        }
+      }
+      out->offsets.UnsafeAppend(out->data.length());
+    }
+    return Status::OK();
+  }
+
+ protected:
+  const FormatterType formatter_;
+  const bool check_special_;
+};
+
+class BinaryColumnFormatter : public ColumnFormatter {
+ public:
+  BinaryColumnFormatter(const std::shared_ptr<DataType>& type, const FieldQuoter& quoter)
+      : ColumnFormatter(quoter) {}
+
+  Status Format(const Array& array, FormattedColumn* out) const override {
+    const auto& values = checked_cast<const BinaryArray&>(array);
+    const int64_t length = values.length();
+
+    RETURN_NOT_OK(out->offsets.Reserve(length + 1));
+    // Most values shouldn't need quoting
+    RETURN_NOT_OK(
+        out->data.Reserve(values.value_offset(length) - values.value_offset(0)));
+    out->offsets.UnsafeAppend(out->data.length());
+    for (int64_t i = 0; i < length; ++i) {
+      if (values.IsValid(i)) {
+        int32_t value_length;
+        const uint8_t* value = values.GetValue(i, &value_length);
+        if (value_length == 0) {
+          RETURN_NOT_OK(quoter_.AppendEmpty(&out->data));
+        } else {
+          RETURN_NOT_OK(quoter_.Append(value, value_length, &out->data));
+        }
+      }
+      out->offsets.UnsafeAppend(out->data.length());
+    }
+    return Status::OK();
+  }
+};
+
+class FixedSizeBinaryColumnFormatter : public ColumnFormatter {
+ public:
+  FixedSizeBinaryColumnFormatter(const std::shared_ptr<DataType>& type,
+                                 const FieldQuoter& quoter)
+      : ColumnFormatter(quoter) {}
+
+  Status Format(const Array& array, FormattedColumn* out) const override {
+    const auto& values = checked_cast<const FixedSizeBinaryArray&>(array);
+    const int64_t length = values.length();
+    const int32_t byte_width = values.byte_width();
+
+    RETURN_NOT_OK(out->offsets.Reserve(length + 1));
+    out->offsets.UnsafeAppend(out->data.length());
+    for (int64_t i = 0; i < length; ++i) {
+      if (values.IsValid(i)) {
+        if (byte_width == 0) {
+          RETURN_NOT_OK(quoter_.AppendEmpty(&out->data));
+        } else {
+          RETURN_NOT_OK(quoter_.Append(values.GetValue(i), byte_width, &out->data));
+        }
+      }
+      out->offsets.UnsafeAppend(out->data.length());
+    }
+    return Status::OK();
+  }
+};
+
+class DecimalColumnFormatter : public ColumnFormatter {
+ public:
+  DecimalColumnFormatter(const std::shared_ptr<DataType>& type, const FieldQuoter& quoter)
+      : ColumnFormatter(quoter), check_special_(quoter.HasSpecial(kFormattedAlphabet)) {}
+
+  Status Format(const Array& array, FormattedColumn* out) const override {
+    const auto& values = checked_cast<const Decimal128Array&>(array);
+    const int64_t length = values.length();
+
+    RETURN_NOT_OK(out->offsets.Reserve(length + 1));
+    out->offsets.UnsafeAppend(out->data.length());
+    for (int64_t i = 0; i < length; ++i) {
+      if (values.IsValid(i)) {
+        const std::string value = values.FormatValue(i);
+        const auto data = reinterpret_cast<const uint8_t*>(value.data());
+        if (ARROW_PREDICT_FALSE(check_special_)) {
+          RETURN_NOT_OK(quoter_.Append(data, value.length(), &out->data));
+        } else {
+          RETURN_NOT_OK(out->data.Append(data, value.length()));
+        }
+      }
+      out->offsets.UnsafeAppend(out->data.length());
+    }
+    return Status::OK();
+  }
+
+ protected:
+  const bool check_special_;
+};
+
+// Dictionary values are formatted once, then copied for each index
+class DictionaryColumnFormatter : public ColumnFormatter {
+ public:
+  DictionaryColumnFormatter(const FieldQuoter& quoter,
+                            std::unique_ptr<FormattedColumn> dictionary)
+      : ColumnFormatter(quoter), dictionary_(std::move(dictionary)) {}
+
+  Status Format(const Array& array, FormattedColumn* out) const override {
+    const auto& indices = *checked_cast<const DictionaryArray&>(array).indices();
+    switch (indices.type_id()) {
+      case Type::INT8:
+        return FormatIndices<Int8Type>(indices, out);
+      case Type::INT16:
+        return FormatIndices<Int16Type>(indices, out);
+      case Type::INT32:
+        return FormatIndices<Int32Type>(indices, out);
+      case Type::INT64:
+        return FormatIndices<Int64Type>(indices, out);
+      default:
+        return Status::NotImplemented("CSV writing of dictionary indices of type ",
+                                      indices.type()->ToString());
+    }
+  }
+
+  static Status Make(const std::shared_ptr<DataType>& type, const FieldQuoter& quoter,
+                     MemoryPool* pool, std::unique_ptr<ColumnFormatter>* out) {
+    const auto& dict = checked_cast<const DictionaryType&>(*type).dictionary();
+    std::unique_ptr<ColumnFormatter> value_formatter;
+    RETURN_NOT_OK(ColumnFormatter::Make(dict->type(), quoter, pool, &value_formatter));
+    std::unique_ptr<FormattedColumn> dictionary(new FormattedColumn(pool));
+    RETURN_NOT_OK(value_formatter->Format(*dict, dictionary.get()));
+    out->reset(new DictionaryColumnFormatter(quoter, std::move(dictionary)));
+    return Status::OK();
+  }
+
+ protected:
+  template <typename IndexType>
+  Status FormatIndices(const Array& array, FormattedColumn* out) const {
+    const auto& indices = checked_cast<const NumericArray<IndexType>&>(array);
+    const int64_t length = indices.length();
+    const uint8_t* dict_data = dictionary_->data.data();
+    const int64_t* dict_offsets = dictionary_->offsets.data();
+
+    RETURN_NOT_OK(out->offsets.Reserve(length + 1));
+    out->offsets.UnsafeAppend(out->data.length());
+    for (int64_t i = 0; i < length; ++i) {
+      if (indices.IsValid(i)) {
+        const auto index = indices.Value(i);
+        RETURN_NOT_OK(out->data.Append(dict_data + dict_offsets[index],
+                                       dict_offsets[index + 1] - dict_offsets[index]));
+      }
+      out->offsets.UnsafeAppend(out->data.length());
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<FormattedColumn> dictionary_;
+};
+
+Status ColumnFormatter::Make(const std::shared_ptr<DataType>& type,
+                             const FieldQuoter& quoter, MemoryPool* pool,
+                             std::unique_ptr<ColumnFormatter>* out) {
+  ColumnFormatter* result;
+
+  switch (type->id()) {
+#define FORMATTER_CASE(TYPE_ID, FORMATTER_TYPE) \
+  case TYPE_ID:                                 \
+    result = new FORMATTER_TYPE(type, quoter);  \
+    break;
+
+    FORMATTER_CASE(Type::NA, NullColumnFormatter)
+    FORMATTER_CASE(Type::INT8, PrimitiveColumnFormatter<Int8Type>)
+    FORMATTER_CASE(Type::INT16, PrimitiveColumnFormatter<Int16Type>)
+    FORMATTER_CASE(Type::INT32, PrimitiveColumnFormatter<Int32Type>)
+    FORMATTER_CASE(Type::INT64, PrimitiveColumnFormatter<Int64Type>)
+    FORMATTER_CASE(Type::UINT8, PrimitiveColumnFormatter<UInt8Type>)
+    FORMATTER_CASE(Type::UINT16, PrimitiveColumnFormatter<UInt16Type>)
+    FORMATTER_CASE(Type::UINT32, PrimitiveColumnFormatter<UInt32Type>)
+    FORMATTER_CASE(Type::UINT64, PrimitiveColumnFormatter<UInt64Type>)
+    FORMATTER_CASE(Type::FLOAT, PrimitiveColumnFormatter<FloatType>)
+    FORMATTER_CASE(Type::DOUBLE, PrimitiveColumnFormatter<DoubleType>)
+    FORMATTER_CASE(Type::BOOL, PrimitiveColumnFormatter<BooleanType>)
+    FORMATTER_CASE(Type::DATE32, PrimitiveColumnFormatter<Date32Type>)
+    FORMATTER_CASE(Type::DATE64, PrimitiveColumnFormatter<Date64Type>)
+    FORMATTER_CASE(Type::TIMESTAMP, PrimitiveColumnFormatter<TimestampType>)
+    FORMATTER_CASE(Type::BINARY, BinaryColumnFormatter)
+    FORMATTER_CASE(Type::STRING, BinaryColumnFormatter)
+    FORMATTER_CASE(Type::FIXED_SIZE_BINARY, FixedSizeBinaryColumnFormatter)
+    FORMATTER_CASE(Type::DECIMAL, DecimalColumnFormatter)
+
+    case Type::DICTIONARY:
+      return DictionaryColumnFormatter::Make(type, quoter, pool, out);
+
+    default: {
+      return Status::NotImplemented("CSV writing of ", type->ToString(),
+                                    " is not supported");
+    }
+
+#undef FORMATTER_CASE
+  }
+  out->reset(result);
+  return Status::OK();
+}
+
+/////////////////////////////////////////////////////////////////////////
+// Writer implementation
+
+class CSVWriter {
+ public:
+  CSVWriter(MemoryPool* pool, ThreadPool* thread_pool, const WriteOptions& write_options,
+            const ParseOptions& parse_options, io::OutputStream* output)
+      : pool_(pool),
+        thread_pool_(thread_pool),
+        write_options_(write_options),
+        parse_options_(parse_options),
+        quoter_(parse_options),
+        output_(output) {}
+
+  Status Write(const Table& table) {
+    if (write_options_.batch_size <= 0) {
+      return Status::Invalid("WriteOptions::batch_size must be positive");
+    }
+    const Schema& schema = *table.schema();
+    if (schema.num_fields() == 0) {
+      return Status::OK();
+    }
+    formatters_.resize(schema.num_fields());
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      Status st = ColumnFormatter::Make(schema.field(i)->type(), quoter_, pool_,
+                                        &formatters_[i]);
+      if (!st.ok()) {
+        return Status(st.code(),
+                      "In column '" + schema.field(i)->name() + "': " + st.message());
+      }
+    }
+    if (schema.num_fields() == 1) {
+      single_column_empty_row_ = EmptyRowValue(*schema.field(0)->type());
+    }
+    if (write_options_.include_header) {
+      RETURN_NOT_OK(WriteHeader(schema));
+    }
+
+    TableBatchReader reader(table);
+    reader.set_chunksize(write_options_.batch_size);
+    if (thread_pool_ != nullptr) {
+      return WriteThreaded(&reader);
+    } else {
+      return WriteSerial(&reader);
+    }
+  }
+
+ protected:
+  // A slice submitted to the thread pool
+  struct PendingSlice {
+    std::future<Status> status;
+    std::shared_ptr<Buffer> text;
+  };
+
+  // With a single column, an empty field would make an empty line, which
+  // readers skip.  Return what to write instead: a pair of quotes for string
+  // and binary values, one of the reader's default null values otherwise.
+  std::string EmptyRowValue(const DataType& type) const {
+    const DataType& value_type =
+        type.id() == Type::DICTIONARY
+            ? *checked_cast<const DictionaryType&>(type).dictionary()->type()
+            : type;
+    if (value_type.id() == Type::STRING || value_type.id() == Type::BINARY) {
+      return parse_options_.quoting ? std::string(2, parse_options_.quote_char) : "";
+    }
+    return "NULL";
+  }
+
+  Status WriteHeader(const Schema& schema) {
+    BufferBuilder header(pool_);
+    for (const auto& field : schema.fields()) {
+      const std::string& name = field->name();
+      if (name.empty()) {
+        RETURN_NOT_OK(quoter_.AppendEmpty(&header));
+      } else {
+        RETURN_NOT_OK(quoter_.Append(reinterpret_cast<const uint8_t*>(name.data()),
+                                     name.length(), &header));
+      }
+      RETURN_NOT_OK(header.Append(1, static_cast<uint8_t>(parse_options_.delimiter)));
+    }
+    header.mutable_data()[header.length() - 1] = '\n';
+    return output_->Write(header.data(), header.length());
+  }
+
+  // Format a slice of rows into a single buffer, one column at a time
+  Status FormatSlice(const RecordBatch& batch, std::shared_ptr<Buffer>* out) const {
+    const int num_columns = batch.num_columns();
+    const int64_t num_rows = batch.num_rows();
+
+    std::vector<std::unique_ptr<FormattedColumn>> columns(num_columns);
+    std::vector<const uint8_t*> column_data(num_columns);
+    std::vector<const int64_t*> column_offsets(num_columns);
+    // One delimiter or line separator per field
+    int64_t total_size = num_rows * num_columns;
+    for (int i = 0; i < num_columns; ++i) {
+      columns[i].reset(new FormattedColumn(pool_));
+      RETURN_NOT_OK(formatters_[i]->Format(*batch.column(i), columns[i].get()));
+      column_data[i] = columns[i]->data.data();
+      column_offsets[i] = columns[i]->offsets.data();
+      total_size += columns[i]->data.length();
+    }
+
+    if (num_columns == 1 && !single_column_empty_row_.empty()) {
+      for (int64_t row = 0; row < num_rows; ++row) {
+        if (column_offsets[0][row + 1] == column_offsets[0][row]) {
+          total_size += static_cast<int64_t>(single_column_empty_row_.size());
+        }
+      }
+    }
+
+    // Assemble rows
+    std::shared_ptr<Buffer> text;
+    RETURN_NOT_OK(AllocateBuffer(pool_, total_size, &text));
+    uint8_t* p = text->mutable_data();
+    const auto delimiter = static_cast<uint8_t>(parse_options_.delimiter);
+    for (int64_t row = 0; row < num_rows; ++row) {
+      for (int i = 0; i < num_columns; ++i) {
+        const int64_t start = column_offsets[i][row];
+        const int64_t length = column_offsets[i][row + 1] - start;
+        std::memcpy(p, column_data[i] + start, static_cast<size_t>(length));
+        p += length;
+        if (ARROW_PREDICT_FALSE(length == 0) && num_columns == 1) {
+          std::memcpy(p, single_column_empty_row_.data(),
+                      single_column_empty_row_.size());
+          p += single_column_empty_row_.size();
+        }
+        *p++ = delimiter;
+      }
+      p[-1] = '\n';
+    }
+    DCHECK_EQ(p - text->data(), total_size);
+    *out = text;
+    return Status::OK();
+  }
+
+  Status WriteSerial(RecordBatchReader* reader) {
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (!batch) {
+        return Status::OK();
+      }
+      std::shared_ptr<Buffer> text;
+      RETURN_NOT_OK(FormatSlice(*batch, &text));
+      RETURN_NOT_OK(output_->Write(text->data(), text->size()));
+    }
+  }
+
+  Status WriteThreaded(RecordBatchReader* reader) {
+    std::deque<std::shared_ptr<PendingSlice>> pending;
+    Status st = WriteThreaded(reader, &pending);
+    // On error, wait for the outstanding tasks as they refer to this writer
+    for (const auto& slice : pending) {
+      slice->status.wait();
+    }
+    return st;
+  }
+
+  Status WriteThreaded(RecordBatchReader* reader,
+                       std::deque<std::shared_ptr<PendingSlice>>* pending) {
+    // Keep one slice in flight per worker thread, which bounds memory use
+    const size_t capacity = static_cast<size_t>(thread_pool_->GetCapacity());
+    bool eof = false;
+    while (true) {
+      while (!eof && pending->size() < capacity) {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(reader->ReadNext(&batch));
+        if (!batch) {
+          eof = true;
+          break;
+        }
+        auto slice = std::make_shared<PendingSlice>();
+        slice->status = thread_pool_->Submit(
+            [this, batch, slice]() { return FormatSlice(*batch, &slice->text); });
+        pending->push_back(slice);
+      }
+      if (pending->empty()) {
+        return Status::OK();
+      }
+      // Slices are written in order
+      auto slice = pending->front();
+      pending->pop_front();
+      RETURN_NOT_OK(slice->status.get());
+      RETURN_NOT_OK(output_->Write(slice->text->data(), slice->text->size()));
+    }
+  }
+
+  MemoryPool* pool_;
+  ThreadPool* thread_pool_;
+  const WriteOptions write_options_;
+  const ParseOptions parse_options_;
+  const FieldQuoter quoter_;
+  io::OutputStream* output_;
+  std::vector<std::unique_ptr<ColumnFormatter>> formatters_;
+  std::string single_column_empty_row_;
+};
+
+}  // namespace
+
+Status WriteTable(MemoryPool* pool, const Table& table, const WriteOptions& write_options,
+                  const ParseOptions& parse_options, io::OutputStream* output) {
+  ThreadPool* thread_pool = write_options.use_threads ? GetCpuThreadPool() : nullptr;
+  CSVWriter writer(pool, thread_pool, write_options, parse_options, output);
+  return writer.Write(table);
+}
+
+Status WriteRecordBatch(MemoryPool* pool, const RecordBatch& batch,
+                        const WriteOptions& write_options,
+                        const ParseOptions& parse_options, io::OutputStream* output) {
+  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns[i] = batch.column(i);
+  }
+  auto table = Table::Make(batch.schema(), columns, batch.num_rows());
+  return WriteTable(pool, *table, write_options, parse_options, output);
+}
+
+}  // namespace csv
+}  // namespace arrow
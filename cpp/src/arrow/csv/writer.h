@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_WRITER_H
+#define ARROW_CSV_WRITER_H
+
+#include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+class RecordBatch;
+class Table;
+
+namespace io {
+class OutputStream;
+}  // namespace io
+
+namespace csv {
+
+/// \brief Write a table as CSV
+///
+/// Rows are formatted in slices of at most WriteOptions::batch_size rows,
+/// one column at a time.  If WriteOptions::use_threads is true, slices are
+/// formatted in parallel on the global CPU thread pool; they are still
+/// written to `output` in order.
+///
+/// The delimiter, quoting and escaping settings of `parse_options` are
+/// honored, so that the output can be read back with the same options.
+/// Values containing special characters (the delimiter, CR, LF, or the
+/// quoting or escaping character) are quoted if ParseOptions::quoting is
+/// true, escaped otherwise; if neither is enabled, writing them is an error.
+/// Reading back values containing CR or LF requires
+/// ParseOptions::newlines_in_values.
+///
+/// Null values are written as empty fields, and empty strings as a pair of
+/// quotes if quoting is enabled.  In a table with a single column, where an
+/// empty field would make an empty line that readers skip, nulls are written
+/// as "NULL", except in string and binary columns which are written as a pair
+/// of quotes like empty values (if quoting is enabled).  Dictionary-encoded
+/// columns are written as their decoded values.
+///
+/// Timestamps are written as "YYYY-MM-DD hh:mm:ss", followed by the fraction
+/// of second for units smaller than the second.
+ARROW_EXPORT
+Status WriteTable(MemoryPool* pool, const Table& table, const WriteOptions& write_options,
+                  const ParseOptions& parse_options, io::OutputStream* output);
+
+/// \brief Write a record batch as CSV
+///
+/// \see WriteTable
+ARROW_EXPORT
+Status WriteRecordBatch(MemoryPool* pool, const RecordBatch& batch,
+                        const WriteOptions& write_options,
+                        const ParseOptions& parse_options, io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_WRITER_H
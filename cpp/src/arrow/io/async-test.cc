@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/async.h"
+#include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/test-common.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace io {
+
+static std::string MakeData(int64_t size) {
+  std::string data(static_cast<size_t>(size), '\0');
+  for (int64_t i = 0; i < size; ++i) {
+    data[i] = static_cast<char>('a' + i * 7 % 26);
+  }
+  return data;
+}
+
+static void AssertRangesRead(AsyncRandomAccessFile* file, const std::string& data) {
+  const int64_t size = static_cast<int64_t>(data.size());
+  std::vector<ReadRange> ranges = {
+      {0, 10}, {size - 100, 100}, {5, 0}, {1000, 4096}, {size - 10, 50}, {size, 10}};
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::vector<std::future<Status>> futures;
+  ASSERT_OK(file->ReadAsync(ranges, &buffers, &futures));
+  ASSERT_EQ(futures.size(), ranges.size());
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (auto& future : futures) {
+    ASSERT_OK(future.get());
+  }
+
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const int64_t offset = ranges[i].offset;
+    const int64_t expected_length = std::min(ranges[i].length, size - offset);
+    ASSERT_EQ(buffers[i]->size(), expected_length) << "range " << i;
+    ASSERT_EQ(buffers[i]->ToString(), data.substr(offset, expected_length));
+  }
+
+  // Blocking variant
+  ASSERT_OK(file->ReadAt({{20, 30}, {size - 1, 1}}, &buffers));
+  ASSERT_EQ(buffers.size(), 2);
+  ASSERT_EQ(buffers[0]->ToString(), data.substr(20, 30));
+  ASSERT_EQ(buffers[1]->ToString(), data.substr(size - 1, 1));
+
+  int64_t file_size;
+  ASSERT_OK(file->GetSize(&file_size));
+  ASSERT_EQ(file_size, size);
+}
+
+TEST(TestAsyncRandomAccessFile, FromBufferReader) {
+  std::string data = MakeData(10000);
+  auto reader = std::make_shared<BufferReader>(std::make_shared<Buffer>(data));
+
+  std::shared_ptr<AsyncRandomAccessFile> file;
+  ASSERT_OK(AsyncRandomAccessFile::Make(reader, &file));
+  ASSERT_EQ(file->backend(), "threadpool");
+  AssertRangesRead(file.get(), data);
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::vector<std::future<Status>> futures;
+  ASSERT_RAISES(Invalid, file->ReadAsync({{0, 10}, {-1, 10}}, &buffers, &futures));
+  ASSERT_RAISES(Invalid, file->ReadAsync({{0, -10}}, &buffers, &futures));
+  ASSERT_EQ(futures.size(), 0);
+
+  ASSERT_OK(file->Close());
+  ASSERT_TRUE(reader->closed());
+}
+
+class TestAsyncLocalFile : public ::testing::Test {
+ public:
+  void SetUp() override {
+    path_ = "arrow-test-io-async-file.txt";
+    EnsureFileDeleted();
+  }
+
+  void TearDown() override { EnsureFileDeleted(); }
+
+  void EnsureFileDeleted() {
+    if (FileExists(path_)) {
+      ARROW_UNUSED(std::remove(path_.c_str()));
+    }
+  }
+
+  void WriteData(const std::string& data) {
+    std::shared_ptr<FileOutputStream> stream;
+    ASSERT_OK(FileOutputStream::Open(path_, &stream));
+    ASSERT_OK(stream->Write(data.data(), static_cast<int64_t>(data.size())));
+    ASSERT_OK(stream->Close());
+  }
+
+ protected:
+  std::string path_;
+};
+
+TEST_F(TestAsyncLocalFile, ReadRanges) {
+  std::string data = MakeData(100000);
+  WriteData(data);
+
+  std::shared_ptr<AsyncRandomAccessFile> file;
+  ASSERT_OK(AsyncRandomAccessFile::Open(path_, default_memory_pool(), &file));
+  ASSERT_TRUE(file->backend() == "io_uring" || file->backend() == "threadpool");
+  AssertRangesRead(file.get(), data);
+  ASSERT_OK(file->Close());
+}
+
+TEST_F(TestAsyncLocalFile, ManyReadsInFlight) {
+  // More reads than the io_uring queue depth
+  const int64_t kChunkSize = 64;
+  const int kNumChunks = 1000;
+  std::string data = MakeData(kChunkSize * kNumChunks);
+  WriteData(data);
+
+  std::shared_ptr<AsyncRandomAccessFile> file;
+  ASSERT_OK(AsyncRandomAccessFile::Open(path_, default_memory_pool(), &file));
+
+  std::vector<ReadRange> ranges;
+  for (int i = kNumChunks - 1; i >= 0; --i) {
+    ranges.push_back({i * kChunkSize, kChunkSize});
+  }
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file->ReadAt(ranges, &buffers));
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_EQ(buffers[i]->ToString(), data.substr(ranges[i].offset, kChunkSize));
+  }
+  ASSERT_OK(file->Close());
+}
+
+TEST_F(TestAsyncLocalFile, OpenNonexistent) {
+  std::shared_ptr<AsyncRandomAccessFile> file;
+  ASSERT_RAISES(IOError,
+                AsyncRandomAccessFile::Open(path_, default_memory_pool(), &file));
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,400 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/async.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#if defined(ARROW_WITH_IO_URING) && defined(__linux__)
+#define ARROW_IO_URING_ENABLED
+#include <liburing.h>
+#include <thread>
+#include <unordered_set>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/status.h"
+#include "arrow/util/io-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace io {
+
+AsyncRandomAccessFile::~AsyncRandomAccessFile() {}
+
+Status AsyncRandomAccessFile::ReadAt(const std::vector<ReadRange>& ranges,
+                                     std::vector<std::shared_ptr<Buffer>>* buffers) {
+  std::vector<std::future<Status>> futures;
+  RETURN_NOT_OK(ReadAsync(ranges, buffers, &futures));
+
+  // Wait for all reads, as they write into buffers, even if one fails
+  Status st;
+  for (auto& future : futures) {
+    Status read_st = future.get();
+    if (st.ok() && !read_st.ok()) {
+      st = read_st;
+    }
+  }
+  return st;
+}
+
+static Status ValidateRanges(const std::vector<ReadRange>& ranges) {
+  for (const auto& range : ranges) {
+    if (range.offset < 0 || range.length < 0) {
+      return Status::Invalid("Invalid read range: offset ", range.offset, ", length ",
+                             range.length);
+    }
+  }
+  return Status::OK();
+}
+
+// Tracks the reads in flight so that Close() can wait for them
+class InFlightCounter {
+ public:
+  InFlightCounter() : count_(0) {}
+
+  void Add(int64_t n) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    count_ += n;
+  }
+
+  void Done() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--count_ == 0) {
+      cv_.notify_all();
+    }
+  }
+
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return count_ == 0; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  int64_t count_;
+};
+
+// ----------------------------------------------------------------------
+// Thread pool implementation: blocking ReadAt calls on the I/O thread pool
+
+class ThreadPoolAsyncFile : public AsyncRandomAccessFile {
+ public:
+  explicit ThreadPoolAsyncFile(const std::shared_ptr<RandomAccessFile>& file)
+      : file_(file), in_flight_(std::make_shared<InFlightCounter>()) {}
+
+  ~ThreadPoolAsyncFile() override { in_flight_->Wait(); }
+
+  Status ReadAsync(const std::vector<ReadRange>& ranges,
+                   std::vector<std::shared_ptr<Buffer>>* buffers,
+                   std::vector<std::future<Status>>* futures) override {
+    RETURN_NOT_OK(ValidateRanges(ranges));
+    buffers->assign(ranges.size(), nullptr);
+    futures->clear();
+    futures->reserve(ranges.size());
+
+    auto pool = ::arrow::internal::GetIOThreadPool();
+    std::shared_ptr<RandomAccessFile> file = file_;
+    std::shared_ptr<InFlightCounter> in_flight = in_flight_;
+    in_flight->Add(static_cast<int64_t>(ranges.size()));
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      const ReadRange range = ranges[i];
+      std::shared_ptr<Buffer>* out = &(*buffers)[i];
+      futures->push_back(pool->Submit([file, in_flight, range, out]() {
+        Status st = file->ReadAt(range.offset, range.length, out);
+        in_flight->Done();
+        return st;
+      }));
+    }
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) override { return file_->GetSize(size); }
+
+  Status Close() override {
+    in_flight_->Wait();
+    return file_->Close();
+  }
+
+  std::string backend() const override { return "threadpool"; }
+
+ private:
+  std::shared_ptr<RandomAccessFile> file_;
+  std::shared_ptr<InFlightCounter> in_flight_;
+};
+
+// ----------------------------------------------------------------------
+// io_uring implementation: all reads of a batch are queued to the kernel with
+// a single system call, and a single thread reaps completions
+
+#ifdef ARROW_IO_URING_ENABLED
+
+class IoUringAsyncFile : public AsyncRandomAccessFile {
+ public:
+  // Maximum number of reads in flight
+  static constexpr unsigned kQueueDepth = 256;
+  // Larger ranges are read with several requests
+  static constexpr int64_t kMaxRequestSize = 1 << 30;
+
+  static Status Open(const std::string& path, MemoryPool* pool,
+                     std::shared_ptr<IoUringAsyncFile>* out) {
+    std::shared_ptr<IoUringAsyncFile> file(new IoUringAsyncFile(pool));
+    RETURN_NOT_OK(file->OpenFile(path));
+    *out = file;
+    return Status::OK();
+  }
+
+  ~IoUringAsyncFile() override {
+    Status st = Close();
+    if (!st.ok()) {
+      ARROW_LOG(WARNING) << "Failed to close file: " << st.ToString();
+    }
+  }
+
+  Status ReadAsync(const std::vector<ReadRange>& ranges,
+                   std::vector<std::shared_ptr<Buffer>>* buffers,
+                   std::vector<std::future<Status>>* futures) override {
+    RETURN_NOT_OK(ValidateRanges(ranges));
+    buffers->assign(ranges.size(), nullptr);
+    futures->clear();
+    futures->reserve(ranges.size());
+
+    std::vector<std::unique_ptr<Request>> requests;
+    requests.reserve(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      std::unique_ptr<Request> request(new Request());
+      request->offset = ranges[i].offset;
+      request->length = ranges[i].length;
+      request->done = 0;
+      Status st = AllocateResizableBuffer(pool_, ranges[i].length, &request->buffer);
+      if (!st.ok()) {
+        // Nothing was submitted, so no futures are returned
+        futures->clear();
+        buffers->clear();
+        return st;
+      }
+      (*buffers)[i] = request->buffer;
+      futures->push_back(request->promise.get_future());
+      requests.push_back(std::move(request));
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!is_open_) {
+      futures->clear();
+      buffers->clear();
+      return Status::Invalid("Operation on closed file");
+    }
+    for (auto& request : requests) {
+      if (request->length == 0) {
+        request->promise.set_value(Status::OK());
+        continue;
+      }
+      // Bound the reads in flight by the depth of the completion queue
+      if (pending_.size() >= kQueueDepth) {
+        SubmitUnlocked();
+        cv_.wait(lock, [this] { return pending_.size() < kQueueDepth; });
+      }
+      Request* raw_request = request.release();
+      pending_.insert(raw_request);
+      QueueUnlocked(raw_request);
+    }
+    SubmitUnlocked();
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) override {
+    return ::arrow::internal::FileGetSize(fd_, size);
+  }
+
+  Status Close() override {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!is_open_) {
+        return Status::OK();
+      }
+      cv_.wait(lock, [this] { return pending_.empty(); });
+      is_open_ = false;
+
+      // A request without data tells the completion thread to stop
+      struct io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+      io_uring_prep_nop(sqe);
+      io_uring_sqe_set_data(sqe, nullptr);
+      io_uring_submit(&ring_);
+    }
+    completion_thread_.join();
+    io_uring_queue_exit(&ring_);
+    return ::arrow::internal::FileClose(fd_);
+  }
+
+  std::string backend() const override { return "io_uring"; }
+
+ private:
+  struct Request {
+    int64_t offset;
+    int64_t length;
+    int64_t done;
+    std::shared_ptr<ResizableBuffer> buffer;
+    std::promise<Status> promise;
+  };
+
+  explicit IoUringAsyncFile(MemoryPool* pool) : pool_(pool), fd_(-1), is_open_(false) {}
+
+  Status OpenFile(const std::string& path) {
+    ::arrow::internal::PlatformFilename file_name;
+    RETURN_NOT_OK(::arrow::internal::FileNameFromString(path, &file_name));
+    RETURN_NOT_OK(::arrow::internal::FileOpenReadable(file_name, &fd_));
+
+    int ret = io_uring_queue_init(kQueueDepth, &ring_, 0);
+    if (ret < 0) {
+      ARROW_UNUSED(::arrow::internal::FileClose(fd_));
+      return Status::IOError("io_uring unavailable: ", std::strerror(-ret));
+    }
+    is_open_ = true;
+    completion_thread_ = std::thread([this] { CompletionLoop(); });
+    return Status::OK();
+  }
+
+  // Queue the remainder of a request; submission happens separately
+  void QueueUnlocked(Request* request) {
+    struct io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+    if (sqe == nullptr) {
+      // Submission queue full: hand the queued entries to the kernel
+      SubmitUnlocked();
+      sqe = io_uring_get_sqe(&ring_);
+      DCHECK(sqe != nullptr);
+    }
+    const int64_t nbytes = std::min(request->length - request->done, kMaxRequestSize);
+    io_uring_prep_read(sqe, fd_, request->buffer->mutable_data() + request->done,
+                       static_cast<unsigned>(nbytes), request->offset + request->done);
+    io_uring_sqe_set_data(sqe, request);
+  }
+
+  void SubmitUnlocked() {
+    int ret;
+    do {
+      ret = io_uring_submit(&ring_);
+    } while (ret == -EINTR || ret == -EAGAIN);
+    if (ret < 0) {
+      FailAllUnlocked(
+          Status::IOError("io_uring submission failed: ", std::strerror(-ret)));
+    }
+  }
+
+  void FinishUnlocked(Request* request, const Status& st) {
+    Status result = st;
+    if (result.ok() && request->done < request->length) {
+      // Short read at the end of the file
+      result = request->buffer->Resize(request->done, false);
+    }
+    pending_.erase(request);
+    request->promise.set_value(result);
+    delete request;
+    cv_.notify_all();
+  }
+
+  void FailAllUnlocked(const Status& st) {
+    while (!pending_.empty()) {
+      FinishUnlocked(*pending_.begin(), st);
+    }
+  }
+
+  void CompletionLoop() {
+    while (true) {
+      struct io_uring_cqe* cqe;
+      int ret = io_uring_wait_cqe(&ring_, &cqe);
+      if (ret == -EINTR) {
+        continue;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (ret < 0) {
+        FailAllUnlocked(Status::IOError("io_uring wait failed: ", std::strerror(-ret)));
+        return;
+      }
+      auto request = static_cast<Request*>(io_uring_cqe_get_data(cqe));
+      const int res = cqe->res;
+      io_uring_cqe_seen(&ring_, cqe);
+
+      if (request == nullptr) {
+        // Close() was called
+        return;
+      }
+      if (res == -EINTR || res == -EAGAIN) {
+        QueueUnlocked(request);
+        SubmitUnlocked();
+      } else if (res < 0) {
+        FinishUnlocked(request, Status::IOError("Error reading bytes from file: ",
+                                                std::strerror(-res)));
+      } else {
+        request->done += res;
+        if (res == 0 || request->done == request->length) {
+          FinishUnlocked(request, Status::OK());
+        } else {
+          // Partial read, issue the rest
+          QueueUnlocked(request);
+          SubmitUnlocked();
+        }
+      }
+    }
+  }
+
+  MemoryPool* pool_;
+  int fd_;
+  bool is_open_;
+  struct io_uring ring_;
+  std::thread completion_thread_;
+
+  // Protects the submission queue and the pending requests
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::unordered_set<Request*> pending_;
+};
+
+#endif  // ARROW_IO_URING_ENABLED
+
+Status AsyncRandomAccessFile::Open(const std::string& path, MemoryPool* pool,
+                                   std::shared_ptr<AsyncRandomAccessFile>* out) {
+#ifdef ARROW_IO_URING_ENABLED
+  std::shared_ptr<IoUringAsyncFile> uring_file;
+  Status st = IoUringAsyncFile::Open(path, pool, &uring_file);
+  if (st.ok()) {
+    *out = uring_file;
+    return Status::OK();
+  }
+  // io_uring may be unsupported by the kernel or forbidden by a seccomp
+  // profile: fall back to pread
+#endif
+  std::shared_ptr<ReadableFile> file;
+  RETURN_NOT_OK(ReadableFile::Open(path, pool, &file));
+  return Make(file, out);
+}
+
+Status AsyncRandomAccessFile::Make(const std::shared_ptr<RandomAccessFile>& file,
+                                   std::shared_ptr<AsyncRandomAccessFile>* out) {
+  *out = std::make_shared<ThreadPoolAsyncFile>(file);
+  return Status::OK();
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Asynchronous, batched positional reads
+
+#ifndef ARROW_IO_ASYNC_H
+#define ARROW_IO_ASYNC_H
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+class RandomAccessFile;
+
+/// \brief A byte range of a file
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+};
+
+/// \class AsyncRandomAccessFile
+/// \brief A file supporting many concurrent positional reads, issued in
+/// batches and completed through futures
+///
+/// Unlike RandomAccessFile::ReadAt, submitting reads does not block the caller,
+/// and does not require one thread per outstanding read when the backend
+/// supports kernel-side queuing (io_uring).
+class ARROW_EXPORT AsyncRandomAccessFile {
+ public:
+  virtual ~AsyncRandomAccessFile();
+
+  /// \brief Open a local file for asynchronous reads
+  ///
+  /// Uses io_uring if Arrow was built with ARROW_WITH_IO_URING and the kernel
+  /// permits it, otherwise pread calls on the global I/O thread pool
+  ///
+  /// \param[in] path the file path
+  /// \param[in] pool the memory pool to allocate read buffers from
+  /// \param[out] out the opened file
+  /// \return Status
+  static Status Open(const std::string& path, MemoryPool* pool,
+                     std::shared_ptr<AsyncRandomAccessFile>* out);
+
+  /// \brief Make any RandomAccessFile asynchronous by issuing its ReadAt
+  /// calls on the global I/O thread pool
+  ///
+  /// The file's ReadAt must be thread-safe. Reads from files supporting
+  /// zero-copy return slices, without allocating.
+  ///
+  /// \param[in] file the file to read from
+  /// \param[out] out the asynchronous file
+  /// \return Status
+  static Status Make(const std::shared_ptr<RandomAccessFile>& file,
+                     std::shared_ptr<AsyncRandomAccessFile>* out);
+
+  /// \brief Submit a batch of reads
+  ///
+  /// One buffer and one future are returned per range, in the order of the
+  /// ranges. A buffer may only be used once its future has completed with an
+  /// OK status; it is shorter than requested if the range extends past the end
+  /// of the file. The buffers vector must not be modified until all futures
+  /// have completed.
+  ///
+  /// \param[in] ranges the byte ranges to read
+  /// \param[out] buffers the buffers receiving the data
+  /// \param[out] futures the completion of each read
+  /// \return Status, an error if the reads could not be submitted, in which
+  /// case no futures are returned
+  virtual Status ReadAsync(const std::vector<ReadRange>& ranges,
+                           std::vector<std::shared_ptr<Buffer>>* buffers,
+                           std::vector<std::future<Status>>* futures) = 0;
+
+  /// \brief Read a batch of ranges and wait for all of them
+  ///
+  /// \param[in] ranges the byte ranges to read
+  /// \param[out] buffers the data of each range, in order
+  /// \return Status, the first error of any read
+  Status ReadAt(const std::vector<ReadRange>& ranges,
+                std::vector<std::shared_ptr<Buffer>>* buffers);
+
+  /// \brief Return the size of the file in bytes
+  virtual Status GetSize(int64_t* size) = 0;
+
+  /// \brief Close the file. Reads in flight are completed first
+  virtual Status Close() = 0;
+
+  /// \brief The name of the implementation, "io_uring" or "threadpool"
+  virtual std::string backend() const = 0;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_ASYNC_H
@@ -227,6 +227,27 @@ TEST_F(TestBufferedOutputStream, LargeWrites) {
   AssertFileContents(path_, data);
 }
 
+TEST_F(TestBufferedOutputStream, VectoredWrites) {
+  OpenBuffered(1000);
+
+  const std::string data = GenerateRandomData(10000);
+  const char* p = data.data();
+
+  // Fits in the buffer
+  ASSERT_OK(buffered_->WriteSpans(std::vector<BufferSpan>{{p, 100}, {p + 100, 200}}));
+  AssertFileContents(path_, "");
+
+  // Goes to the raw stream together with the buffered bytes
+  ASSERT_OK(
+      buffered_->WriteSpans(std::vector<BufferSpan>{{p + 300, 700}, {p + 1000, 2000}}));
+  AssertFileContents(path_, data.substr(0, 3000));
+
+  ASSERT_OK(buffered_->WriteSpans(std::vector<BufferSpan>{{p + 3000, 7000}}));
+  ASSERT_OK(buffered_->Close());
+
+  AssertFileContents(path_, data);
+}
+
 TEST_F(TestBufferedOutputStream, Flush) {
   OpenBuffered();
 
@@ -135,6 +135,38 @@ class BufferedOutputStream::Impl : public BufferedBase {
     return Status::OK();
   }
 
+  Status WriteSpans(const std::vector<BufferSpan>& spans) {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t nbytes = 0;
+    for (const auto& span : spans) {
+      if (span.size < 0) {
+        return Status::Invalid("write count should be >= 0");
+      }
+      nbytes += span.size;
+    }
+    if (nbytes + buffer_pos_ < buffer_size_) {
+      for (const auto& span : spans) {
+        if (span.size > 0) {
+          AppendToBuffer(span.data, span.size);
+        }
+      }
+      return Status::OK();
+    }
+
+    // Pass the buffered bytes and the new spans down in one vectored write
+    std::vector<BufferSpan> raw_spans;
+    raw_spans.reserve(spans.size() + 1);
+    if (buffer_pos_ > 0) {
+      raw_spans.push_back({buffer_data_, buffer_pos_});
+    }
+    raw_spans.insert(raw_spans.end(), spans.begin(), spans.end());
+    // Invalidate cached raw pos
+    raw_pos_ = -1;
+    RETURN_NOT_OK(raw_->WriteSpans(raw_spans));
+    buffer_pos_ = 0;
+    return Status::OK();
+  }
+
   Status FlushUnlocked() {
     if (buffer_pos_ > 0) {
       // Invalidate cached raw pos
@@ -212,6 +244,10 @@ Status BufferedOutputStream::Write(const void* data, int64_t nbytes) {
   return impl_->Write(data, nbytes);
 }
 
+Status BufferedOutputStream::WriteSpans(const std::vector<BufferSpan>& spans) {
+  return impl_->WriteSpans(spans);
+}
+
 Status BufferedOutputStream::Flush() { return impl_->Flush(); }
 
 std::shared_ptr<OutputStream> BufferedOutputStream::raw() const { return impl_->raw(); }
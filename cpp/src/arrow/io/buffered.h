@@ -74,6 +74,13 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  /// \brief Write a sequence of byte ranges. Thread-safe
+  ///
+  /// Spans that fit in the buffer are copied into it. Otherwise the buffered
+  /// bytes and the spans are handed to the raw stream as a single vectored
+  /// write, without copying
+  Status WriteSpans(const std::vector<BufferSpan>& spans) override;
+
   Status Flush() override;
 
   /// \brief Return the underlying raw output stream.
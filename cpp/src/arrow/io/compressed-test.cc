@@ -29,6 +29,7 @@
 #include "arrow/status.h"
 #include "arrow/test-util.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/compression_zlib.h"
 
 namespace arrow {
 namespace io {
@@ -76,13 +77,7 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
   return std::move(compressed);
 }
 
-Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                std::vector<uint8_t>* out) {
-  // Create compressed input stream
-  auto buffer_reader = std::make_shared<BufferReader>(compressed);
-  std::shared_ptr<CompressedInputStream> stream;
-  RETURN_NOT_OK(CompressedInputStream::Make(codec, buffer_reader, &stream));
-
+Status ReadAll(InputStream* stream, std::vector<uint8_t>* out) {
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
   const int64_t chunk_size = 1111;
@@ -101,6 +96,75 @@ Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed
   return Status::OK();
 }
 
+Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                std::vector<uint8_t>* out) {
+  // Create compressed input stream
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  std::shared_ptr<CompressedInputStream> stream;
+  RETURN_NOT_OK(CompressedInputStream::Make(codec, buffer_reader, &stream));
+  return ReadAll(stream.get(), out);
+}
+
+Status RunParallelCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                        int32_t max_pending_frames,
+                                        std::vector<uint8_t>* out) {
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  std::shared_ptr<ParallelCompressedInputStream> stream;
+  RETURN_NOT_OK(ParallelCompressedInputStream::Make(
+      default_memory_pool(), codec, buffer_reader, max_pending_frames, &stream));
+  return ReadAll(stream.get(), out);
+}
+
+// Compress each slice of frame_size bytes as a separate member or frame
+std::shared_ptr<Buffer> CompressDataFrames(Codec* codec, const std::vector<uint8_t>& data,
+                                           int64_t frame_size) {
+  std::string compressed;
+  for (size_t pos = 0; pos < data.size(); pos += frame_size) {
+    auto end = std::min(data.size(), pos + frame_size);
+    std::vector<uint8_t> frame(data.begin() + pos, data.begin() + end);
+    compressed += CompressDataOneShot(codec, frame)->ToString();
+  }
+  return Buffer::FromString(std::move(compressed));
+}
+
+uint32_t Crc32(const uint8_t* data, int64_t size) {
+  uint32_t crc = 0xFFFFFFFFU;
+  for (int64_t i = 0; i < size; ++i) {
+    crc ^= data[i];
+    for (int k = 0; k < 8; ++k) {
+      crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+void AppendLE(uint32_t value, int nbytes, std::string* out) {
+  for (int i = 0; i < nbytes; ++i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+// Compress data as BGZF: gzip members of less than 64 KB, each with a "BC"
+// extra subfield giving its size
+std::shared_ptr<Buffer> CompressDataBGZF(const std::vector<uint8_t>& data) {
+  const int64_t kBlockSize = 60000;
+  util::GZipCodec deflate_codec(util::GZipCodec::DEFLATE);
+  std::string compressed;
+  for (size_t pos = 0; pos < data.size(); pos += kBlockSize) {
+    auto end = std::min<size_t>(data.size(), pos + kBlockSize);
+    std::vector<uint8_t> block(data.begin() + pos, data.begin() + end);
+    auto deflated = CompressDataOneShot(&deflate_codec, block)->ToString();
+
+    const int64_t member_size = 18 + deflated.size() + 8;
+    compressed += std::string("\x1f\x8b\x08\x04\0\0\0\0\0\xff\x06\0BC\x02\0", 16);
+    AppendLE(static_cast<uint32_t>(member_size - 1), 2, &compressed);
+    compressed += deflated;
+    AppendLE(Crc32(block.data(), block.size()), 4, &compressed);
+    AppendLE(static_cast<uint32_t>(block.size()), 4, &compressed);
+  }
+  return Buffer::FromString(std::move(compressed));
+}
+
 void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data) {
   // Create compressed data
   auto compressed = CompressDataOneShot(codec, data);
@@ -189,6 +253,21 @@ TEST_P(CompressedInputStreamTest, InvalidData) {
   ASSERT_RAISES(IOError, stream->Read(1024, &out_buf));
 }
 
+TEST_P(CompressedInputStreamTest, ConcatenatedData) {
+  // Concatenated members or frames (e.g. `cat a.gz b.gz`) are all decompressed
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(100000);
+  auto compressed = CompressDataOneShot(codec.get(), data);
+  auto compressed_data = compressed->ToString() + compressed->ToString();
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(
+      codec.get(), Buffer::FromString(std::move(compressed_data)), &decompressed));
+  auto expected = data;
+  expected.insert(expected.end(), data.begin(), data.end());
+  ASSERT_EQ(decompressed, expected);
+}
+
 // NOTE: Snappy doesn't support streaming decompression
 
 // NOTE: BZ2 doesn't support one-shot compression
@@ -207,6 +286,170 @@ INSTANTIATE_TEST_CASE_P(TestZSTDInputStream, CompressedInputStreamTest,
                         ::testing::Values(Compression::ZSTD));
 #endif
 
+class ParallelCompressedInputStreamTest
+    : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  Compression::type GetCompression() { return GetParam(); }
+
+  std::unique_ptr<Codec> MakeCodec() {
+    std::unique_ptr<Codec> codec;
+    ABORT_NOT_OK(Codec::Create(GetCompression(), &codec));
+    return codec;
+  }
+
+  void CheckDecompressed(Codec* codec, const std::shared_ptr<Buffer>& compressed,
+                         const std::vector<uint8_t>& expected) {
+    for (int32_t max_pending_frames : {0, 1, 4}) {
+      std::vector<uint8_t> decompressed;
+      ASSERT_OK(RunParallelCompressedInputStream(codec, compressed, max_pending_frames,
+                                                 &decompressed));
+      ASSERT_EQ(decompressed.size(), expected.size());
+      ASSERT_EQ(decompressed, expected);
+    }
+  }
+};
+
+TEST_P(ParallelCompressedInputStreamTest, SingleFrame) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  CheckDecompressed(codec.get(), CompressDataOneShot(codec.get(), data), data);
+
+  data = MakeRandomData(RANDOM_DATA_SIZE);
+  CheckDecompressed(codec.get(), CompressDataOneShot(codec.get(), data), data);
+}
+
+TEST_P(ParallelCompressedInputStreamTest, SeveralFrames) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  CheckDecompressed(codec.get(), CompressDataFrames(codec.get(), data, 100000), data);
+
+  data = MakeRandomData(RANDOM_DATA_SIZE);
+  CheckDecompressed(codec.get(), CompressDataFrames(codec.get(), data, 100000), data);
+
+  // Empty frames
+  std::vector<uint8_t> empty;
+  auto empty_frame = CompressDataOneShot(codec.get(), empty)->ToString();
+  data = MakeRandomData(1000);
+  auto compressed = empty_frame + CompressDataOneShot(codec.get(), data)->ToString() +
+                    empty_frame + empty_frame;
+  CheckDecompressed(codec.get(), Buffer::FromString(std::move(compressed)), data);
+}
+
+TEST_P(ParallelCompressedInputStreamTest, EmptyStream) {
+  auto codec = MakeCodec();
+  CheckDecompressed(codec.get(), Buffer::FromString(std::string()), {});
+}
+
+TEST_P(ParallelCompressedInputStreamTest, TruncatedData) {
+  auto codec = MakeCodec();
+  auto data = MakeRandomData(300000);
+  auto compressed = CompressDataFrames(codec.get(), data, 100000);
+  auto truncated = SliceBuffer(compressed, 0, compressed->size() - 3);
+
+  for (int32_t max_pending_frames : {0, 1, 4}) {
+    std::vector<uint8_t> decompressed;
+    ASSERT_RAISES(IOError,
+                  RunParallelCompressedInputStream(codec.get(), truncated,
+                                                   max_pending_frames, &decompressed));
+  }
+}
+
+TEST_P(ParallelCompressedInputStreamTest, InvalidData) {
+  auto codec = MakeCodec();
+  auto compressed_data = MakeRandomData(100);
+
+  for (int32_t max_pending_frames : {0, 1, 4}) {
+    std::vector<uint8_t> decompressed;
+    ASSERT_RAISES(IOError, RunParallelCompressedInputStream(
+                               codec.get(), Buffer::Wrap(compressed_data),
+                               max_pending_frames, &decompressed));
+  }
+}
+
+TEST_P(ParallelCompressedInputStreamTest, OwnedCodec) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(100000);
+  auto buffer_reader =
+      std::make_shared<BufferReader>(CompressDataFrames(codec.get(), data, 30000));
+
+  std::shared_ptr<ParallelCompressedInputStream> stream;
+  ASSERT_OK(ParallelCompressedInputStream::Make(default_memory_pool(), GetCompression(),
+                                                buffer_reader, 4, &stream));
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(ReadAll(stream.get(), &decompressed));
+  ASSERT_EQ(decompressed, data);
+  ASSERT_OK(stream->Close());
+  ASSERT_TRUE(stream->closed());
+
+  ASSERT_RAISES(Invalid,
+                ParallelCompressedInputStream::Make(default_memory_pool(),
+                                                    Compression::UNCOMPRESSED,
+                                                    buffer_reader, 4, &stream));
+}
+
+TEST_P(ParallelCompressedInputStreamTest, MakeDecompressedInputStream) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(100000);
+  auto compressed = CompressDataFrames(codec.get(), data, 30000);
+
+  for (bool use_threads : {false, true}) {
+    auto buffer_reader = std::make_shared<BufferReader>(compressed);
+    std::shared_ptr<InputStream> stream;
+    ASSERT_OK(MakeDecompressedInputStream(default_memory_pool(), GetCompression(),
+                                          use_threads, buffer_reader, &stream));
+    std::vector<uint8_t> decompressed;
+    ASSERT_OK(ReadAll(stream.get(), &decompressed));
+    ASSERT_EQ(decompressed, data);
+  }
+
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  std::shared_ptr<InputStream> stream;
+  ASSERT_OK(MakeDecompressedInputStream(default_memory_pool(), Compression::UNCOMPRESSED,
+                                        true, buffer_reader, &stream));
+  ASSERT_EQ(stream, buffer_reader);
+}
+
+INSTANTIATE_TEST_CASE_P(TestGZipParallelInputStream, ParallelCompressedInputStreamTest,
+                        ::testing::Values(Compression::GZIP));
+
+#ifdef ARROW_WITH_ZSTD
+INSTANTIATE_TEST_CASE_P(TestZSTDParallelInputStream, ParallelCompressedInputStreamTest,
+                        ::testing::Values(Compression::ZSTD));
+#endif
+
+TEST(ParallelCompressedInputStream, BGZF) {
+  util::GZipCodec codec;
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto compressed = CompressDataBGZF(data);
+
+  int64_t frame_len;
+  ASSERT_OK(codec.GetFrameLength(compressed->size(), compressed->data(), &frame_len));
+  ASSERT_GT(frame_len, 0);
+  ASSERT_LT(frame_len, 65536);
+
+  for (int32_t max_pending_frames : {0, 1, 4}) {
+    std::vector<uint8_t> decompressed;
+    ASSERT_OK(RunParallelCompressedInputStream(&codec, compressed, max_pending_frames,
+                                               &decompressed));
+    ASSERT_EQ(decompressed, data);
+  }
+
+  // BGZF members interleaved with regular gzip members
+  auto regular = CompressDataOneShot(&codec, data);
+  auto mixed = Buffer::FromString(compressed->ToString() + regular->ToString() +
+                                  compressed->ToString());
+  auto expected = data;
+  expected.insert(expected.end(), data.begin(), data.end());
+  expected.insert(expected.end(), data.begin(), data.end());
+  for (int32_t max_pending_frames : {0, 1, 4}) {
+    std::vector<uint8_t> decompressed;
+    ASSERT_OK(RunParallelCompressedInputStream(&codec, mixed, max_pending_frames,
+                                               &decompressed));
+    ASSERT_EQ(decompressed.size(), expected.size());
+    ASSERT_EQ(decompressed, expected);
+  }
+}
+
 class CompressedOutputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
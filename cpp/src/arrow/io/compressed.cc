@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,6 +31,7 @@
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
@@ -36,6 +39,8 @@ using util::Codec;
 using util::Compressor;
 using util::Decompressor;
 
+using internal::GetCpuThreadPool;
+
 namespace io {
 
 // ----------------------------------------------------------------------
@@ -326,7 +331,13 @@ class CompressedInputStream::Impl {
       // At this point, no more decompressed data remains,
       // so we need to decompress more
       if (decompressor_->IsFinished()) {
-        break;
+        // The current member or frame is finished, decompress the next one
+        // (if any) with a fresh decompressor
+        RETURN_NOT_OK(EnsureCompressedData());
+        if (compressed_pos_ == compressed_->size()) {
+          break;
+        }
+        RETURN_NOT_OK(codec_->MakeDecompressor(&decompressor_));
       }
       // First try to read data from the decompressor
       if (compressed_) {
@@ -411,5 +422,358 @@ Status CompressedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out)
 
 std::shared_ptr<InputStream> CompressedInputStream::raw() const { return impl_->raw(); }
 
+// ----------------------------------------------------------------------
+// ParallelCompressedInputStream implementation
+
+class ParallelCompressedInputStream::Impl {
+ public:
+  Impl(MemoryPool* pool, Codec* codec, const std::shared_ptr<InputStream>& raw,
+       int32_t max_pending_frames)
+      : pool_(pool),
+        raw_(raw),
+        codec_(codec),
+        max_pending_frames_(max_pending_frames),
+        is_open_(true),
+        // Without pending frames, everything is decompressed as a stream
+        streaming_(max_pending_frames <= 0) {}
+
+  ~Impl() { DCHECK(Close().ok()); }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (is_open_) {
+      is_open_ = false;
+      // Pending tasks refer to this object, wait for them
+      for (auto& frame : pending_) {
+        frame->status.wait();
+      }
+      pending_.clear();
+      return raw_->Close();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  bool closed() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return !is_open_;
+  }
+
+  Status Tell(int64_t* position) const {
+    return Status::NotImplemented("Cannot tell() a compressed stream");
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    *bytes_read = 0;
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+
+    while (nbytes > 0) {
+      int64_t avail = decompressed_ ? (decompressed_->size() - decompressed_pos_) : 0;
+      if (avail > 0) {
+        avail = std::min(avail, nbytes);
+        memcpy(out_data, decompressed_->data() + decompressed_pos_, avail);
+        decompressed_pos_ += avail;
+        out_data += avail;
+        *bytes_read += avail;
+        nbytes -= avail;
+        continue;
+      }
+      // Decompressed data is exhausted, get the next buffer
+      decompressed_.reset();
+      decompressed_pos_ = 0;
+      if (eof_) {
+        break;
+      }
+      RETURN_NOT_OK(NextDecompressed(&decompressed_));
+      eof_ = decompressed_ == nullptr;
+    }
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<ResizableBuffer> buf;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buf));
+    int64_t bytes_read;
+    RETURN_NOT_OK(Read(nbytes, &bytes_read, buf->mutable_data()));
+    RETURN_NOT_OK(buf->Resize(bytes_read));
+    *out = buf;
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+  void set_owned_codec(std::unique_ptr<Codec> codec) { owned_codec_ = std::move(codec); }
+
+ private:
+  // Read 64 KB compressed data at a time
+  static const int64_t kChunkSize = 64 * 1024;
+  // Decompress 1 MB at a time
+  static const int64_t kDecompressSize = 1024 * 1024;
+
+  struct PendingFrame {
+    std::future<Status> status;
+    std::shared_ptr<Buffer> decompressed;
+  };
+
+  int64_t compressed_avail() const {
+    return compressed_ ? compressed_->size() - compressed_pos_ : 0;
+  }
+
+  // Read more compressed data, appending it to the unconsumed data
+  Status ReadCompressed() {
+    const int64_t avail = compressed_avail();
+    // Read at least as much as is pending, to stay linear on large frames
+    std::shared_ptr<Buffer> chunk;
+    RETURN_NOT_OK(raw_->Read(std::max(kChunkSize, avail), &chunk));
+    if (chunk->size() == 0) {
+      raw_eof_ = true;
+    } else if (avail == 0) {
+      compressed_ = chunk;
+      compressed_pos_ = 0;
+    } else {
+      std::shared_ptr<Buffer> concatenated;
+      RETURN_NOT_OK(AllocateBuffer(pool_, avail + chunk->size(), &concatenated));
+      uint8_t* data = concatenated->mutable_data();
+      memcpy(data, compressed_->data() + compressed_pos_, avail);
+      memcpy(data + avail, chunk->data(), chunk->size());
+      compressed_ = concatenated;
+      compressed_pos_ = 0;
+    }
+    return Status::OK();
+  }
+
+  // Spawn decompression of delimited frames, until the queue is full or
+  // the next frame can't be delimited
+  Status ScheduleFrames() {
+    while (!streaming_ && static_cast<int32_t>(pending_.size()) < max_pending_frames_) {
+      const int64_t avail = compressed_avail();
+      if (avail == 0) {
+        if (raw_eof_) {
+          break;
+        }
+        RETURN_NOT_OK(ReadCompressed());
+        continue;
+      }
+      int64_t frame_len;
+      Status st = codec_->GetFrameLength(avail, compressed_->data() + compressed_pos_,
+                                         &frame_len);
+      if (st.IsNotImplemented()) {
+        streaming_ = true;
+        break;
+      }
+      RETURN_NOT_OK(st);
+      if (frame_len == 0) {
+        // Incomplete frame
+        if (raw_eof_) {
+          return Status::IOError("Truncated compressed stream");
+        }
+        RETURN_NOT_OK(ReadCompressed());
+        continue;
+      }
+      auto frame = SliceBuffer(compressed_, compressed_pos_, frame_len);
+      compressed_pos_ += frame_len;
+
+      auto pending = std::make_shared<PendingFrame>();
+      pending->status = GetCpuThreadPool()->Submit([this, pending, frame]() {
+        return DecompressFrame(*frame, &pending->decompressed);
+      });
+      pending_.push_back(pending);
+    }
+    return Status::OK();
+  }
+
+  // Decompress a whole frame (called from a thread pool task)
+  Status DecompressFrame(const Buffer& frame, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<Decompressor> decompressor;
+    RETURN_NOT_OK(codec_->MakeDecompressor(&decompressor));
+
+    std::shared_ptr<ResizableBuffer> decompressed;
+    RETURN_NOT_OK(AllocateResizableBuffer(
+        pool_, std::max<int64_t>(kChunkSize, frame.size() * 4), &decompressed));
+    int64_t input_pos = 0;
+    int64_t output_pos = 0;
+    while (!decompressor->IsFinished()) {
+      bool need_more_output;
+      int64_t bytes_read, bytes_written;
+      RETURN_NOT_OK(decompressor->Decompress(
+          frame.size() - input_pos, frame.data() + input_pos,
+          decompressed->size() - output_pos, decompressed->mutable_data() + output_pos,
+          &bytes_read, &bytes_written, &need_more_output));
+      input_pos += bytes_read;
+      output_pos += bytes_written;
+      if (bytes_read == 0 && bytes_written == 0) {
+        if (input_pos == frame.size()) {
+          return Status::IOError("Truncated compressed frame");
+        }
+        need_more_output = true;
+      }
+      if (need_more_output || output_pos == decompressed->size()) {
+        RETURN_NOT_OK(decompressed->Resize(decompressed->size() * 2));
+      }
+    }
+    if (input_pos != frame.size()) {
+      return Status::IOError("Corrupt compressed frame: data after end of frame");
+    }
+    RETURN_NOT_OK(decompressed->Resize(output_pos));
+    *out = decompressed;
+    return Status::OK();
+  }
+
+  // Decompress some data from a frame that couldn't be delimited, on the
+  // reading thread
+  Status DecompressStreaming(std::shared_ptr<Buffer>* out) {
+    if (compressed_avail() == 0) {
+      RETURN_NOT_OK(ReadCompressed());
+      if (compressed_avail() == 0) {
+        if (decompressor_) {
+          return Status::IOError("Truncated compressed stream");
+        }
+        // Clean end of stream
+        out->reset();
+        return Status::OK();
+      }
+    }
+    if (!decompressor_) {
+      RETURN_NOT_OK(codec_->MakeDecompressor(&decompressor_));
+    }
+
+    int64_t decompress_size = kDecompressSize;
+    std::shared_ptr<ResizableBuffer> decompressed;
+    while (true) {
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, decompress_size, &decompressed));
+      bool need_more_output;
+      int64_t bytes_read, bytes_written;
+      int64_t input_len = compressed_avail();
+      RETURN_NOT_OK(decompressor_->Decompress(
+          input_len, compressed_->data() + compressed_pos_, decompressed->size(),
+          decompressed->mutable_data(), &bytes_read, &bytes_written, &need_more_output));
+      compressed_pos_ += bytes_read;
+      if (bytes_written > 0 || !need_more_output || input_len == 0) {
+        RETURN_NOT_OK(decompressed->Resize(bytes_written));
+        break;
+      }
+      // Need to enlarge output buffer
+      decompress_size *= 2;
+    }
+    if (decompressor_->IsFinished()) {
+      // End of member or frame, the next one may be delimited
+      decompressor_.reset();
+      streaming_ = max_pending_frames_ <= 0;
+    }
+    *out = decompressed;
+    return Status::OK();
+  }
+
+  // Get the next decompressed buffer in stream order, or null at end of stream
+  Status NextDecompressed(std::shared_ptr<Buffer>* out) {
+    while (true) {
+      RETURN_NOT_OK(ScheduleFrames());
+      if (!pending_.empty()) {
+        auto frame = pending_.front();
+        pending_.pop_front();
+        RETURN_NOT_OK(frame->status.get());
+        *out = frame->decompressed;
+      } else if (streaming_) {
+        RETURN_NOT_OK(DecompressStreaming(out));
+        if (*out == nullptr) {
+          return Status::OK();
+        }
+      } else {
+        // All frames were consumed
+        out->reset();
+        return Status::OK();
+      }
+      if ((*out)->size() > 0) {
+        return Status::OK();
+      }
+    }
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<InputStream> raw_;
+  Codec* codec_;
+  std::unique_ptr<Codec> owned_codec_;
+  const int32_t max_pending_frames_;
+  bool is_open_;
+  // Whether the current frame is decompressed on the reading thread
+  bool streaming_;
+  bool raw_eof_ = false;
+  bool eof_ = false;
+
+  std::shared_ptr<Buffer> compressed_;
+  int64_t compressed_pos_ = 0;
+  std::shared_ptr<Decompressor> decompressor_;
+  std::deque<std::shared_ptr<PendingFrame>> pending_;
+  std::shared_ptr<Buffer> decompressed_;
+  int64_t decompressed_pos_ = 0;
+
+  mutable std::mutex lock_;
+};
+
+Status ParallelCompressedInputStream::Make(
+    MemoryPool* pool, Codec* codec, const std::shared_ptr<InputStream>& raw,
+    int32_t max_pending_frames, std::shared_ptr<ParallelCompressedInputStream>* out) {
+  std::shared_ptr<ParallelCompressedInputStream> res(new ParallelCompressedInputStream);
+  res->impl_.reset(new Impl(pool, codec, raw, max_pending_frames));
+  *out = res;
+  return Status::OK();
+}
+
+Status ParallelCompressedInputStream::Make(
+    MemoryPool* pool, Compression::type compression,
+    const std::shared_ptr<InputStream>& raw, int32_t max_pending_frames,
+    std::shared_ptr<ParallelCompressedInputStream>* out) {
+  std::unique_ptr<Codec> codec;
+  RETURN_NOT_OK(Codec::Create(compression, &codec));
+  if (codec == nullptr) {
+    return Status::Invalid("Cannot decompress an uncompressed stream");
+  }
+  RETURN_NOT_OK(Make(pool, codec.get(), raw, max_pending_frames, out));
+  (*out)->impl_->set_owned_codec(std::move(codec));
+  return Status::OK();
+}
+
+Status MakeDecompressedInputStream(MemoryPool* pool, Compression::type compression,
+                                   bool use_threads,
+                                   const std::shared_ptr<InputStream>& raw,
+                                   std::shared_ptr<InputStream>* out) {
+  if (compression == Compression::UNCOMPRESSED) {
+    *out = raw;
+    return Status::OK();
+  }
+  const int32_t max_pending_frames = use_threads ? GetCpuThreadPoolCapacity() : 0;
+  std::shared_ptr<ParallelCompressedInputStream> stream;
+  RETURN_NOT_OK(ParallelCompressedInputStream::Make(pool, compression, raw,
+                                                    max_pending_frames, &stream));
+  *out = stream;
+  return Status::OK();
+}
+
+ParallelCompressedInputStream::~ParallelCompressedInputStream() {}
+
+Status ParallelCompressedInputStream::Close() { return impl_->Close(); }
+
+bool ParallelCompressedInputStream::closed() const { return impl_->closed(); }
+
+Status ParallelCompressedInputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status ParallelCompressedInputStream::Read(int64_t nbytes, int64_t* bytes_read,
+                                           void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status ParallelCompressedInputStream::Read(int64_t nbytes,
+                                           std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+std::shared_ptr<InputStream> ParallelCompressedInputStream::raw() const {
+  return impl_->raw();
+}
+
 }  // namespace io
 }  // namespace arrow
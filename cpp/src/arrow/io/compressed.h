@@ -24,6 +24,7 @@
 #include <string>
 
 #include "arrow/io/interfaces.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -31,12 +32,6 @@ namespace arrow {
 class MemoryPool;
 class Status;
 
-namespace util {
-
-class Codec;
-
-}  // namespace util
-
 namespace io {
 
 class ARROW_EXPORT CompressedOutputStream : public OutputStream {
@@ -109,6 +104,69 @@ class ARROW_EXPORT CompressedInputStream : public InputStream {
   std::unique_ptr<Impl> impl_;
 };
 
+/// \brief EXPERIMENTAL: A compressed input stream decompressing independent
+/// frames in parallel
+///
+/// Frames whose length is known ahead of decompression (see
+/// util::Codec::GetFrameLength: zstd frames, BGZF blocks) are decompressed
+/// concurrently on the global CPU thread pool, at most max_pending_frames
+/// ahead of the reader.  Other compressed data (e.g. regular gzip members)
+/// is decompressed on the reading thread.  Concatenated members or frames
+/// are all decompressed.
+///
+/// Since reading waits for CPU thread pool tasks, this stream should not be
+/// read from a CPU thread pool task.
+class ARROW_EXPORT ParallelCompressedInputStream : public InputStream {
+ public:
+  ~ParallelCompressedInputStream() override;
+
+  /// \brief Create a compressed input stream wrapping the given input stream.
+  ///
+  /// If max_pending_frames is 0, all data is decompressed on the reading thread.
+  static Status Make(MemoryPool* pool, util::Codec* codec,
+                     const std::shared_ptr<InputStream>& raw, int32_t max_pending_frames,
+                     std::shared_ptr<ParallelCompressedInputStream>* out);
+  /// \brief Same, with a codec created for the given compression and owned
+  /// by the stream.
+  static Status Make(MemoryPool* pool, Compression::type compression,
+                     const std::shared_ptr<InputStream>& raw, int32_t max_pending_frames,
+                     std::shared_ptr<ParallelCompressedInputStream>* out);
+
+  // InputStream interface
+
+  /// \brief Close the compressed input stream.  This implicitly closes the
+  /// underlying raw input stream.
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Return the underlying raw input stream.
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ParallelCompressedInputStream);
+
+  ParallelCompressedInputStream() = default;
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Wrap 'raw' in a ParallelCompressedInputStream for the given compression,
+/// returning it unchanged if uncompressed.
+///
+/// Frames are decompressed on the CPU thread pool, up to its capacity ahead of the
+/// reader, only if use_threads is true; otherwise on the reading thread.
+ARROW_EXPORT
+Status MakeDecompressedInputStream(MemoryPool* pool, Compression::type compression,
+                                   bool use_threads,
+                                   const std::shared_ptr<InputStream>& raw,
+                                   std::shared_ptr<InputStream>* out);
+
 }  // namespace io
 }  // namespace arrow
 
@@ -242,6 +242,27 @@ TEST_F(TestFileOutputStream, TruncatesNewFile) {
   AssertFileContents(path_, "");
 }
 
+TEST_F(TestFileOutputStream, VectoredWrite) {
+  ASSERT_OK(FileOutputStream::Open(path_, &file_));
+
+  std::vector<BufferSpan> spans = {{"test", 4}, {"", 0}, {"data", 4}};
+  ASSERT_OK(file_->WriteSpans(spans));
+
+  // More spans than a single writev call accepts
+  std::string data(5000, ' ');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>('a' + i % 26);
+  }
+  spans.clear();
+  for (size_t i = 0; i < data.size(); ++i) {
+    spans.push_back({data.data() + i, 1});
+  }
+  ASSERT_OK(file_->WriteSpans(spans));
+  ASSERT_OK(file_->Close());
+
+  AssertFileContents(path_, "testdata" + data);
+}
+
 TEST_F(TestFileOutputStream, Append) {
   ASSERT_OK(FileOutputStream::Open(path_, &file_));
   {
@@ -149,6 +149,16 @@ class OSFile {
     return internal::FileWrite(fd_, reinterpret_cast<const uint8_t*>(data), length);
   }
 
+  Status WriteSpans(const std::vector<BufferSpan>& spans) {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (const auto& span : spans) {
+      if (span.size < 0) {
+        return Status::IOError("Length must be non-negative");
+      }
+    }
+    return internal::FileWritev(fd_, spans);
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -345,6 +355,10 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::WriteSpans(const std::vector<BufferSpan>& spans) {
+  return impl_->WriteSpans(spans);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
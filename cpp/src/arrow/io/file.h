@@ -95,6 +95,9 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  // Write a sequence of byte ranges with vectored system calls. Thread-safe
+  Status WriteSpans(const std::vector<BufferSpan>& spans) override;
+
   using Writable::Write;
 
   int file_descriptor() const;
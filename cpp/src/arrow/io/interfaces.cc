@@ -67,6 +67,15 @@ Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
 
+Status Writable::WriteSpans(const std::vector<BufferSpan>& spans) {
+  for (const auto& span : spans) {
+    if (span.size > 0) {
+      RETURN_NOT_OK(Write(span.data, span.size));
+    }
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 }  // namespace io
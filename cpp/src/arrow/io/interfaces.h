@@ -42,6 +42,12 @@ struct ObjectType {
   enum type { FILE, DIRECTORY };
 };
 
+/// \brief A contiguous range of bytes, one element of a vectored write
+struct ARROW_EXPORT BufferSpan {
+  const void* data;
+  int64_t size;
+};
+
 struct ARROW_EXPORT FileStatistics {
   /// Size of file, -1 if finding length is unsupported
   int64_t size;
@@ -94,6 +100,13 @@ class ARROW_EXPORT Writable {
 
   virtual Status Write(const void* data, int64_t nbytes) = 0;
 
+  /// \brief Write a sequence of byte ranges, in order
+  ///
+  /// The result is the same as writing each span with a separate call. The
+  /// default implementation does exactly that; implementations backed by a
+  /// file descriptor issue vectored (writev) system calls instead
+  virtual Status WriteSpans(const std::vector<BufferSpan>& spans);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -283,6 +283,181 @@ TEST(ReadaheadSpooler, StressReads) {
   ASSERT_EQ(pos, NBYTES);
 }
 
+static void ReadAll(ReadaheadSpooler* spooler, std::vector<ReadaheadBuffer>* out) {
+  while (true) {
+    ReadaheadBuffer buf;
+    ASSERT_OK(spooler->Read(&buf));
+    if (!buf.buffer) {
+      break;
+    }
+    out->push_back(std::move(buf));
+  }
+}
+
+static void AssertBuffersEqual(const std::vector<ReadaheadBuffer>& buffers,
+                               const std::shared_ptr<Buffer>& data) {
+  int64_t pos = 0;
+  for (const auto& buf : buffers) {
+    const int64_t size = buf.buffer->size() - buf.left_padding - buf.right_padding;
+    ASSERT_GT(size, 0);
+    ASSERT_LE(pos + size, data->size());
+    AssertReadaheadBuffer(buf, {buf.left_padding}, {buf.right_padding},
+                          *SliceBuffer(data, pos, size));
+    pos += size;
+  }
+  ASSERT_EQ(pos, data->size());
+}
+
+TEST(ReadaheadSpooler, ConcurrentReads) {
+  const int64_t NBYTES = 10001;
+  std::shared_ptr<ResizableBuffer> data;
+  ASSERT_OK(MakeRandomByteBuffer(NBYTES, default_memory_pool(), &data));
+
+  ReadaheadOptions options = ReadaheadOptions::Defaults();
+  options.read_size = 7;
+  options.readahead_queue_size = 16;
+  options.max_outstanding_reads = 4;
+  options.left_padding = 2;
+  options.right_padding = 3;
+  {
+    ReadaheadSpooler spooler(default_memory_pool(),
+                             std::make_shared<BufferReader>(data), options);
+    std::vector<ReadaheadBuffer> buffers;
+    ReadAll(&spooler, &buffers);
+    ASSERT_EQ(buffers.size(), (NBYTES + 6) / 7);
+    AssertBuffersEqual(buffers, data);
+  }
+  ASSERT_EQ(GetReadaheadMemoryUsage(), 0);
+}
+
+TEST(ReadaheadSpooler, ConcurrentReadsFromOffset) {
+  auto reader = std::make_shared<BufferReader>(std::make_shared<Buffer>("0123456789"));
+  ASSERT_OK(reader->Seek(3));
+
+  ReadaheadOptions options = ReadaheadOptions::Defaults();
+  options.read_size = 2;
+  options.readahead_queue_size = 4;
+  options.max_outstanding_reads = 4;
+  ReadaheadSpooler spooler(default_memory_pool(), reader, options);
+  std::vector<ReadaheadBuffer> buffers;
+  ReadAll(&spooler, &buffers);
+  ASSERT_EQ(buffers.size(), 4);
+  AssertBuffersEqual(buffers, std::make_shared<Buffer>("3456789"));
+}
+
+TEST(ReadaheadSpooler, MemoryLimit) {
+  const int64_t old_limit = GetReadaheadMemoryLimit();
+  SetReadaheadMemoryLimit(10);
+
+  auto data_reader = DataReader("0123456789abcdef");
+  {
+    ReadaheadSpooler spooler(data_reader, 4, 10);
+    ReadaheadBuffer buf;
+
+    // Two blocks fit in the limit
+    AssertEventualPosition(*data_reader, 2 * 4);
+    sleep_for(0.01);
+    AssertPosition(*data_reader, 2 * 4);
+    ASSERT_EQ(GetReadaheadMemoryUsage(), 2 * 4);
+
+    ASSERT_OK(spooler.Read(&buf));
+    AssertReadaheadBuffer(buf, {0}, {0}, "0123");
+    AssertEventualPosition(*data_reader, 3 * 4);
+    ASSERT_OK(spooler.Read(&buf));
+    AssertReadaheadBuffer(buf, {0}, {0}, "4567");
+    ASSERT_OK(spooler.Read(&buf));
+    AssertReadaheadBuffer(buf, {0}, {0}, "89ab");
+    ASSERT_OK(spooler.Read(&buf));
+    AssertReadaheadBuffer(buf, {0}, {0}, "cdef");
+    ASSERT_OK(spooler.Read(&buf));
+    AssertReadaheadBufferEOF(buf);
+  }
+
+  // A block larger than the limit is still read
+  SetReadaheadMemoryLimit(1);
+  {
+    ReadaheadSpooler spooler(DataReader("0123456789"), 4, 10);
+    std::vector<ReadaheadBuffer> buffers;
+    ReadAll(&spooler, &buffers);
+    AssertBuffersEqual(buffers, std::make_shared<Buffer>("0123456789"));
+  }
+  ASSERT_EQ(GetReadaheadMemoryUsage(), 0);
+  SetReadaheadMemoryLimit(old_limit);
+}
+
+TEST(ReadaheadSpooler, AdaptiveReadSize) {
+  const int64_t NBYTES = 1 << 20;
+  std::shared_ptr<ResizableBuffer> data;
+  ASSERT_OK(MakeRandomByteBuffer(NBYTES, default_memory_pool(), &data));
+
+  ReadaheadOptions options = ReadaheadOptions::Defaults();
+  options.adaptive = true;
+  options.read_size = 100;
+  options.min_read_size = 100;
+  options.max_read_size = 8192;
+  // In-memory reads are fast enough to reach the maximum size
+  options.target_read_seconds = 10;
+  options.readahead_queue_size = 2;
+  options.max_outstanding_reads = 2;
+
+  ReadaheadSpooler spooler(default_memory_pool(), std::make_shared<BufferReader>(data),
+                           options);
+  std::vector<ReadaheadBuffer> buffers;
+  ReadAll(&spooler, &buffers);
+  AssertBuffersEqual(buffers, data);
+  ASSERT_EQ(spooler.GetReadSize(), 8192);
+  ASSERT_EQ(buffers.front().buffer->size(), 100);
+  for (const auto& buf : buffers) {
+    ASSERT_LE(buf.buffer->size(), 8192);
+  }
+}
+
+TEST(ReadaheadInputStream, Reads) {
+  const int64_t NBYTES = 10000;
+  std::shared_ptr<ResizableBuffer> data;
+  ASSERT_OK(MakeRandomByteBuffer(NBYTES, default_memory_pool(), &data));
+
+  ReadaheadOptions options = ReadaheadOptions::Defaults();
+  options.read_size = 1000;
+  options.readahead_queue_size = 3;
+  ReadaheadInputStream stream(default_memory_pool(), DataReader(data->ToString()),
+                              options);
+  ASSERT_TRUE(stream.supports_zero_copy());
+
+  int64_t pos = 0;
+  std::shared_ptr<Buffer> buf;
+  // Within a block
+  ASSERT_OK(stream.Read(10, &buf));
+  AssertBufferEqual(*buf, *SliceBuffer(data, pos, 10));
+  pos += 10;
+  ASSERT_EQ(stream.Peek(5), util::string_view(data->ToString()).substr(pos, 5));
+  // Across blocks
+  ASSERT_OK(stream.Read(2500, &buf));
+  AssertBufferEqual(*buf, *SliceBuffer(data, pos, 2500));
+  pos += 2500;
+
+  std::vector<uint8_t> out(3000);
+  int64_t bytes_read;
+  ASSERT_OK(stream.Read(3000, &bytes_read, out.data()));
+  ASSERT_EQ(bytes_read, 3000);
+  ASSERT_EQ(std::memcmp(out.data(), data->data() + pos, 3000), 0);
+  pos += 3000;
+
+  int64_t position;
+  ASSERT_OK(stream.Tell(&position));
+  ASSERT_EQ(position, pos);
+
+  // Short read at end
+  ASSERT_OK(stream.Read(NBYTES, &buf));
+  AssertBufferEqual(*buf, *SliceBuffer(data, pos, NBYTES - pos));
+  ASSERT_OK(stream.Read(10, &buf));
+  ASSERT_EQ(buf->size(), 0);
+
+  ASSERT_OK(stream.Close());
+  ASSERT_TRUE(stream.closed());
+  ASSERT_RAISES(Invalid, stream.Read(10, &buf));
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
@@ -17,56 +17,102 @@
 
 #include "arrow/io/readahead.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstring>
 #include <deque>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <utility>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace io {
+
+ReadaheadOptions ReadaheadOptions::Defaults() { return ReadaheadOptions(); }
+
+// ----------------------------------------------------------------------
+// Global readahead memory budget
+
+static constexpr int64_t kDefaultReadaheadMemoryLimit = 256 << 20;  // 256 MB
+
+static std::atomic<int64_t> readahead_memory_limit(kDefaultReadaheadMemoryLimit);
+static std::atomic<int64_t> readahead_memory_usage(0);
+
+void SetReadaheadMemoryLimit(int64_t nbytes) { readahead_memory_limit.store(nbytes); }
+
+int64_t GetReadaheadMemoryLimit() { return readahead_memory_limit.load(); }
+
+int64_t GetReadaheadMemoryUsage() { return readahead_memory_usage.load(); }
+
 namespace internal {
 
+// Reserve nbytes of the budget, unless that would exceed the limit and
+// force is false
+static bool ReserveReadaheadMemory(int64_t nbytes, bool force) {
+  int64_t usage = readahead_memory_usage.load();
+  do {
+    if (!force && usage + nbytes > readahead_memory_limit.load()) {
+      return false;
+    }
+  } while (!readahead_memory_usage.compare_exchange_weak(usage, usage + nbytes));
+  return true;
+}
+
+static void ReleaseReadaheadMemory(int64_t nbytes) {
+  readahead_memory_usage.fetch_sub(nbytes);
+}
+
 // ----------------------------------------------------------------------
 // ReadaheadSpooler implementation
 
 class ReadaheadSpooler::Impl {
  public:
-  Impl(MemoryPool* pool, std::shared_ptr<InputStream> raw, int64_t read_size,
-       int32_t readahead_queue_size, int64_t left_padding, int64_t right_padding)
+  Impl(MemoryPool* pool, std::shared_ptr<InputStream> raw,
+       const ReadaheadOptions& options)
       : pool_(pool),
         raw_(raw),
-        read_size_(read_size),
-        readahead_queue_size_(readahead_queue_size),
-        left_padding_(left_padding),
-        right_padding_(right_padding) {
+        options_(options),
+        read_size_(options.read_size),
+        left_padding_(options.left_padding),
+        right_padding_(options.right_padding) {
     DCHECK_NE(raw, nullptr);
-    DCHECK_GT(read_size, 0);
-    DCHECK_GT(readahead_queue_size, 0);
-    io_worker_ = std::thread([&]() { WorkerLoop(); });
+    DCHECK_GT(options.read_size, 0);
+    DCHECK_GT(options.readahead_queue_size, 0);
+    DCHECK_GT(options.max_outstanding_reads, 0);
+    if (options_.max_outstanding_reads > 1) {
+      // Concurrent reads need positional access
+      file_ = std::dynamic_pointer_cast<RandomAccessFile>(raw_);
+      if (file_ && !InitFileReads().ok()) {
+        file_.reset();
+      }
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    IssueReadsUnlocked();
   }
 
-  ~Impl() { ARROW_UNUSED(Close()); }
+  ~Impl() {
+    ARROW_UNUSED(Close());
+    for (const auto& slot : slots_) {
+      ReleaseReadaheadMemory(slot->reserved);
+    }
+  }
 
   Status Close() {
     std::unique_lock<std::mutex> lock(mutex_);
     please_close_ = true;
-    io_wakeup_.notify_one();
-    // Wait for IO thread to finish
-    if (io_worker_.joinable()) {
-      lock.unlock();
-      io_worker_.join();
-      lock.lock();
-    }
+    // Wait for reads in flight to finish
+    io_progress_.wait(lock, [this] { return outstanding_reads_ == 0; });
     return raw_->Close();
   }
 
@@ -74,19 +120,29 @@ class ReadaheadSpooler::Impl {
     std::unique_lock<std::mutex> lock(mutex_);
     while (true) {
       // Drain queue before querying other flags
-      if (buffer_queue_.size() > 0) {
-        *out = std::move(buffer_queue_.front());
-        DCHECK_NE(out->buffer, nullptr);
-        buffer_queue_.pop_front();
+      if (!slots_.empty() && slots_.front()->done) {
+        std::unique_ptr<Slot> slot = std::move(slots_.front());
+        slots_.pop_front();
+        ReleaseReadaheadMemory(slot->reserved);
         // Need to fill up queue again
-        io_wakeup_.notify_one();
+        IssueReadsUnlocked();
+        if (!slot->status.ok()) {
+          // Got a read error, bail out
+          read_status_ = slot->status;
+          return read_status_;
+        }
+        if (slot->data_size == 0) {
+          // Got empty read
+          eof_ = true;
+          continue;
+        }
+        *out = std::move(slot->buffer);
         return Status::OK();
       }
       if (!read_status_.ok()) {
-        // Got a read error, bail out
         return read_status_;
       }
-      if (eof_) {
+      if (slots_.empty() && (eof_ || end_issued_ || please_close_)) {
         out->buffer.reset();
         return Status::OK();
       }
@@ -95,6 +151,11 @@ class ReadaheadSpooler::Impl {
     }
   }
 
+  int64_t read_size() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return read_size_;
+  }
+
   int64_t left_padding() {
     std::unique_lock<std::mutex> lock(mutex_);
     return left_padding_;
@@ -116,56 +177,131 @@ class ReadaheadSpooler::Impl {
   }
 
  protected:
-  // The background thread's main function
-  void WorkerLoop() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    Status st;
+  // A block being read or read, in stream order
+  struct Slot {
+    ReadaheadBuffer buffer;
+    int64_t offset;
+    int64_t read_size;
+    int64_t data_size;
+    int64_t reserved;
+    bool done;
+    Status status;
+  };
 
-    while (true) {
-      if (please_close_) {
-        goto eof;
+  Status InitFileReads() {
+    RETURN_NOT_OK(file_->Tell(&next_offset_));
+    RETURN_NOT_OK(file_->GetSize(&file_size_));
+    end_issued_ = next_offset_ >= file_size_;
+    return Status::OK();
+  }
+
+  bool CanIssueUnlocked() const {
+    if (please_close_ || eof_ || !read_status_.ok() || end_issued_) {
+      return false;
+    }
+    if (slots_.size() >= static_cast<size_t>(options_.readahead_queue_size)) {
+      return false;
+    }
+    // A stream can only be read sequentially
+    const int32_t max_outstanding = file_ ? options_.max_outstanding_reads : 1;
+    return outstanding_reads_ < max_outstanding;
+  }
+
+  // Issue reads until the queue is full or the memory budget is exhausted
+  void IssueReadsUnlocked() {
+    while (CanIssueUnlocked()) {
+      int64_t read_size = read_size_;
+      if (file_) {
+        read_size = std::min(read_size, file_size_ - next_offset_);
       }
-      // Fill up readahead queue until desired size
-      while (buffer_queue_.size() < static_cast<size_t>(readahead_queue_size_)) {
-        ReadaheadBuffer buf = {nullptr, left_padding_, right_padding_};
-        lock.unlock();
-        Status st = ReadOneBufferUnlocked(&buf);
-        lock.lock();
-        if (!st.ok()) {
-          read_status_ = st;
-          goto error;
-        }
-        // Close() could have been called while unlocked above
-        if (please_close_) {
-          goto eof;
-        }
-        // Got empty read?
-        if (buf.buffer->size() == buf.left_padding + buf.right_padding) {
-          goto eof;
-        }
-        buffer_queue_.push_back(std::move(buf));
-        io_progress_.notify_one();
+      const int64_t nbytes = read_size + left_padding_ + right_padding_;
+      // Always keep one block coming so as not to stall
+      if (!ReserveReadaheadMemory(nbytes, slots_.empty())) {
+        return;
+      }
+      std::unique_ptr<Slot> slot(new Slot());
+      slot->buffer = {nullptr, left_padding_, right_padding_};
+      slot->offset = next_offset_;
+      slot->read_size = read_size;
+      slot->data_size = 0;
+      slot->reserved = nbytes;
+      slot->done = false;
+      if (file_) {
+        next_offset_ += read_size;
+        end_issued_ = next_offset_ >= file_size_;
+      }
+
+      Slot* raw_slot = slot.get();
+      slots_.push_back(std::move(slot));
+      ++outstanding_reads_;
+      Status st = ::arrow::internal::GetIOThreadPool()->Spawn(
+          [this, raw_slot]() { ReadSlot(raw_slot); });
+      if (!st.ok()) {
+        --outstanding_reads_;
+        raw_slot->status = st;
+        raw_slot->done = true;
+        return;
       }
-      // Wait for Close() or Read() call
-      io_wakeup_.wait(lock);
     }
-  eof:
-    eof_ = true;
-  error:
-    // Make sure any pending Read() doesn't block indefinitely
-    io_progress_.notify_one();
   }
 
-  Status ReadOneBufferUnlocked(ReadaheadBuffer* buf) {
-    // Note that left_padding_ and right_padding_ may be modified while unlocked
+  // The I/O task for a block
+  void ReadSlot(Slot* slot) {
+    static const MemoryTag kReadaheadTag("io.readahead");
+    ScopedMemoryTag tag(kReadaheadTag);
+    auto start = std::chrono::steady_clock::now();
+    Status st = ReadOneBufferUnlocked(slot);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    slot->status = st;
+    slot->done = true;
+    --outstanding_reads_;
+    if (st.ok() && slot->data_size < slot->read_size) {
+      // Short read: end of stream
+      end_issued_ = true;
+    }
+    if (st.ok() && options_.adaptive) {
+      AdaptReadSizeUnlocked(slot->data_size, elapsed.count());
+    }
+    IssueReadsUnlocked();
+    io_progress_.notify_all();
+  }
+
+  // Size the next blocks so that reads take target_read_seconds at the
+  // observed throughput.  Larger blocks amortize per-read latency on slow
+  // storage, smaller ones bound memory and latency on fast storage.
+  void AdaptReadSizeUnlocked(int64_t nbytes, double seconds) {
+    static constexpr double kSmoothing = 0.5;
+    if (nbytes < read_size_ || seconds <= 0) {
+      // Short reads do not tell much about throughput
+      return;
+    }
+    const double throughput = static_cast<double>(nbytes) / seconds;
+    throughput_ = throughput_ > 0
+                      ? kSmoothing * throughput + (1 - kSmoothing) * throughput_
+                      : throughput;
+    int64_t target =
+        BitUtil::RoundUp(static_cast<int64_t>(throughput_ * options_.target_read_seconds),
+                         4096);
+    read_size_ =
+        std::max(options_.min_read_size, std::min(options_.max_read_size, target));
+  }
+
+  Status ReadOneBufferUnlocked(Slot* slot) {
+    ReadaheadBuffer* buf = &slot->buffer;
     std::shared_ptr<ResizableBuffer> buffer;
     int64_t bytes_read;
     RETURN_NOT_OK(AllocateResizableBuffer(
-        pool_, read_size_ + buf->left_padding + buf->right_padding, &buffer));
+        pool_, slot->read_size + buf->left_padding + buf->right_padding, &buffer));
     DCHECK_NE(buffer->mutable_data(), nullptr);
-    RETURN_NOT_OK(
-        raw_->Read(read_size_, &bytes_read, buffer->mutable_data() + buf->left_padding));
-    if (bytes_read < read_size_) {
+    uint8_t* data = buffer->mutable_data() + buf->left_padding;
+    if (file_) {
+      RETURN_NOT_OK(file_->ReadAt(slot->offset, slot->read_size, &bytes_read, data));
+    } else {
+      RETURN_NOT_OK(raw_->Read(slot->read_size, &bytes_read, data));
+    }
+    if (bytes_read < slot->read_size) {
       // Got a short read
       RETURN_NOT_OK(buffer->Resize(bytes_read + buf->left_padding + buf->right_padding));
       DCHECK_NE(buffer->mutable_data(), nullptr);
@@ -175,31 +311,53 @@ class ReadaheadSpooler::Impl {
     memset(buffer->mutable_data() + bytes_read + buf->left_padding, 0,
            buf->right_padding);
     buf->buffer = std::move(buffer);
+    slot->data_size = bytes_read;
     return Status::OK();
   }
 
   MemoryPool* pool_;
   std::shared_ptr<InputStream> raw_;
+  // Non-null if reading concurrently at explicit offsets
+  std::shared_ptr<RandomAccessFile> file_;
+  ReadaheadOptions options_;
   int64_t read_size_;
-  int32_t readahead_queue_size_;
   int64_t left_padding_ = 0;
   int64_t right_padding_ = 0;
+  int64_t next_offset_ = 0;
+  int64_t file_size_ = 0;
+  // Smoothed read throughput in bytes per second, 0 if unknown
+  double throughput_ = 0;
 
   std::mutex mutex_;
-  std::condition_variable io_wakeup_;
   std::condition_variable io_progress_;
-  std::thread io_worker_;
+  int32_t outstanding_reads_ = 0;
   bool please_close_ = false;
+  // Whether no more reads need to be issued
+  bool end_issued_ = false;
+  // Whether the consumer reached the end of the stream
   bool eof_ = false;
-  std::deque<ReadaheadBuffer> buffer_queue_;
+  std::deque<std::unique_ptr<Slot>> slots_;
   Status read_status_;
 };
 
+static ReadaheadOptions MakeReadaheadOptions(int64_t read_size,
+                                             int32_t readahead_queue_size,
+                                             int64_t left_padding,
+                                             int64_t right_padding) {
+  ReadaheadOptions options = ReadaheadOptions::Defaults();
+  options.read_size = read_size;
+  options.readahead_queue_size = readahead_queue_size;
+  options.left_padding = left_padding;
+  options.right_padding = right_padding;
+  return options;
+}
+
 ReadaheadSpooler::ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
                                    int64_t read_size, int32_t readahead_queue_size,
                                    int64_t left_padding, int64_t right_padding)
-    : impl_(new ReadaheadSpooler::Impl(pool, raw, read_size, readahead_queue_size,
-                                       left_padding, right_padding)) {}
+    : ReadaheadSpooler(pool, raw,
+                       MakeReadaheadOptions(read_size, readahead_queue_size,
+                                            left_padding, right_padding)) {}
 
 ReadaheadSpooler::ReadaheadSpooler(std::shared_ptr<InputStream> raw, int64_t read_size,
                                    int32_t readahead_queue_size, int64_t left_padding,
@@ -207,6 +365,10 @@ ReadaheadSpooler::ReadaheadSpooler(std::shared_ptr<InputStream> raw, int64_t rea
     : ReadaheadSpooler(default_memory_pool(), raw, read_size, readahead_queue_size,
                        left_padding, right_padding) {}
 
+ReadaheadSpooler::ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
+                                   const ReadaheadOptions& options)
+    : impl_(new ReadaheadSpooler::Impl(pool, raw, options)) {}
+
 int64_t ReadaheadSpooler::GetLeftPadding() { return impl_->left_padding(); }
 
 void ReadaheadSpooler::SetLeftPadding(int64_t size) { impl_->left_padding(size); }
@@ -215,12 +377,115 @@ int64_t ReadaheadSpooler::GetRightPadding() { return impl_->right_padding(); }
 
 void ReadaheadSpooler::SetRightPadding(int64_t size) { impl_->right_padding(size); }
 
+int64_t ReadaheadSpooler::GetReadSize() { return impl_->read_size(); }
+
 Status ReadaheadSpooler::Close() { return impl_->Close(); }
 
 Status ReadaheadSpooler::Read(ReadaheadBuffer* out) { return impl_->Read(out); }
 
 ReadaheadSpooler::~ReadaheadSpooler() {}
 
+// ----------------------------------------------------------------------
+// ReadaheadInputStream implementation
+
+ReadaheadInputStream::ReadaheadInputStream(MemoryPool* pool,
+                                           std::shared_ptr<InputStream> raw,
+                                           const ReadaheadOptions& options)
+    : spooler_(pool, raw, options),
+      pool_(pool),
+      block_pos_(0),
+      position_(0),
+      eof_(false),
+      closed_(false) {}
+
+ReadaheadInputStream::~ReadaheadInputStream() {}
+
+Status ReadaheadInputStream::Close() {
+  closed_ = true;
+  block_.reset();
+  return spooler_.Close();
+}
+
+bool ReadaheadInputStream::closed() const { return closed_; }
+
+Status ReadaheadInputStream::Tell(int64_t* position) const {
+  *position = position_;
+  return Status::OK();
+}
+
+Status ReadaheadInputStream::FillBlock() {
+  while (!eof_ && (!block_ || block_pos_ == block_->size())) {
+    ReadaheadBuffer rh;
+    RETURN_NOT_OK(spooler_.Read(&rh));
+    if (!rh.buffer) {
+      eof_ = true;
+      block_.reset();
+    } else {
+      block_ = SliceBuffer(rh.buffer, rh.left_padding,
+                           rh.buffer->size() - rh.left_padding - rh.right_padding);
+      block_pos_ = 0;
+    }
+  }
+  return Status::OK();
+}
+
+Status ReadaheadInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  if (closed_) {
+    return Status::Invalid("Operation on closed stream");
+  }
+  auto out_data = reinterpret_cast<uint8_t*>(out);
+  *bytes_read = 0;
+  while (*bytes_read < nbytes) {
+    RETURN_NOT_OK(FillBlock());
+    if (eof_) {
+      break;
+    }
+    const int64_t n = std::min(nbytes - *bytes_read, block_->size() - block_pos_);
+    std::memcpy(out_data + *bytes_read, block_->data() + block_pos_, n);
+    block_pos_ += n;
+    *bytes_read += n;
+  }
+  position_ += *bytes_read;
+  return Status::OK();
+}
+
+Status ReadaheadInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  if (closed_) {
+    return Status::Invalid("Operation on closed stream");
+  }
+  RETURN_NOT_OK(FillBlock());
+  if (eof_) {
+    *out = std::make_shared<Buffer>(nullptr, 0);
+    return Status::OK();
+  }
+  if (block_pos_ + nbytes <= block_->size()) {
+    // Zero-copy slice of the current block
+    *out = SliceBuffer(block_, block_pos_, nbytes);
+    block_pos_ += nbytes;
+    position_ += nbytes;
+    return Status::OK();
+  }
+  // The range spans several blocks
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+  int64_t bytes_read;
+  RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+  if (bytes_read < nbytes) {
+    RETURN_NOT_OK(buffer->Resize(bytes_read));
+  }
+  *out = buffer;
+  return Status::OK();
+}
+
+util::string_view ReadaheadInputStream::Peek(int64_t nbytes) const {
+  if (!block_) {
+    return util::string_view();
+  }
+  const int64_t n = std::min(nbytes, block_->size() - block_pos_);
+  return util::string_view(reinterpret_cast<const char*>(block_->data() + block_pos_),
+                           static_cast<size_t>(n));
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
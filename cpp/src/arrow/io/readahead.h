@@ -21,17 +21,57 @@
 #include <cstdint>
 #include <memory>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
+class Buffer;
 class MemoryPool;
 class ResizableBuffer;
 class Status;
 
 namespace io {
 
-class InputStream;
+/// \brief EXPERIMENTAL: Options for reading ahead of a consumer
+///
+/// Reads are issued on the global I/O thread pool. Several reads can only be
+/// in flight at once if the input is a RandomAccessFile, whose ReadAt is then
+/// called concurrently; other streams are read one block at a time.
+struct ARROW_EXPORT ReadaheadOptions {
+  /// Size of the blocks read, or of the first block if adaptive
+  int64_t read_size = 1 << 20;
+  /// Maximum number of blocks read ahead, including reads in flight
+  int32_t readahead_queue_size = 1;
+  /// Maximum number of reads in flight (random access inputs only)
+  int32_t max_outstanding_reads = 1;
+
+  /// Whether to adapt the block size to the observed read throughput, so that
+  /// each read takes about target_read_seconds
+  bool adaptive = false;
+  int64_t min_read_size = 64 * 1024;
+  int64_t max_read_size = 64 << 20;
+  double target_read_seconds = 0.1;
+
+  /// Zeroed bytes at the beginning and end of each returned buffer
+  int64_t left_padding = 0;
+  int64_t right_padding = 0;
+
+  static ReadaheadOptions Defaults();
+};
+
+/// \brief Set the maximum number of bytes read ahead and not yet consumed,
+/// shared by all readahead spoolers of the process
+///
+/// A spooler always keeps at least one read going, even over the limit, so that
+/// it cannot stall. The default limit is 256 MB.
+ARROW_EXPORT void SetReadaheadMemoryLimit(int64_t nbytes);
+
+/// \brief Return the readahead memory limit
+ARROW_EXPORT int64_t GetReadaheadMemoryLimit();
+
+/// \brief Return the number of bytes currently read ahead by all spoolers
+ARROW_EXPORT int64_t GetReadaheadMemoryUsage();
 
 namespace internal {
 
@@ -45,8 +85,8 @@ class ARROW_EXPORT ReadaheadSpooler {
  public:
   /// \brief EXPERIMENTAL: Create a readahead spooler wrapping the given input stream.
   ///
-  /// The spooler launches a background thread that reads up to a given number
-  /// of fixed-size blocks in advance from the underlying stream.
+  /// The spooler reads up to a given number of fixed-size blocks in advance
+  /// from the underlying stream, on the global I/O thread pool.
   /// The buffers returned by Read() will be padded at the beginning and the end
   /// with the configured amount of (zeroed) bytes.
   ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
@@ -58,6 +98,10 @@ class ARROW_EXPORT ReadaheadSpooler {
                             int32_t readahead_queue_size = 1, int64_t left_padding = 0,
                             int64_t right_padding = 0);
 
+  /// \brief EXPERIMENTAL: Create a readahead spooler with the given options
+  ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
+                   const ReadaheadOptions& options);
+
   ~ReadaheadSpooler();
 
   /// Configure zero-padding at beginning and end of buffers (default 0 bytes).
@@ -78,12 +122,16 @@ class ARROW_EXPORT ReadaheadSpooler {
   ///
   /// If the buffer pointer in the ReadaheadBuffer is null, then EOF was
   /// reached and/or the spooler was explicitly closed.
-  /// Otherwise, the buffer will contain at most read_size bytes in addition
-  /// to the configured padding (short reads are possible at the end of a file).
+  /// Otherwise, the buffer will contain at most read_size bytes (the current
+  /// block size, if adaptive) in addition to the configured padding (short
+  /// reads are possible at the end of a file).
   // How do we allow reusing the buffer in ReadaheadBuffer? perhaps by using
   // a caching memory pool?
   Status Read(ReadaheadBuffer* out);
 
+  /// \brief The size of the next blocks to be read
+  int64_t GetReadSize();
+
  private:
   static constexpr int64_t kDefaultReadSize = 1 << 20;  // 1 MB
 
@@ -91,6 +139,39 @@ class ARROW_EXPORT ReadaheadSpooler {
   std::unique_ptr<Impl> impl_;
 };
 
+/// \class ReadaheadInputStream
+/// \brief An InputStream reading ahead of its consumer with a ReadaheadSpooler
+///
+/// Reads within a block return zero-copy slices of it.
+class ARROW_EXPORT ReadaheadInputStream : public InputStream {
+ public:
+  ReadaheadInputStream(MemoryPool* pool, std::shared_ptr<InputStream> raw,
+                       const ReadaheadOptions& options);
+  ~ReadaheadInputStream() override;
+
+  Status Close() override;
+  bool closed() const override;
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  util::string_view Peek(int64_t nbytes) const override;
+  bool supports_zero_copy() const override { return true; }
+
+ private:
+  // Make sure the current block has unread bytes, unless at EOF
+  Status FillBlock();
+
+  ReadaheadSpooler spooler_;
+  MemoryPool* pool_;
+  std::shared_ptr<Buffer> block_;
+  int64_t block_pos_;
+  int64_t position_;
+  bool eof_;
+  bool closed_;
+};
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
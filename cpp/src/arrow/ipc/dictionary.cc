@@ -18,15 +18,141 @@
 #include "arrow/ipc/dictionary.h"
 
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace ipc {
 
+namespace {
+
+void AppendValidity(const Array& array, int64_t dest_offset, uint8_t* dest) {
+  if (array.null_bitmap_data() == NULLPTR) {
+    BitUtil::SetBitsTo(dest, dest_offset, array.length(), true);
+  } else {
+    internal::CopyBitmap(array.null_bitmap_data(), array.offset(), array.length(), dest,
+                         dest_offset);
+  }
+}
+
+Status ConcatenateFixedWidth(const Array& left, const Array& right, MemoryPool* pool,
+                             std::shared_ptr<Buffer>* out) {
+  const int bit_width = checked_cast<const FixedWidthType&>(*left.type()).bit_width();
+  const int64_t length = left.length() + right.length();
+  if (bit_width == 1) {
+    RETURN_NOT_OK(AllocateBitmap(pool, length, out));
+    uint8_t* dest = (*out)->mutable_data();
+    internal::CopyBitmap(left.data()->buffers[1]->data(), left.offset(), left.length(),
+                         dest, 0);
+    internal::CopyBitmap(right.data()->buffers[1]->data(), right.offset(),
+                         right.length(), dest, left.length());
+    return Status::OK();
+  }
+
+  const int64_t byte_width = bit_width / 8;
+  RETURN_NOT_OK(AllocateBuffer(pool, length * byte_width, out));
+  uint8_t* dest = (*out)->mutable_data();
+  if (left.length() > 0) {
+    memcpy(dest, left.data()->buffers[1]->data() + left.offset() * byte_width,
+           left.length() * byte_width);
+  }
+  if (right.length() > 0) {
+    memcpy(dest + left.length() * byte_width,
+           right.data()->buffers[1]->data() + right.offset() * byte_width,
+           right.length() * byte_width);
+  }
+  return Status::OK();
+}
+
+Status ConcatenateBinary(const BinaryArray& left, const BinaryArray& right,
+                         MemoryPool* pool, std::shared_ptr<Buffer>* out_offsets,
+                         std::shared_ptr<Buffer>* out_data) {
+  const int64_t length = left.length() + right.length();
+  const int32_t left_start = left.value_offset(0);
+  const int32_t left_size = left.value_offset(left.length()) - left_start;
+  const int32_t right_start = right.value_offset(0);
+  const int32_t right_size = right.value_offset(right.length()) - right_start;
+  if (static_cast<int64_t>(left_size) + right_size >
+      std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Concatenated dictionary too large for 32-bit offsets");
+  }
+
+  RETURN_NOT_OK(AllocateBuffer(pool, (length + 1) * sizeof(int32_t), out_offsets));
+  auto offsets = reinterpret_cast<int32_t*>((*out_offsets)->mutable_data());
+  for (int64_t i = 0; i < left.length(); ++i) {
+    offsets[i] = left.value_offset(i) - left_start;
+  }
+  for (int64_t i = 0; i <= right.length(); ++i) {
+    offsets[left.length() + i] = right.value_offset(i) - right_start + left_size;
+  }
+
+  RETURN_NOT_OK(AllocateBuffer(pool, left_size + right_size, out_data));
+  uint8_t* dest = (*out_data)->mutable_data();
+  if (left_size > 0) {
+    memcpy(dest, left.value_data()->data() + left_start, left_size);
+  }
+  if (right_size > 0) {
+    memcpy(dest + left_size, right.value_data()->data() + right_start, right_size);
+  }
+  return Status::OK();
+}
+
+// Append the values of a delta dictionary to an existing dictionary. Only the
+// flat types that are commonly dictionary-encoded are supported
+Status ConcatenateDictionary(const Array& dictionary, const Array& delta,
+                             MemoryPool* pool, std::shared_ptr<Array>* out) {
+  if (!dictionary.type()->Equals(*delta.type())) {
+    return Status::Invalid("Delta dictionary type ", delta.type()->ToString(),
+                           " does not match dictionary type ",
+                           dictionary.type()->ToString());
+  }
+
+  const auto& type = dictionary.type();
+  const int64_t length = dictionary.length() + delta.length();
+  const int64_t null_count = dictionary.null_count() + delta.null_count();
+  std::vector<std::shared_ptr<Buffer>> buffers(1);
+  if (null_count > 0) {
+    RETURN_NOT_OK(AllocateBitmap(pool, length, &buffers[0]));
+    AppendValidity(dictionary, 0, buffers[0]->mutable_data());
+    AppendValidity(delta, dictionary.length(), buffers[0]->mutable_data());
+  }
+
+  if (is_binary_like(type->id())) {
+    buffers.resize(3);
+    RETURN_NOT_OK(ConcatenateBinary(checked_cast<const BinaryArray&>(dictionary),
+                                    checked_cast<const BinaryArray&>(delta), pool,
+                                    &buffers[1], &buffers[2]));
+  } else if ((is_primitive(type->id()) && type->id() != Type::NA) ||
+             type->id() == Type::FIXED_SIZE_BINARY || type->id() == Type::DECIMAL) {
+    buffers.resize(2);
+    RETURN_NOT_OK(ConcatenateFixedWidth(dictionary, delta, pool, &buffers[1]));
+  } else {
+    return Status::NotImplemented("Delta dictionaries of type ", type->ToString(),
+                                  " are not supported");
+  }
+
+  *out = MakeArray(ArrayData::Make(type, length, std::move(buffers), null_count));
+  return Status::OK();
+}
+
+}  // namespace
+
 DictionaryMemo::DictionaryMemo() {}
 
 // Returns KeyError if dictionary not found
@@ -76,5 +202,26 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+Status DictionaryMemo::UpdateDictionary(int64_t id,
+                                        const std::shared_ptr<Array>& dictionary) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("Dictionary with id ", id, " not found");
+  }
+  dictionary_to_id_.erase(reinterpret_cast<intptr_t>(it->second.get()));
+  it->second = dictionary;
+  dictionary_to_id_[reinterpret_cast<intptr_t>(dictionary.get())] = id;
+  return Status::OK();
+}
+
+Status DictionaryMemo::AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                                          MemoryPool* pool) {
+  std::shared_ptr<Array> dictionary;
+  RETURN_NOT_OK(GetDictionary(id, &dictionary));
+  std::shared_ptr<Array> combined;
+  RETURN_NOT_OK(ConcatenateDictionary(*dictionary, *delta, pool, &combined));
+  return UpdateDictionary(id, combined);
+}
+
 }  // namespace ipc
 }  // namespace arrow
@@ -725,27 +725,77 @@ static Status WriteBuffers(FBB& fbb, const std::vector<BufferMetadata>& buffers,
   return Status::OK();
 }
 
+static Status WriteBodyCompression(FBB& fbb, Compression::type compression,
+                                   flatbuffers::Offset<flatbuf::BodyCompression>* out) {
+  flatbuf::CompressionType codec;
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      // No compression metadata is written
+      *out = 0;
+      return Status::OK();
+    case Compression::LZ4:
+      codec = flatbuf::CompressionType_LZ4;
+      break;
+    case Compression::ZSTD:
+      codec = flatbuf::CompressionType_ZSTD;
+      break;
+    default:
+      return Status::Invalid("Unsupported IPC body compression codec: ", compression);
+  }
+  *out =
+      flatbuf::CreateBodyCompression(fbb, codec, flatbuf::BodyCompressionMethod_BUFFER);
+  return Status::OK();
+}
+
 static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               RecordBatchOffset* offset) {
   FieldNodeVector fb_nodes;
   BufferVector fb_buffers;
+  flatbuffers::Offset<flatbuf::BodyCompression> fb_compression;
 
   RETURN_NOT_OK(WriteFieldNodes(fbb, nodes, &fb_nodes));
   RETURN_NOT_OK(WriteBuffers(fbb, buffers, &fb_buffers));
+  RETURN_NOT_OK(WriteBodyCompression(fbb, compression, &fb_compression));
+
+  *offset =
+      flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers, fb_compression);
+  return Status::OK();
+}
 
-  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers);
+Status GetCompression(const flatbuf::RecordBatch* batch, Compression::type* out) {
+  const flatbuf::BodyCompression* compression = batch->compression();
+  if (compression == nullptr) {
+    *out = Compression::UNCOMPRESSED;
+    return Status::OK();
+  }
+  if (compression->method() != flatbuf::BodyCompressionMethod_BUFFER) {
+    return Status::Invalid("Only buffer-level IPC body compression is supported");
+  }
+  switch (compression->codec()) {
+    case flatbuf::CompressionType_LZ4:
+      *out = Compression::LZ4;
+      break;
+    case flatbuf::CompressionType_ZSTD:
+      *out = Compression::ZSTD;
+      break;
+    default:
+      return Status::Invalid("Unrecognized IPC body compression codec");
+  }
   return Status::OK();
 }
 
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+                                &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
                         body_length, out);
 }
@@ -883,14 +933,18 @@ Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_
                         fb_sparse_tensor.Union(), body_length, out);
 }
 
-Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
+Status WriteDictionaryMessage(int64_t id, bool is_delta, int64_t length,
+                              int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+                                &record_batch));
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
                         body_length, out);
 }
@@ -1084,8 +1138,12 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
 // ----------------------------------------------------------------------
 // Implement message writing
 
-Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream* file,
-                    int32_t* message_length) {
+Status AppendMessageSpans(const Buffer& message, int32_t alignment, int32_t* prefix,
+                          std::vector<io::BufferSpan>* spans, int32_t* message_length) {
+  if (alignment <= 0 || alignment > kArrowAlignment) {
+    return Status::Invalid("Invalid message alignment: ", alignment);
+  }
+
   // ARROW-3212: We do not make assumptions that the output stream is aligned
   int32_t padded_message_length = static_cast<int32_t>(message.size()) + 4;
   const int32_t remainder = padded_message_length % alignment;
@@ -1097,22 +1155,30 @@ Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream*
   // plus padding
   *message_length = padded_message_length;
 
-  // Write the flatbuffer size prefix including padding
-  int32_t flatbuffer_size = padded_message_length - 4;
-  RETURN_NOT_OK(file->Write(&flatbuffer_size, sizeof(int32_t)));
+  // The flatbuffer size prefix including padding
+  *prefix = padded_message_length - 4;
+  spans->push_back({prefix, sizeof(int32_t)});
 
-  // Write the flatbuffer
-  RETURN_NOT_OK(file->Write(message.data(), message.size()));
+  // The flatbuffer
+  spans->push_back({message.data(), message.size()});
 
-  // Write any padding
+  // Any padding, from the shared zero bytes
   int32_t padding = padded_message_length - static_cast<int32_t>(message.size()) - 4;
   if (padding > 0) {
-    RETURN_NOT_OK(file->Write(kPaddingBytes, padding));
+    spans->push_back({kPaddingBytes, padding});
   }
 
   return Status::OK();
 }
 
+Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream* file,
+                    int32_t* message_length) {
+  int32_t prefix;
+  std::vector<io::BufferSpan> spans;
+  RETURN_NOT_OK(AppendMessageSpans(message, alignment, &prefix, &spans, message_length));
+  return file->WriteSpans(spans);
+}
+
 }  // namespace internal
 }  // namespace ipc
 }  // namespace arrow
@@ -29,12 +29,14 @@
 #include <flatbuffers/flatbuffers.h>
 
 #include "arrow/buffer.h"
+#include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/Schema_generated.h"
 #include "arrow/ipc/dictionary.h"  // IYWU pragma: keep
 #include "arrow/ipc/message.h"
 #include "arrow/memory_pool.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 
@@ -48,6 +50,7 @@ namespace flatbuf = org::apache::arrow::flatbuf;
 namespace io {
 
 class OutputStream;
+struct BufferSpan;
 
 }  // namespace io
 
@@ -101,6 +104,10 @@ Status GetDictionaryTypes(const void* opaque_schema, DictionaryTypeMap* id_to_fi
 Status GetSchema(const void* opaque_schema, const DictionaryMemo& dictionary_memo,
                  std::shared_ptr<Schema>* out);
 
+// Retrieve the codec used to compress the body buffers of a record batch,
+// Compression::UNCOMPRESSED if the body is not compressed
+Status GetCompression(const flatbuf::RecordBatch* batch, Compression::type* out);
+
 Status GetTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type,
                          std::vector<int64_t>* shape, std::vector<int64_t>* strides,
                          std::vector<std::string>* dim_names);
@@ -127,6 +134,20 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
 Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream* file,
                     int32_t* message_length);
 
+/// Append the spans of an encapsulated message, as written by WriteMessage, to
+/// a list of spans for a vectored write
+///
+/// \param[in] message a buffer containing the metadata to write
+/// \param[in] alignment the size multiple of the total message size, at most
+/// kArrowAlignment
+/// \param[out] prefix storage for the length prefix; must stay alive until the
+/// spans are written
+/// \param[in,out] spans the spans to append to
+/// \param[out] message_length the total size of the message including padding
+/// \return Status
+Status AppendMessageSpans(const Buffer& message, int32_t alignment, int32_t* prefix,
+                          std::vector<io::BufferSpan>* spans, int32_t* message_length);
+
 // Serialize arrow::Schema as a Flatbuffer
 //
 // \param[in] schema a Schema instance
@@ -140,6 +161,7 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out);
 
 Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
@@ -153,10 +175,11 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
                        const std::vector<FileBlock>& record_batches,
                        DictionaryMemo* dictionary_memo, io::OutputStream* out);
 
-Status WriteDictionaryMessage(const int64_t id, const int64_t length,
-                              const int64_t body_length,
+Status WriteDictionaryMessage(const int64_t id, const bool is_delta,
+                              const int64_t length, const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out);
 
 static inline Status WriteFlatbufferBuilder(flatbuffers::FlatBufferBuilder& fbb,
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Options for reading and writing Arrow IPC messages
+
+#ifndef ARROW_IPC_OPTIONS_H
+#define ARROW_IPC_OPTIONS_H
+
+#include "arrow/ipc/message.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ipc {
+
+/// \brief Options for writing Arrow IPC messages
+struct ARROW_EXPORT IpcOptions {
+  /// \brief If true, allow field lengths that don't fit in a signed 32-bit
+  /// int. Such files may not be readable by other Arrow implementations
+  bool allow_64bit = false;
+
+  /// \brief The maximum permitted schema nesting depth
+  int max_recursion_depth = kMaxNestingDepth;
+
+  /// \brief EXPERIMENTAL: Codec used to compress each body buffer of record
+  /// batch and dictionary messages. Only Compression::UNCOMPRESSED,
+  /// Compression::LZ4 and Compression::ZSTD are supported by the IPC format
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// \brief Use the global CPU thread pool to compress body buffers in
+  /// parallel
+  bool use_threads = true;
+
+  /// \brief If true, the stream writer sends a dictionary that extends the one
+  /// previously sent for the same field as a delta dictionary batch holding
+  /// only the new values. Otherwise any dictionary change is sent as a
+  /// replacement dictionary batch
+  bool emit_dictionary_deltas = false;
+
+  static IpcOptions Defaults();
+};
+
+}  // namespace ipc
+}  // namespace arrow
+
+#endif  // ARROW_IPC_OPTIONS_H
@@ -29,6 +29,7 @@
 #include "arrow/builder.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/readahead.h"
 #include "arrow/io/test-common.h"
 #include "arrow/ipc/Message_generated.h"  // IWYU pragma: keep
 #include "arrow/ipc/message.h"
@@ -45,6 +46,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
@@ -575,13 +577,11 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
   }
   void TearDown() {}
 
-  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches) {
-    // Write the file
+  Status WriteFile(const BatchVector& in_batches,
+                   std::shared_ptr<RecordBatchFileReader>* reader) {
     std::shared_ptr<RecordBatchWriter> writer;
-    RETURN_NOT_OK(
-        RecordBatchFileWriter::Open(sink_.get(), in_batches[0]->schema(), &writer));
-
-    const int num_batches = static_cast<int>(in_batches.size());
+    RETURN_NOT_OK(RecordBatchFileWriter::Open(sink_.get(), in_batches[0]->schema(),
+                                              options_, &writer));
 
     for (const auto& batch : in_batches) {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
@@ -595,9 +595,14 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
 
     // Open the file
     auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
+    return RecordBatchFileReader::Open(buf_reader, footer_offset, reader);
+  }
+
+  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches) {
     std::shared_ptr<RecordBatchFileReader> reader;
-    RETURN_NOT_OK(RecordBatchFileReader::Open(buf_reader.get(), footer_offset, &reader));
+    RETURN_NOT_OK(WriteFile(in_batches, &reader));
 
+    const int num_batches = static_cast<int>(in_batches.size());
     EXPECT_EQ(num_batches, reader->num_record_batches());
     for (int i = 0; i < num_batches; ++i) {
       std::shared_ptr<RecordBatch> chunk;
@@ -610,6 +615,7 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
 
  protected:
   MemoryPool* pool_;
+  IpcOptions options_;
 
   std::unique_ptr<io::BufferOutputStream> sink_;
   std::shared_ptr<ResizableBuffer> buffer_;
@@ -632,6 +638,39 @@ TEST_P(TestFileFormat, RoundTrip) {
   }
 }
 
+TEST_P(TestFileFormat, ReadRecordBatches) {
+  BatchVector in_batches;
+  for (int i = 0; i < 5; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+    in_batches.push_back(batch);
+  }
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteFile(in_batches, &reader));
+
+  for (bool use_threads : {false, true}) {
+    BatchVector out_batches;
+    ASSERT_OK(reader->ReadRecordBatches(0, 5, &out_batches, use_threads));
+    ASSERT_EQ(5, static_cast<int>(out_batches.size()));
+    for (size_t i = 0; i < out_batches.size(); ++i) {
+      CompareBatch(*in_batches[i], *out_batches[i]);
+    }
+
+    // Non-contiguous, unordered selection
+    out_batches.clear();
+    ASSERT_OK(reader->ReadRecordBatches({4, 0, 2}, &out_batches, use_threads));
+    ASSERT_EQ(3, static_cast<int>(out_batches.size()));
+    CompareBatch(*in_batches[4], *out_batches[0]);
+    CompareBatch(*in_batches[0], *out_batches[1]);
+    CompareBatch(*in_batches[2], *out_batches[2]);
+  }
+
+  BatchVector out_batches;
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatches({0, 5}, &out_batches));
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatches(3, 3, &out_batches));
+}
+
 class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
  public:
   void SetUp() {
@@ -641,11 +680,12 @@ class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
   }
   void TearDown() {}
 
-  Status RoundTripHelper(const BatchVector& batches, BatchVector* out_batches) {
+  Status RoundTripHelper(const BatchVector& batches, BatchVector* out_batches,
+                         const io::ReadaheadOptions* readahead = nullptr) {
     // Write the file
     std::shared_ptr<RecordBatchWriter> writer;
-    RETURN_NOT_OK(
-        RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+    RETURN_NOT_OK(RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(),
+                                                options_, &writer));
 
     for (const auto& batch : batches) {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
@@ -654,15 +694,20 @@ class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
     RETURN_NOT_OK(sink_->Close());
 
     // Open the file
-    io::BufferReader buf_reader(buffer_);
+    auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
 
     std::shared_ptr<RecordBatchReader> reader;
-    RETURN_NOT_OK(RecordBatchStreamReader::Open(&buf_reader, &reader));
+    if (readahead != nullptr) {
+      RETURN_NOT_OK(RecordBatchStreamReader::Open(buf_reader, *readahead, &reader));
+    } else {
+      RETURN_NOT_OK(RecordBatchStreamReader::Open(buf_reader.get(), &reader));
+    }
     return reader->ReadAll(out_batches);
   }
 
  protected:
   MemoryPool* pool_;
+  IpcOptions options_;
 
   std::unique_ptr<io::BufferOutputStream> sink_;
   std::shared_ptr<ResizableBuffer> buffer_;
@@ -682,6 +727,23 @@ TEST_P(TestStreamFormat, RoundTrip) {
   }
 }
 
+TEST_P(TestStreamFormat, RoundTripWithReadahead) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  // Small blocks so that messages span several of them
+  io::ReadaheadOptions readahead = io::ReadaheadOptions::Defaults();
+  readahead.read_size = 100;
+  readahead.readahead_queue_size = 4;
+
+  BatchVector out_batches;
+  ASSERT_OK(RoundTripHelper({batch, batch, batch}, &out_batches, &readahead));
+  ASSERT_EQ(out_batches.size(), 3);
+  for (size_t i = 0; i < out_batches.size(); ++i) {
+    CompareBatch(*batch, *out_batches[i]);
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(FileRoundTripTests, TestFileFormat, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(StreamRoundTripTests, TestStreamFormat, BATCH_CASES());
@@ -768,6 +830,274 @@ TEST_F(TestFileFormat, DictionaryRoundTrip) {
   CheckBatchDictionaries(*out_batches[0]);
 }
 
+// Batch with a single dictionary-encoded string column
+std::shared_ptr<RecordBatch> MakeStringDictionaryBatch(
+    const std::vector<std::string>& dictionary_values,
+    const std::vector<int32_t>& index_values) {
+  std::shared_ptr<Array> dictionary, indices;
+  ArrayFromVector<StringType, std::string>(dictionary_values, &dictionary);
+  ArrayFromVector<Int32Type, int32_t>(index_values, &indices);
+  auto type = arrow::dictionary(int32(), dictionary);
+  auto array = std::make_shared<DictionaryArray>(type, indices);
+  return RecordBatch::Make(schema({field("f0", type)}), array->length(), {array});
+}
+
+class TestDictionaryUpdates : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(AllocateResizableBuffer(default_memory_pool(), 0, &buffer_));
+    sink_.reset(new io::BufferOutputStream(buffer_));
+  }
+
+  Status WriteStream(const BatchVector& batches, const IpcOptions& options) {
+    std::shared_ptr<RecordBatchWriter> writer;
+    RETURN_NOT_OK(RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(),
+                                                options, &writer));
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    return sink_->Close();
+  }
+
+  Status ReadStream(BatchVector* out_batches) {
+    io::BufferReader buf_reader(buffer_);
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(RecordBatchStreamReader::Open(&buf_reader, &reader));
+    return reader->ReadAll(out_batches);
+  }
+
+  // Return the isDelta flag of each dictionary batch in the stream
+  void GetDictionaryBatches(std::vector<bool>* is_delta) {
+    io::BufferReader buf_reader(buffer_);
+    auto message_reader = MessageReader::Open(&buf_reader);
+    std::unique_ptr<Message> message;
+    while (true) {
+      ASSERT_OK(message_reader->ReadNextMessage(&message));
+      if (message == nullptr) {
+        break;
+      }
+      if (message->type() == Message::DICTIONARY_BATCH) {
+        auto fb_message = flatbuf::GetMessage(message->metadata()->data());
+        auto fb_dictionary =
+            reinterpret_cast<const flatbuf::DictionaryBatch*>(fb_message->header());
+        is_delta->push_back(fb_dictionary->isDelta());
+      }
+    }
+  }
+
+ protected:
+  std::unique_ptr<io::BufferOutputStream> sink_;
+  std::shared_ptr<ResizableBuffer> buffer_;
+};
+
+TEST_F(TestDictionaryUpdates, Replacement) {
+  BatchVector batches = {MakeStringDictionaryBatch({"foo", "bar"}, {0, 1, 1}),
+                         MakeStringDictionaryBatch({"baz", "qux"}, {1, 0}),
+                         MakeStringDictionaryBatch({"baz", "qux", "quux"}, {2, 0})};
+  ASSERT_OK(WriteStream(batches, IpcOptions::Defaults()));
+
+  std::vector<bool> is_delta;
+  GetDictionaryBatches(&is_delta);
+  ASSERT_EQ(std::vector<bool>({false, false, false}), is_delta);
+
+  BatchVector out_batches;
+  ASSERT_OK(ReadStream(&out_batches));
+  ASSERT_EQ(3, static_cast<int>(out_batches.size()));
+  for (size_t i = 0; i < batches.size(); ++i) {
+    CompareBatch(*batches[i], *out_batches[i]);
+  }
+}
+
+TEST_F(TestDictionaryUpdates, Deltas) {
+  BatchVector batches = {MakeStringDictionaryBatch({"foo", "bar"}, {0, 1, 1}),
+                         MakeStringDictionaryBatch({"foo", "bar", "baz"}, {2, 0}),
+                         MakeStringDictionaryBatch({"foo", "bar", "baz"}, {1, 1}),
+                         MakeStringDictionaryBatch({"foo", "bar", "baz", "qux"}, {3}),
+                         MakeStringDictionaryBatch({"qux"}, {0, 0})};
+  auto options = IpcOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  ASSERT_OK(WriteStream(batches, options));
+
+  // Schema dictionary, two deltas, then a replacement when the new dictionary
+  // does not extend the previous one
+  std::vector<bool> is_delta;
+  GetDictionaryBatches(&is_delta);
+  ASSERT_EQ(std::vector<bool>({false, true, true, false}), is_delta);
+
+  BatchVector out_batches;
+  ASSERT_OK(ReadStream(&out_batches));
+  ASSERT_EQ(5, static_cast<int>(out_batches.size()));
+  for (size_t i = 0; i < batches.size(); ++i) {
+    CompareBatch(*batches[i], *out_batches[i]);
+  }
+}
+
+TEST_F(TestDictionaryUpdates, FileFormatRejectsReplacement) {
+  auto batch1 = MakeStringDictionaryBatch({"foo", "bar"}, {0, 1});
+  auto batch2 = MakeStringDictionaryBatch({"foo", "bar"}, {1, 1});
+  auto batch3 = MakeStringDictionaryBatch({"baz"}, {0});
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batch1->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch1));
+  // Equal dictionary values in a different array are accepted
+  ASSERT_OK(writer->WriteRecordBatch(*batch2));
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch3));
+}
+
+void CheckCompressedRoundTrip(Compression::type compression) {
+  std::vector<MakeRecordBatch*> cases = {&MakeIntRecordBatch,
+                                         &MakeStringTypesRecordBatchWithNulls,
+                                         &MakeListRecordBatch, &MakeStruct,
+                                         &MakeDictionary};
+  for (auto make_batch : cases) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(make_batch(&batch));
+
+    for (bool use_threads : {false, true}) {
+      IpcOptions options;
+      options.compression = compression;
+      options.use_threads = use_threads;
+
+      std::shared_ptr<ResizableBuffer> buffer;
+      ASSERT_OK(AllocateResizableBuffer(0, &buffer));
+      io::BufferOutputStream sink(buffer);
+      std::shared_ptr<RecordBatchWriter> writer;
+      ASSERT_OK(RecordBatchStreamWriter::Open(&sink, batch->schema(), options, &writer));
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+      ASSERT_OK(writer->Close());
+      ASSERT_OK(sink.Close());
+
+      io::BufferReader source(buffer);
+      std::shared_ptr<RecordBatchReader> reader;
+      ASSERT_OK(RecordBatchStreamReader::Open(&source, &reader));
+      BatchVector out_batches;
+      ASSERT_OK(reader->ReadAll(&out_batches));
+      ASSERT_EQ(2, static_cast<int>(out_batches.size()));
+      for (const auto& out_batch : out_batches) {
+        CompareBatch(*batch, *out_batch);
+      }
+    }
+  }
+}
+
+TEST(TestIpcCompression, CompressedBufferLayout) {
+#ifdef ARROW_WITH_ZSTD
+  // Highly compressible column
+  std::vector<int64_t> values(10000, 42);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>(values, &array);
+  auto batch =
+      RecordBatch::Make(schema({field("f0", int64())}), array->length(), {array});
+
+  IpcOptions options;
+  options.compression = Compression::ZSTD;
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ASSERT_OK(AllocateResizableBuffer(0, &buffer));
+  io::BufferOutputStream sink(buffer);
+  int32_t metadata_length;
+  int64_t body_length;
+  ASSERT_OK(WriteRecordBatch(*batch, 0, &sink, &metadata_length, &body_length, options,
+                             default_memory_pool()));
+  ASSERT_LT(body_length, array->length() * static_cast<int64_t>(sizeof(int64_t)) / 10);
+
+  std::unique_ptr<Message> message;
+  io::BufferReader source(buffer);
+  ASSERT_OK(ReadMessage(&source, &message));
+  auto fb_message = flatbuf::GetMessage(message->metadata()->data());
+  auto fb_batch = reinterpret_cast<const flatbuf::RecordBatch*>(fb_message->header());
+  Compression::type compression;
+  ASSERT_OK(internal::GetCompression(fb_batch, &compression));
+  ASSERT_EQ(Compression::ZSTD, compression);
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(ReadRecordBatch(*message, batch->schema(), &result));
+  CompareBatch(*batch, *result);
+#endif
+}
+
+TEST(TestIpcCompression, UnsupportedCodec) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  IpcOptions options;
+  options.compression = Compression::BROTLI;
+  io::MockOutputStream sink;
+  int32_t metadata_length;
+  int64_t body_length;
+  ASSERT_RAISES(Invalid, WriteRecordBatch(*batch, 0, &sink, &metadata_length,
+                                          &body_length, options, default_memory_pool()));
+}
+
+#ifdef ARROW_WITH_LZ4
+TEST(TestIpcCompression, LZ4RoundTrip) { CheckCompressedRoundTrip(Compression::LZ4); }
+#endif
+
+#ifdef ARROW_WITH_ZSTD
+TEST(TestIpcCompression, ZSTDRoundTrip) { CheckCompressedRoundTrip(Compression::ZSTD); }
+
+TEST(TestIpcCompression, ReaderPoolAndThreads) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeStringTypesRecordBatchWithNulls(&batch));
+
+  IpcOptions options;
+  options.compression = Compression::ZSTD;
+  std::shared_ptr<ResizableBuffer> buffer;
+  ASSERT_OK(AllocateResizableBuffer(0, &buffer));
+  io::BufferOutputStream sink(buffer);
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(&sink, batch->schema(), options, &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink.Close());
+
+  auto ReadStream = [&buffer](MemoryPool* pool, BatchVector* out) -> Status {
+    io::BufferReader source(buffer);
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(RecordBatchStreamReader::Open(MessageReader::Open(&source), pool,
+                                                &reader));
+    return reader->ReadAll(out);
+  };
+
+  // The decompressed buffers are allocated from the reader's pool
+  ProxyMemoryPool pool(default_memory_pool());
+  BatchVector out_batches;
+  ASSERT_OK(ReadStream(&pool, &out_batches));
+  ASSERT_EQ(1, static_cast<int>(out_batches.size()));
+  CompareBatch(*batch, *out_batches[0]);
+  ASSERT_GT(pool.bytes_allocated(), 0);
+  out_batches.clear();
+  ASSERT_EQ(0, pool.bytes_allocated());
+
+  // Reading from a task of the CPU pool does not wait on other tasks, which
+  // would never run with a single worker
+  const int capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(1));
+  auto fut = ::arrow::internal::GetCpuThreadPool()->Submit(
+      ReadStream, default_memory_pool(), &out_batches);
+  ASSERT_OK(fut.get());
+  ASSERT_OK(SetCpuThreadPoolCapacity(capacity));
+  CompareBatch(*batch, *out_batches[0]);
+}
+
+TEST_F(TestFileFormat, CompressedRoundTrip) {
+  options_.compression = Compression::ZSTD;
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionary(&batch));
+
+  BatchVector out_batches;
+  ASSERT_OK(RoundTripHelper({batch, batch}, &out_batches));
+  for (const auto& out_batch : out_batches) {
+    CompareBatch(*batch, *out_batch);
+  }
+  CheckBatchDictionaries(*out_batches[0]);
+}
+#endif
+
 class TestTensorRoundTrip : public ::testing::Test, public IpcTestFixture {
  public:
   void SetUp() { pool_ = default_memory_pool(); }
@@ -17,6 +17,7 @@
 
 #include "arrow/ipc/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <sstream>
@@ -31,18 +32,24 @@
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/readahead.h"
 #include "arrow/ipc/File_generated.h"  // IWYU pragma: export
 #include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/Schema_generated.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata-internal.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -58,11 +65,19 @@ using internal::kArrowMagicBytes;
 // Record batch read path
 
 /// Accessor class for flatbuffers metadata
+///
+/// Buffers are either read from a file or, if the message body is already in
+/// memory, sliced directly from the body without going through a file
+/// interface
 class IpcComponentSource {
  public:
   IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
       : metadata_(metadata), file_(file) {}
 
+  IpcComponentSource(const flatbuf::RecordBatch* metadata,
+                     const std::shared_ptr<Buffer>& body)
+      : metadata_(metadata), file_(NULLPTR), body_(body) {}
+
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     const flatbuf::Buffer* buffer = metadata_->buffers()->Get(buffer_index);
 
@@ -73,6 +88,15 @@ class IpcComponentSource {
       DCHECK(BitUtil::IsMultipleOf8(buffer->offset()))
           << "Buffer " << buffer_index
           << " did not start on 8-byte aligned offset: " << buffer->offset();
+      if (body_) {
+        if (buffer->offset() < 0 || buffer->length() < 0 ||
+            buffer->offset() + buffer->length() > body_->size()) {
+          return Status::IOError("Buffer ", buffer_index,
+                                 " exceeds the bounds of the message body");
+        }
+        *out = SliceBuffer(body_, buffer->offset(), buffer->length());
+        return Status::OK();
+      }
       return file_->ReadAt(buffer->offset(), buffer->length(), out);
     }
   }
@@ -94,6 +118,7 @@ class IpcComponentSource {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  std::shared_ptr<Buffer> body_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -284,12 +309,99 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
   return ReadRecordBatch(*message.metadata(), schema, kMaxNestingDepth, &reader, out);
 }
 
+// ----------------------------------------------------------------------
+// Body decompression
+
+// Decompress a body buffer written by the IPC writer with buffer-level
+// compression: a little-endian int64 uncompressed length (or -1 if the data
+// was left uncompressed) followed by the compressed bytes
+static Status DecompressBuffer(const std::shared_ptr<Buffer>& buffer, util::Codec* codec,
+                               MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  const int64_t prefix_length = static_cast<int64_t>(sizeof(int64_t));
+  if (buffer->size() < prefix_length) {
+    return Status::IOError("Compressed IPC buffer is too short: ", buffer->size(),
+                           " bytes");
+  }
+  int64_t uncompressed_length;
+  memcpy(&uncompressed_length, buffer->data(), prefix_length);
+  uncompressed_length = BitUtil::FromLittleEndian(uncompressed_length);
+
+  const int64_t compressed_length = buffer->size() - prefix_length;
+  if (uncompressed_length == -1) {
+    // Stored as-is, no copy needed
+    *out = SliceBuffer(buffer, prefix_length, compressed_length);
+    return Status::OK();
+  }
+  if (uncompressed_length < 0) {
+    return Status::IOError("Invalid uncompressed length in IPC buffer: ",
+                           uncompressed_length);
+  }
+
+  std::shared_ptr<Buffer> result;
+  RETURN_NOT_OK(AllocateBuffer(pool, uncompressed_length, &result));
+  int64_t actual_length = 0;
+  RETURN_NOT_OK(codec->Decompress(compressed_length, buffer->data() + prefix_length,
+                                  uncompressed_length, result->mutable_data(),
+                                  &actual_length));
+  if (actual_length != uncompressed_length) {
+    return Status::IOError("Failed to fully decompress IPC buffer, expected ",
+                           uncompressed_length, " bytes but got ", actual_length);
+  }
+  *out = result;
+  return Status::OK();
+}
+
+static void CollectBodyBuffers(ArrayData* data,
+                               std::vector<std::shared_ptr<Buffer>*>* out) {
+  for (auto& buffer : data->buffers) {
+    if (buffer && buffer->size() > 0) {
+      out->push_back(&buffer);
+    }
+  }
+  for (const auto& child : data->child_data) {
+    CollectBodyBuffers(child.get(), out);
+  }
+}
+
+static Status DecompressBodyBuffers(Compression::type compression, bool use_threads,
+                                    MemoryPool* pool,
+                                    std::vector<std::shared_ptr<ArrayData>>* arrays) {
+  std::vector<std::shared_ptr<Buffer>*> buffers;
+  for (const auto& array : *arrays) {
+    CollectBodyBuffers(array.get(), &buffers);
+  }
+
+  // One-shot decompression is stateless, so a single codec instance can be
+  // shared by all tasks
+  std::unique_ptr<util::Codec> codec;
+  RETURN_NOT_OK(util::Codec::Create(compression, &codec));
+
+  auto DecompressOne = [&buffers, &codec, pool](int i) -> Status {
+    static const MemoryTag kDecompressTag("ipc.decompress");
+    ScopedMemoryTag tag(kDecompressTag);
+    return DecompressBuffer(*buffers[i], codec.get(), pool, buffers[i]);
+  };
+
+  // A task of the CPU pool waiting on other tasks of it could deadlock, so
+  // decompress serially there
+  const int num_buffers = static_cast<int>(buffers.size());
+  if (use_threads && num_buffers > 1 &&
+      !::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+    return ::arrow::internal::ParallelFor(num_buffers, DecompressOne);
+  }
+  for (int i = 0; i < num_buffers; ++i) {
+    RETURN_NOT_OK(DecompressOne(i));
+  }
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Array loading
 
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
                                         int64_t num_rows, int max_recursion_depth,
-                                        IpcComponentSource* source,
+                                        Compression::type compression, bool use_threads,
+                                        MemoryPool* pool, IpcComponentSource* source,
                                         std::shared_ptr<RecordBatch>* out) {
   ArrayLoaderContext context;
   context.source = source;
@@ -305,6 +417,10 @@ static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
     arrays[i] = std::move(arr);
   }
 
+  if (compression != Compression::UNCOMPRESSED) {
+    RETURN_NOT_OK(DecompressBodyBuffers(compression, use_threads, pool, &arrays));
+  }
+
   *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
   return Status::OK();
 }
@@ -312,15 +428,25 @@ static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
                                      int max_recursion_depth, io::RandomAccessFile* file,
+                                     MemoryPool* pool,
                                      std::shared_ptr<RecordBatch>* out) {
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(metadata, &compression));
   IpcComponentSource source(metadata, file);
   return LoadRecordBatchFromSource(schema, metadata->length(), max_recursion_depth,
-                                   &source, out);
+                                   compression, /*use_threads=*/true, pool, &source, out);
 }
 
 Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
                        int max_recursion_depth, io::RandomAccessFile* file,
                        std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(metadata, schema, max_recursion_depth, file,
+                         default_memory_pool(), out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       int max_recursion_depth, io::RandomAccessFile* file,
+                       MemoryPool* pool, std::shared_ptr<RecordBatch>* out) {
   auto message = flatbuf::GetMessage(metadata.data());
   if (message->header_type() != flatbuf::MessageHeader_RecordBatch) {
     DCHECK_EQ(message->header_type(), flatbuf::MessageHeader_RecordBatch);
@@ -329,17 +455,19 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
     return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
   }
   auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
-  return ReadRecordBatch(batch, schema, max_recursion_depth, file, out);
+  return ReadRecordBatch(batch, schema, max_recursion_depth, file, pool, out);
 }
 
 Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionary_types,
-                      io::RandomAccessFile* file, int64_t* dictionary_id,
+                      io::RandomAccessFile* file, MemoryPool* pool,
+                      int64_t* dictionary_id, bool* is_delta,
                       std::shared_ptr<Array>* out) {
   auto message = flatbuf::GetMessage(metadata.data());
   auto dictionary_batch =
       reinterpret_cast<const flatbuf::DictionaryBatch*>(message->header());
 
   int64_t id = *dictionary_id = dictionary_batch->id();
+  *is_delta = dictionary_batch->isDelta();
   auto it = dictionary_types.find(id);
   if (it == dictionary_types.end()) {
     return Status::KeyError("Do not have type metadata for dictionary with id: ", id);
@@ -355,7 +483,7 @@ Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionar
   auto batch_meta =
       reinterpret_cast<const flatbuf::RecordBatch*>(dictionary_batch->data());
   RETURN_NOT_OK(
-      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, file, &batch));
+      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, file, pool, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
@@ -364,6 +492,24 @@ Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionar
   return Status::OK();
 }
 
+// Add a dictionary read from a dictionary batch to the memo, replacing or
+// extending any dictionary previously read for the same id
+static Status UpdateDictionaryMemo(int64_t id, bool is_delta,
+                                   const std::shared_ptr<Array>& dictionary,
+                                   MemoryPool* pool, DictionaryMemo* memo) {
+  if (!memo->HasDictionaryId(id)) {
+    if (is_delta) {
+      return Status::Invalid("Delta dictionary batch for dictionary id ", id,
+                             " which has not been read yet");
+    }
+    return memo->AddDictionary(id, dictionary);
+  }
+  if (is_delta) {
+    return memo->AddDictionaryDelta(id, dictionary, pool);
+  }
+  return memo->UpdateDictionary(id, dictionary);
+}
+
 static Status ReadMessageAndValidate(MessageReader* reader, Message::Type expected_type,
                                      bool allow_null, std::unique_ptr<Message>* message) {
   RETURN_NOT_OK(reader->ReadNextMessage(message));
@@ -397,34 +543,39 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
   RecordBatchStreamReaderImpl() {}
   ~RecordBatchStreamReaderImpl() {}
 
-  Status Open(std::unique_ptr<MessageReader> message_reader) {
+  Status Open(std::unique_ptr<MessageReader> message_reader, MemoryPool* pool) {
     message_reader_ = std::move(message_reader);
+    pool_ = pool;
     return ReadSchema();
   }
 
+  Status ReadDictionaryMessage(const Message& message) {
+    io::BufferReader reader(message.body());
+
+    std::shared_ptr<Array> dictionary;
+    int64_t id;
+    bool is_delta;
+    RETURN_NOT_OK(ReadDictionary(*message.metadata(), dictionary_types_, &reader, pool_,
+                                 &id, &is_delta, &dictionary));
+    return UpdateDictionaryMemo(id, is_delta, dictionary, pool_, &dictionary_memo_);
+  }
+
   Status ReadNextDictionary() {
     std::unique_ptr<Message> message;
     RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::DICTIONARY_BATCH,
                                          false, &message));
-
-    io::BufferReader reader(message->body());
-
-    std::shared_ptr<Array> dictionary;
-    int64_t id;
-    RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_types_, &reader, &id,
-                                 &dictionary));
-    return dictionary_memo_.AddDictionary(id, dictionary);
+    return ReadDictionaryMessage(*message);
   }
 
   Status ReadSchema() {
-    std::unique_ptr<Message> message;
-    RETURN_NOT_OK(
-        ReadMessageAndValidate(message_reader_.get(), Message::SCHEMA, false, &message));
+    RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::SCHEMA, false,
+                                         &schema_message_));
 
-    if (message->header() == nullptr) {
+    if (schema_message_->header() == nullptr) {
       return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
     }
-    RETURN_NOT_OK(internal::GetDictionaryTypes(message->header(), &dictionary_types_));
+    RETURN_NOT_OK(
+        internal::GetDictionaryTypes(schema_message_->header(), &dictionary_types_));
 
     // TODO(wesm): In future, we may want to reconcile the ids in the stream with
     // those found in the schema
@@ -433,28 +584,52 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
       RETURN_NOT_OK(ReadNextDictionary());
     }
 
-    return internal::GetSchema(message->header(), dictionary_memo_, &schema_);
+    return internal::GetSchema(schema_message_->header(), dictionary_memo_, &schema_);
   }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) {
+    // Replacement and delta dictionary batches may precede any record batch
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::RECORD_BATCH,
-                                         true, &message));
+    bool dictionaries_changed = false;
+    while (true) {
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+      if (message == nullptr) {
+        // End of stream
+        *batch = nullptr;
+        return Status::OK();
+      }
+      if (message->type() != Message::DICTIONARY_BATCH) {
+        break;
+      }
+      RETURN_NOT_OK(ReadDictionaryMessage(*message));
+      dictionaries_changed = true;
+    }
 
-    if (message == nullptr) {
-      // End of stream
-      *batch = nullptr;
-      return Status::OK();
+    if (message->type() != Message::RECORD_BATCH) {
+      return Status::IOError("Message not expected type: ",
+                             FormatMessageType(Message::RECORD_BATCH),
+                             ", was: ", message->type());
+    }
+
+    if (dictionaries_changed) {
+      // Dictionaries are part of the Arrow types, so the schema is rebuilt
+      // from the stream metadata with the new dictionaries
+      RETURN_NOT_OK(
+          internal::GetSchema(schema_message_->header(), dictionary_memo_, &schema_));
     }
 
     io::BufferReader reader(message->body());
-    return ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    return ReadRecordBatch(*message->metadata(), schema_, kMaxNestingDepth, &reader,
+                           pool_, batch);
   }
 
   std::shared_ptr<Schema> schema() const { return schema_; }
 
  private:
   std::unique_ptr<MessageReader> message_reader_;
+  // Allocates the decompressed buffers and the extended dictionaries
+  MemoryPool* pool_;
+  std::unique_ptr<Message> schema_message_;
 
   // dictionary_id -> type
   DictionaryTypeMap dictionary_types_;
@@ -470,9 +645,15 @@ RecordBatchStreamReader::~RecordBatchStreamReader() {}
 
 Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
                                      std::shared_ptr<RecordBatchReader>* reader) {
+  return Open(std::move(message_reader), default_memory_pool(), reader);
+}
+
+Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), pool));
   *reader = result;
   return Status::OK();
 }
@@ -487,6 +668,21 @@ Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& str
   return Open(MessageReader::Open(stream), out);
 }
 
+Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& stream,
+                                     const io::ReadaheadOptions& readahead,
+                                     std::shared_ptr<RecordBatchReader>* out) {
+  return Open(stream, readahead, default_memory_pool(), out);
+}
+
+Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& stream,
+                                     const io::ReadaheadOptions& readahead,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<RecordBatchReader>* out) {
+  std::shared_ptr<io::InputStream> readahead_stream =
+      std::make_shared<io::internal::ReadaheadInputStream>(pool, stream, readahead);
+  return Open(MessageReader::Open(readahead_stream), pool, out);
+}
+
 std::shared_ptr<Schema> RecordBatchStreamReader::schema() const {
   return impl_->schema();
 }
@@ -500,7 +696,11 @@ Status RecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
 
 class RecordBatchFileReader::RecordBatchFileReaderImpl {
  public:
-  RecordBatchFileReaderImpl() : file_(NULLPTR), footer_offset_(0), footer_(NULLPTR) {
+  RecordBatchFileReaderImpl()
+      : file_(NULLPTR),
+        pool_(default_memory_pool()),
+        footer_offset_(0),
+        footer_(NULLPTR) {
     dictionary_memo_ = std::make_shared<DictionaryMemo>();
   }
 
@@ -572,7 +772,167 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     // DCHECK_EQ(message->body_length(), block.body_length);
 
     io::BufferReader reader(message->body());
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, kMaxNestingDepth,
+                                         &reader, pool_, batch);
+  }
+
+  // Parse and verify the message of a file block from an in-memory slice
+  // holding its metadata and (usually) its body. The body is re-read from the
+  // file only if the footer understated its length
+  Status ReadBlockMessage(const FileBlock& block, const std::shared_ptr<Buffer>& data,
+                          std::unique_ptr<Message>* out) {
+    const int64_t prefix_length = static_cast<int64_t>(sizeof(int32_t));
+    if (block.metadata_length <= prefix_length || data->size() < block.metadata_length) {
+      return Status::IOError("Invalid metadata length ", block.metadata_length,
+                             " for record batch at file offset ", block.offset);
+    }
+    int32_t flatbuffer_size;
+    memcpy(&flatbuffer_size, data->data(), prefix_length);
+    if (flatbuffer_size <= 0 || flatbuffer_size + prefix_length > block.metadata_length) {
+      return Status::IOError("Invalid flatbuffer size ", flatbuffer_size,
+                             " for record batch at file offset ", block.offset);
+    }
+
+    auto metadata = SliceBuffer(data, prefix_length, flatbuffer_size);
+    flatbuffers::Verifier verifier(metadata->data(), metadata->size(), 128);
+    if (!flatbuf::VerifyMessageBuffer(verifier)) {
+      return Status::IOError("Invalid flatbuffers message at file offset ", block.offset);
+    }
+
+    const int64_t body_length = flatbuf::GetMessage(metadata->data())->bodyLength();
+    std::shared_ptr<Buffer> body;
+    if (block.metadata_length + body_length <= data->size()) {
+      body = SliceBuffer(data, block.metadata_length, body_length);
+    } else {
+      RETURN_NOT_OK(
+          file_->ReadAt(block.offset + block.metadata_length, body_length, &body));
+      if (body->size() < body_length) {
+        return Status::IOError("Expected to be able to read ", body_length,
+                               " bytes for message body, got ", body->size());
+      }
+    }
+    return Message::Open(metadata, body, out);
+  }
+
+  Status DecodeRecordBatch(const FileBlock& block, const std::shared_ptr<Buffer>& data,
+                           bool use_threads, std::shared_ptr<RecordBatch>* out) {
+    std::unique_ptr<Message> message;
+    RETURN_NOT_OK(ReadBlockMessage(block, data, &message));
+    if (message->type() != Message::RECORD_BATCH) {
+      return Status::IOError("Message not expected type: ",
+                             FormatMessageType(Message::RECORD_BATCH),
+                             ", was: ", message->type());
+    }
+    auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
+    if (batch == nullptr) {
+      return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
+    }
+
+    Compression::type compression;
+    RETURN_NOT_OK(internal::GetCompression(batch, &compression));
+    IpcComponentSource source(batch, message->body());
+    return LoadRecordBatchFromSource(schema_, batch->length(), kMaxNestingDepth,
+                                     compression, use_threads, pool_, &source, out);
+  }
+
+  // A contiguous region of the file covering one or more record batch blocks
+  struct ReadRange {
+    int64_t offset;
+    int64_t length;
+    std::shared_ptr<Buffer> data;
+  };
+
+  Status ReadRecordBatches(const std::vector<int>& indices, bool use_threads,
+                           std::vector<std::shared_ptr<RecordBatch>>* out) {
+    // Neighbouring blocks separated by less than this are read together
+    constexpr int64_t kHoleSizeLimit = 8192;
+    // Do not coalesce blocks into reads larger than this
+    constexpr int64_t kRangeSizeLimit = 64 * 1024 * 1024;
+
+    // A task of the CPU pool waiting on other tasks of it could deadlock, so
+    // read serially there
+    use_threads = use_threads && !::arrow::internal::GetCpuThreadPool()->OwnsThisThread();
+
+    const int num_batches = static_cast<int>(indices.size());
+    std::vector<FileBlock> blocks(num_batches);
+    for (int i = 0; i < num_batches; ++i) {
+      if (indices[i] < 0 || indices[i] >= num_record_batches()) {
+        return Status::Invalid("Record batch index ", indices[i], " out of bounds (",
+                               num_record_batches(), " record batches in file)");
+      }
+      blocks[i] = record_batch(indices[i]);
+      DCHECK(BitUtil::IsMultipleOf8(blocks[i].offset));
+      DCHECK(BitUtil::IsMultipleOf8(blocks[i].metadata_length));
+      DCHECK(BitUtil::IsMultipleOf8(blocks[i].body_length));
+    }
+
+    // Coalesce the blocks, in file order, into a few large reads
+    std::vector<int> order(num_batches);
+    for (int i = 0; i < num_batches; ++i) {
+      order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&blocks](int left, int right) {
+      return blocks[left].offset < blocks[right].offset;
+    });
+
+    std::vector<ReadRange> ranges;
+    std::vector<int> range_of_batch(num_batches);
+    for (int i : order) {
+      const FileBlock& block = blocks[i];
+      const int64_t block_end = block.offset + block.metadata_length + block.body_length;
+      if (!ranges.empty()) {
+        ReadRange& last = ranges.back();
+        const int64_t last_end = last.offset + last.length;
+        if (block.offset >= last.offset && block.offset - last_end <= kHoleSizeLimit &&
+            block_end - last.offset <= kRangeSizeLimit) {
+          last.length = std::max(last_end, block_end) - last.offset;
+          range_of_batch[i] = static_cast<int>(ranges.size()) - 1;
+          continue;
+        }
+      }
+      ranges.push_back({block.offset, block_end - block.offset, nullptr});
+      range_of_batch[i] = static_cast<int>(ranges.size()) - 1;
+    }
+
+    auto ReadOneRange = [this, &ranges](int i) -> Status {
+      ReadRange& range = ranges[i];
+      RETURN_NOT_OK(file_->ReadAt(range.offset, range.length, &range.data));
+      if (range.data->size() < range.length) {
+        return Status::IOError("Expected to read ", range.length,
+                               " bytes at file offset ", range.offset, ", got ",
+                               range.data->size());
+      }
+      return Status::OK();
+    };
+
+    // When several batches are decoded concurrently, each one decompresses
+    // its buffers serially
+    const bool decode_in_parallel = use_threads && num_batches > 1;
+    out->resize(num_batches);
+    auto DecodeOne = [&](int i) -> Status {
+      const ReadRange& range = ranges[range_of_batch[i]];
+      const FileBlock& block = blocks[i];
+      auto data = SliceBuffer(range.data, block.offset - range.offset,
+                              block.metadata_length + block.body_length);
+      return DecodeRecordBatch(block, data, use_threads && !decode_in_parallel,
+                               &(*out)[i]);
+    };
+
+    const int num_ranges = static_cast<int>(ranges.size());
+    if (use_threads && num_ranges > 1) {
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(num_ranges, ReadOneRange));
+    } else {
+      for (int i = 0; i < num_ranges; ++i) {
+        RETURN_NOT_OK(ReadOneRange(i));
+      }
+    }
+    if (decode_in_parallel) {
+      return ::arrow::internal::ParallelFor(num_batches, DecodeOne);
+    }
+    for (int i = 0; i < num_batches; ++i) {
+      RETURN_NOT_OK(DecodeOne(i));
+    }
+    return Status::OK();
   }
 
   Status ReadSchema() {
@@ -596,17 +956,25 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
       std::shared_ptr<Array> dictionary;
       int64_t dictionary_id;
+      bool is_delta;
       RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_fields_, &reader,
-                                   &dictionary_id, &dictionary));
-      RETURN_NOT_OK(dictionary_memo_->AddDictionary(dictionary_id, dictionary));
+                                   pool_, &dictionary_id, &is_delta, &dictionary));
+      if (is_delta) {
+        RETURN_NOT_OK(UpdateDictionaryMemo(dictionary_id, is_delta, dictionary, pool_,
+                                           dictionary_memo_.get()));
+      } else {
+        RETURN_NOT_OK(dictionary_memo_->AddDictionary(dictionary_id, dictionary));
+      }
     }
 
     // Get the schema
     return internal::GetSchema(footer_->schema(), *dictionary_memo_, &schema_);
   }
 
-  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset) {
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
+              MemoryPool* pool) {
     owned_file_ = file;
+    pool_ = pool;
     return Open(file.get(), footer_offset);
   }
 
@@ -621,6 +989,8 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
  private:
   io::RandomAccessFile* file_;
+  // Allocates the decompressed buffers and the extended dictionaries
+  MemoryPool* pool_;
 
   std::shared_ptr<io::RandomAccessFile> owned_file_;
 
@@ -668,8 +1038,14 @@ Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>&
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
                                    int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
+  return Open(file, footer_offset, default_memory_pool(), reader);
+}
+
+Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                                   int64_t footer_offset, MemoryPool* pool,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, pool);
 }
 
 std::shared_ptr<Schema> RecordBatchFileReader::schema() const { return impl_->schema(); }
@@ -685,6 +1061,26 @@ Status RecordBatchFileReader::ReadRecordBatch(int i,
   return impl_->ReadRecordBatch(i, batch);
 }
 
+Status RecordBatchFileReader::ReadRecordBatches(
+    const std::vector<int>& indices, std::vector<std::shared_ptr<RecordBatch>>* batches,
+    bool use_threads) {
+  return impl_->ReadRecordBatches(indices, use_threads, batches);
+}
+
+Status RecordBatchFileReader::ReadRecordBatches(
+    int start, int length, std::vector<std::shared_ptr<RecordBatch>>* batches,
+    bool use_threads) {
+  if (start < 0 || length < 0) {
+    return Status::Invalid("Invalid record batch range: start=", start,
+                           ", length=", length);
+  }
+  std::vector<int> indices(length);
+  for (int i = 0; i < length; ++i) {
+    indices[i] = start + i;
+  }
+  return impl_->ReadRecordBatches(indices, use_threads, batches);
+}
+
 static Status ReadContiguousPayload(io::InputStream* file,
                                     std::unique_ptr<Message>* message) {
   RETURN_NOT_OK(ReadMessage(file, message));
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/ipc/message.h"
 #include "arrow/record_batch.h"
@@ -30,6 +31,7 @@
 namespace arrow {
 
 class Buffer;
+class MemoryPool;
 class Schema;
 class Status;
 class Tensor;
@@ -39,6 +41,7 @@ namespace io {
 
 class InputStream;
 class RandomAccessFile;
+struct ReadaheadOptions;
 
 }  // namespace io
 
@@ -64,6 +67,16 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(std::unique_ptr<MessageReader> message_reader,
                      std::shared_ptr<RecordBatchReader>* out);
 
+  /// Create batch reader from generic MessageReader
+  ///
+  /// \param[in] message_reader a MessageReader implementation
+  /// \param[in] pool memory pool for the decompressed buffers and extended
+  /// dictionaries
+  /// \param[out] out the created RecordBatchReader object
+  /// \return Status
+  static Status Open(std::unique_ptr<MessageReader> message_reader, MemoryPool* pool,
+                     std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Record batch stream reader from InputStream
   ///
   /// \param[in] stream an input stream instance. Must stay alive throughout
@@ -79,6 +92,26 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(const std::shared_ptr<io::InputStream>& stream,
                      std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Open stream, reading ahead of the decoded record batches on the
+  /// I/O thread pool
+  ///
+  /// Message bodies contained in a single readahead block are zero-copy
+  /// slices of it.
+  ///
+  /// \param[in] stream the input stream
+  /// \param[in] readahead the readahead options
+  /// \param[out] out the batch reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::InputStream>& stream,
+                     const io::ReadaheadOptions& readahead,
+                     std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Open stream with readahead, allocating the readahead blocks, the
+  /// decompressed buffers and the extended dictionaries from the given pool
+  static Status Open(const std::shared_ptr<io::InputStream>& stream,
+                     const io::ReadaheadOptions& readahead, MemoryPool* pool,
+                     std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Returns the schema read from the stream
   std::shared_ptr<Schema> schema() const override;
 
@@ -137,6 +170,18 @@ class ARROW_EXPORT RecordBatchFileReader {
                      int64_t footer_offset,
                      std::shared_ptr<RecordBatchFileReader>* reader);
 
+  /// \brief Version of Open that retains ownership of file
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] pool memory pool for the decompressed buffers and extended
+  /// dictionaries
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                     int64_t footer_offset, MemoryPool* pool,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
   /// \brief The schema read from the file
   std::shared_ptr<Schema> schema() const;
 
@@ -154,6 +199,34 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Read a set of record batches from the file, possibly in parallel
+  ///
+  /// The file regions of neighbouring batches are coalesced into larger
+  /// reads, and batch buffers are zero-copy slices of those reads if the input
+  /// source supports zero-copy. Each batch's metadata is verified once.
+  ///
+  /// \param[in] indices the indices of the record batches to return
+  /// \param[out] batches the read batches, in the order of indices
+  /// \param[in] use_threads if true, read and decode the batches on the
+  /// global CPU thread pool
+  /// \return Status
+  Status ReadRecordBatches(const std::vector<int>& indices,
+                           std::vector<std::shared_ptr<RecordBatch>>* batches,
+                           bool use_threads = true);
+
+  /// \brief Read a contiguous range of record batches from the file,
+  /// possibly in parallel
+  ///
+  /// \param[in] start the index of the first record batch to return
+  /// \param[in] length the number of record batches to return
+  /// \param[out] batches the read batches
+  /// \param[in] use_threads if true, read and decode the batches on the
+  /// global CPU thread pool
+  /// \return Status
+  Status ReadRecordBatches(int start, int length,
+                           std::vector<std::shared_ptr<RecordBatch>>* batches,
+                           bool use_threads = true);
+
  private:
   RecordBatchFileReader();
 
@@ -228,6 +301,20 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
                        int max_recursion_depth, io::RandomAccessFile* file,
                        std::shared_ptr<RecordBatch>* out);
 
+/// Read record batch from file given metadata and schema
+///
+/// \param[in] metadata a Message containing the record batch metadata
+/// \param[in] schema the record batch schema
+/// \param[in] max_recursion_depth the maximum permitted nesting depth
+/// \param[in] file a random access file
+/// \param[in] pool memory pool for the decompressed buffers
+/// \param[out] out the read record batch
+/// \return Status
+ARROW_EXPORT
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       int max_recursion_depth, io::RandomAccessFile* file,
+                       MemoryPool* pool, std::shared_ptr<RecordBatch>* out);
+
 /// \brief Read arrow::Tensor as encapsulated IPC message in file
 ///
 /// \param[in] file an InputStream pointed at the start of the message
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <limits>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/array.h"
@@ -41,7 +42,9 @@
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -108,13 +111,15 @@ namespace internal {
 class RecordBatchSerializer : public ArrayVisitor {
  public:
   RecordBatchSerializer(MemoryPool* pool, int64_t buffer_start_offset,
-                        int max_recursion_depth, bool allow_64bit, IpcPayload* out)
+                        const IpcOptions& options, IpcPayload* out)
       : out_(out),
         pool_(pool),
-        max_recursion_depth_(max_recursion_depth),
+        max_recursion_depth_(options.max_recursion_depth),
         buffer_start_offset_(buffer_start_offset),
-        allow_64bit_(allow_64bit) {
-    DCHECK_GT(max_recursion_depth, 0);
+        allow_64bit_(options.allow_64bit),
+        compression_(options.compression),
+        use_threads_(options.use_threads) {
+    DCHECK_GT(max_recursion_depth_, 0);
   }
 
   ~RecordBatchSerializer() override = default;
@@ -146,7 +151,61 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, compression_, &out_->metadata);
+  }
+
+  // Replace a body buffer with its compressed form, prefixed by the
+  // uncompressed length as a little-endian int64. If compression does not
+  // save any space, the buffer is written as-is with a length prefix of -1
+  Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
+                        std::shared_ptr<Buffer>* out) {
+    const int64_t prefix_length = static_cast<int64_t>(sizeof(int64_t));
+    const int64_t max_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
+
+    std::shared_ptr<ResizableBuffer> result;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, prefix_length + max_length, &result));
+    uint8_t* dest = result->mutable_data();
+
+    int64_t actual_length = 0;
+    RETURN_NOT_OK(codec->Compress(buffer.size(), buffer.data(), max_length,
+                                  dest + prefix_length, &actual_length));
+
+    int64_t uncompressed_length = buffer.size();
+    if (actual_length >= buffer.size()) {
+      uncompressed_length = -1;
+      actual_length = buffer.size();
+      memcpy(dest + prefix_length, buffer.data(), buffer.size());
+    }
+    uncompressed_length = BitUtil::ToLittleEndian(uncompressed_length);
+    memcpy(dest, &uncompressed_length, prefix_length);
+
+    RETURN_NOT_OK(result->Resize(prefix_length + actual_length));
+    *out = result;
+    return Status::OK();
+  }
+
+  Status CompressBodyBuffers() {
+    std::unique_ptr<util::Codec> codec;
+    RETURN_NOT_OK(util::Codec::Create(compression_, &codec));
+
+    // One-shot compression is stateless, so a single codec instance can be
+    // shared by all tasks
+    auto CompressOne = [this, &codec](int i) -> Status {
+      std::shared_ptr<Buffer>& buffer = out_->body_buffers[i];
+      if (buffer && buffer->size() > 0) {
+        RETURN_NOT_OK(CompressBuffer(*buffer, codec.get(), &buffer));
+      }
+      return Status::OK();
+    };
+
+    const int num_buffers = static_cast<int>(out_->body_buffers.size());
+    if (use_threads_ && num_buffers > 1) {
+      return ::arrow::internal::ParallelFor(num_buffers, CompressOne);
+    }
+    for (int i = 0; i < num_buffers; ++i) {
+      RETURN_NOT_OK(CompressOne(i));
+    }
+    return Status::OK();
   }
 
   Status Assemble(const RecordBatch& batch) {
@@ -161,6 +220,10 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    if (compression_ != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -461,19 +524,23 @@ class RecordBatchSerializer : public ArrayVisitor {
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
   bool allow_64bit_;
+  Compression::type compression_;
+  bool use_threads_;
 };
 
 class DictionaryWriter : public RecordBatchSerializer {
  public:
-  DictionaryWriter(int64_t dictionary_id, MemoryPool* pool, int64_t buffer_start_offset,
-                   int max_recursion_depth, bool allow_64bit, IpcPayload* out)
-      : RecordBatchSerializer(pool, buffer_start_offset, max_recursion_depth, allow_64bit,
-                              out),
-        dictionary_id_(dictionary_id) {}
+  DictionaryWriter(int64_t dictionary_id, bool is_delta, MemoryPool* pool,
+                   int64_t buffer_start_offset, const IpcOptions& options,
+                   IpcPayload* out)
+      : RecordBatchSerializer(pool, buffer_start_offset, options, out),
+        dictionary_id_(dictionary_id),
+        is_delta_(is_delta) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+    return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, out_->body_length,
+                                  field_nodes_, buffer_meta_, compression_,
+                                  &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -485,18 +552,23 @@ class DictionaryWriter : public RecordBatchSerializer {
 
  private:
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
                        int32_t* metadata_length) {
-  RETURN_NOT_OK(internal::WriteMessage(*payload.metadata, kArrowIpcAlignment, dst,
-                                       metadata_length));
-
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
 #endif
 
-  // Now write the buffers
+  // The metadata, the body buffers and all padding are gathered into a single
+  // vectored write, so that the buffers are not copied on the way to the sink
+  int32_t prefix;
+  std::vector<io::BufferSpan> spans;
+  spans.reserve(3 + 2 * payload.body_buffers.size());
+  RETURN_NOT_OK(internal::AppendMessageSpans(*payload.metadata, kArrowIpcAlignment,
+                                             &prefix, &spans, metadata_length));
+
   for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
     const Buffer* buffer = payload.body_buffers[i].get();
     int64_t size = 0;
@@ -509,14 +581,16 @@ Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
     }
 
     if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer->data(), size));
+      spans.push_back({buffer->data(), size});
     }
 
     if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+      spans.push_back({kPaddingBytes, padding});
     }
   }
 
+  RETURN_NOT_OK(dst->WriteSpans(spans));
+
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
 #endif
@@ -535,19 +609,33 @@ Status GetSchemaPayload(const Schema& schema, MemoryPool* pool,
 
 Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool,
                              IpcPayload* out) {
-  RecordBatchSerializer writer(pool, 0, kMaxNestingDepth, true, out);
+  IpcOptions options;
+  options.allow_64bit = true;
+  RecordBatchSerializer writer(pool, 0, options, out);
   return writer.Assemble(batch);
 }
 
 }  // namespace internal
 
+IpcOptions IpcOptions::Defaults() { return IpcOptions(); }
+
 Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
                         io::OutputStream* dst, int32_t* metadata_length,
                         int64_t* body_length, MemoryPool* pool, int max_recursion_depth,
                         bool allow_64bit) {
+  IpcOptions options;
+  options.max_recursion_depth = max_recursion_depth;
+  options.allow_64bit = allow_64bit;
+  return WriteRecordBatch(batch, buffer_start_offset, dst, metadata_length, body_length,
+                          options, pool);
+}
+
+Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
+                        io::OutputStream* dst, int32_t* metadata_length,
+                        int64_t* body_length, const IpcOptions& options,
+                        MemoryPool* pool) {
   internal::IpcPayload payload;
-  internal::RecordBatchSerializer writer(pool, buffer_start_offset, max_recursion_depth,
-                                         allow_64bit, &payload);
+  internal::RecordBatchSerializer writer(pool, buffer_start_offset, options, &payload);
   RETURN_NOT_OK(writer.Assemble(batch));
 
   // TODO(wesm): it's a rough edge that the metadata and body length here are
@@ -782,11 +870,14 @@ Status WriteSparseTensor(const SparseTensor& sparse_tensor, io::OutputStream* ds
 }
 
 Status WriteDictionary(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
-                       int64_t buffer_start_offset, io::OutputStream* dst,
-                       int32_t* metadata_length, int64_t* body_length, MemoryPool* pool) {
+                       bool is_delta, int64_t buffer_start_offset, io::OutputStream* dst,
+                       int32_t* metadata_length, int64_t* body_length,
+                       const IpcOptions& options, MemoryPool* pool) {
   internal::IpcPayload payload;
-  internal::DictionaryWriter writer(dictionary_id, pool, buffer_start_offset,
-                                    kMaxNestingDepth, true, &payload);
+  IpcOptions dictionary_options = options;
+  dictionary_options.allow_64bit = true;
+  internal::DictionaryWriter writer(dictionary_id, is_delta, pool, buffer_start_offset,
+                                    dictionary_options, &payload);
   RETURN_NOT_OK(writer.Assemble(dictionary));
 
   // The body size is computed in the payload
@@ -878,14 +969,35 @@ class StreamBookKeeper {
   int64_t position_;
 };
 
+// Collect the dictionaries of the dictionary-encoded types in a type tree, in
+// depth-first order
+static void CollectDictionaries(const DataType& type,
+                                std::vector<std::shared_ptr<Array>>* out) {
+  if (type.id() == Type::DICTIONARY) {
+    out->push_back(checked_cast<const DictionaryType&>(type).dictionary());
+    return;
+  }
+  for (const auto& child : type.children()) {
+    CollectDictionaries(*child->type(), out);
+  }
+}
+
+static void CollectDictionaries(const Schema& schema,
+                                std::vector<std::shared_ptr<Array>>* out) {
+  for (const auto& field : schema.fields()) {
+    CollectDictionaries(*field->type(), out);
+  }
+}
+
 class SchemaWriter : public StreamBookKeeper {
  public:
   SchemaWriter(const Schema& schema, DictionaryMemo* dictionary_memo, MemoryPool* pool,
-               io::OutputStream* sink)
+               io::OutputStream* sink, const IpcOptions& options = IpcOptions())
       : StreamBookKeeper(sink),
         pool_(pool),
         schema_(schema),
-        dictionary_memo_(dictionary_memo) {}
+        dictionary_memo_(dictionary_memo),
+        options_(options) {}
 
   Status WriteSchema() {
 #ifndef NDEBUG
@@ -916,8 +1028,9 @@ class SchemaWriter : public StreamBookKeeper {
 
       // Frame of reference in file format is 0, see ARROW-384
       const int64_t buffer_start_offset = 0;
-      RETURN_NOT_OK(WriteDictionary(entry.first, entry.second, buffer_start_offset, sink_,
-                                    &block->metadata_length, &block->body_length, pool_));
+      RETURN_NOT_OK(WriteDictionary(entry.first, entry.second, /*is_delta=*/false,
+                                    buffer_start_offset, sink_, &block->metadata_length,
+                                    &block->body_length, options_, pool_));
       RETURN_NOT_OK(UpdatePositionCheckAligned());
     }
 
@@ -935,22 +1048,34 @@ class SchemaWriter : public StreamBookKeeper {
   MemoryPool* pool_;
   const Schema& schema_;
   DictionaryMemo* dictionary_memo_;
+  IpcOptions options_;
 };
 
 class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKeeper {
  public:
   RecordBatchStreamWriterImpl(io::OutputStream* sink,
-                              const std::shared_ptr<Schema>& schema)
+                              const std::shared_ptr<Schema>& schema,
+                              const IpcOptions& options)
       : StreamBookKeeper(sink),
         schema_(schema),
         pool_(default_memory_pool()),
+        options_(options),
         started_(false) {}
 
   virtual ~RecordBatchStreamWriterImpl() = default;
 
   virtual Status Start() {
-    SchemaWriter schema_writer(*schema_, &dictionary_memo_, pool_, sink_);
+    SchemaWriter schema_writer(*schema_, &dictionary_memo_, pool_, sink_, options_);
     RETURN_NOT_OK(schema_writer.Write(&dictionaries_));
+
+    // Remember which dictionary id each dictionary-encoded field maps to, so
+    // that dictionaries of later record batches can be checked against them
+    std::vector<std::shared_ptr<Array>> dictionaries;
+    CollectDictionaries(*schema_, &dictionaries);
+    for (const auto& dictionary : dictionaries) {
+      dictionary_ids_.push_back(dictionary_memo_.GetId(dictionary));
+    }
+
     started_ = true;
     return Status::OK();
   }
@@ -972,17 +1097,93 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
     return Status::OK();
   }
 
+  // Write a dictionary batch replacing or extending the dictionary last sent
+  // for an id
+  virtual Status WriteDictionaryUpdate(int64_t id, const std::shared_ptr<Array>& values,
+                                       bool is_delta) {
+    RETURN_NOT_OK(UpdatePosition());
+    FileBlock block = {position_, 0, 0};
+    const int64_t buffer_start_offset = 0;
+    RETURN_NOT_OK(WriteDictionary(id, values, is_delta, buffer_start_offset, sink_,
+                                  &block.metadata_length, &block.body_length, options_,
+                                  pool_));
+    dictionaries_.push_back(block);
+    return UpdatePositionCheckAligned();
+  }
+
+  // Emit dictionary batches for the dictionaries of the batch that differ from
+  // the ones last sent. A dictionary that extends the previous one is sent as
+  // a delta if enabled, any other change as a replacement
+  Status WriteDictionaryChanges(const RecordBatch& batch) {
+    if (dictionary_ids_.empty()) {
+      return Status::OK();
+    }
+    std::vector<std::shared_ptr<Array>> dictionaries;
+    CollectDictionaries(*batch.schema(), &dictionaries);
+    if (dictionaries.size() != dictionary_ids_.size()) {
+      return Status::Invalid(
+          "Dictionary-encoded fields of record batch do not match the stream schema");
+    }
+
+    // Fields may share a dictionary id; they must agree on its new value
+    std::unordered_map<int64_t, std::shared_ptr<Array>> seen;
+    for (size_t i = 0; i < dictionaries.size(); ++i) {
+      const int64_t id = dictionary_ids_[i];
+      const std::shared_ptr<Array>& dictionary = dictionaries[i];
+      auto it = seen.find(id);
+      if (it != seen.end()) {
+        if (it->second != dictionary && !it->second->Equals(*dictionary)) {
+          return Status::Invalid("Fields sharing dictionary id ", id,
+                                 " have different dictionaries in record batch");
+        }
+        continue;
+      }
+      seen[id] = dictionary;
+
+      std::shared_ptr<Array> current;
+      RETURN_NOT_OK(dictionary_memo_.GetDictionary(id, &current));
+      if (current == dictionary) {
+        continue;
+      }
+
+      if (!dictionary->type()->Equals(*current->type())) {
+        return Status::Invalid("Dictionary value type ", dictionary->type()->ToString(),
+                               " of record batch does not match stream dictionary type ",
+                               current->type()->ToString());
+      }
+      const int64_t current_length = current->length();
+      const bool extends_current = dictionary->length() >= current_length &&
+                                   dictionary->RangeEquals(0, current_length, 0, current);
+      if (extends_current && dictionary->length() == current_length) {
+        // Same values in a different array object: nothing to send. The memo
+        // keeps the original array, which the file footer schema refers to
+        continue;
+      }
+      if (extends_current && options_.emit_dictionary_deltas) {
+        RETURN_NOT_OK(
+            WriteDictionaryUpdate(id, dictionary->Slice(current_length), true));
+      } else {
+        RETURN_NOT_OK(WriteDictionaryUpdate(id, dictionary, false));
+      }
+      RETURN_NOT_OK(dictionary_memo_.UpdateDictionary(id, dictionary));
+    }
+    return Status::OK();
+  }
+
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit, FileBlock* block) {
     RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(WriteDictionaryChanges(batch));
     RETURN_NOT_OK(UpdatePosition());
 
     block->offset = position_;
 
     // Frame of reference in file format is 0, see ARROW-384
     const int64_t buffer_start_offset = 0;
-    RETURN_NOT_OK(arrow::ipc::WriteRecordBatch(
-        batch, buffer_start_offset, sink_, &block->metadata_length, &block->body_length,
-        pool_, kMaxNestingDepth, allow_64bit));
+    IpcOptions options = options_;
+    options.allow_64bit = allow_64bit;
+    RETURN_NOT_OK(arrow::ipc::WriteRecordBatch(batch, buffer_start_offset, sink_,
+                                               &block->metadata_length,
+                                               &block->body_length, options, pool_));
     RETURN_NOT_OK(UpdatePositionCheckAligned());
 
     return Status::OK();
@@ -1000,12 +1201,17 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
  protected:
   std::shared_ptr<Schema> schema_;
   MemoryPool* pool_;
+  IpcOptions options_;
   bool started_;
 
   // When writing out the schema, we keep track of all the dictionaries we
   // encounter, as they must be written out first in the stream
   DictionaryMemo dictionary_memo_;
 
+  // The dictionary id of each dictionary-encoded field of the schema, in the
+  // order of CollectDictionaries
+  std::vector<int64_t> dictionary_ids_;
+
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
 };
@@ -1026,9 +1232,16 @@ void RecordBatchStreamWriter::set_memory_pool(MemoryPool* pool) {
 Status RecordBatchStreamWriter::Open(io::OutputStream* sink,
                                      const std::shared_ptr<Schema>& schema,
                                      std::shared_ptr<RecordBatchWriter>* out) {
+  return Open(sink, schema, IpcOptions::Defaults(), out);
+}
+
+Status RecordBatchStreamWriter::Open(io::OutputStream* sink,
+                                     const std::shared_ptr<Schema>& schema,
+                                     const IpcOptions& options,
+                                     std::shared_ptr<RecordBatchWriter>* out) {
   // ctor is private
   auto result = std::shared_ptr<RecordBatchStreamWriter>(new RecordBatchStreamWriter());
-  result->impl_.reset(new RecordBatchStreamWriterImpl(sink, schema));
+  result->impl_.reset(new RecordBatchStreamWriterImpl(sink, schema, options));
   *out = result;
   return Status::OK();
 }
@@ -1043,8 +1256,9 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
  public:
   using BASE = RecordBatchStreamWriter::RecordBatchStreamWriterImpl;
 
-  RecordBatchFileWriterImpl(io::OutputStream* sink, const std::shared_ptr<Schema>& schema)
-      : BASE(sink, schema) {}
+  RecordBatchFileWriterImpl(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+                            const IpcOptions& options)
+      : BASE(sink, schema, options) {}
 
   Status Start() override {
     // ARROW-3236: The initial position -1 needs to be updated to the stream's
@@ -1061,6 +1275,14 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
     return BASE::Start();
   }
 
+  Status WriteDictionaryUpdate(int64_t id, const std::shared_ptr<Array>& values,
+                               bool is_delta) override {
+    return Status::Invalid(
+        "Dictionary replacement and delta dictionaries are not supported in the IPC "
+        "file format (dictionary id ",
+        id, ")");
+  }
+
   Status Close() override {
     // Write the schema if not already written
     // User is responsible for closing the OutputStream
@@ -1095,9 +1317,16 @@ RecordBatchFileWriter::~RecordBatchFileWriter() {}
 Status RecordBatchFileWriter::Open(io::OutputStream* sink,
                                    const std::shared_ptr<Schema>& schema,
                                    std::shared_ptr<RecordBatchWriter>* out) {
+  return Open(sink, schema, IpcOptions::Defaults(), out);
+}
+
+Status RecordBatchFileWriter::Open(io::OutputStream* sink,
+                                   const std::shared_ptr<Schema>& schema,
+                                   const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchWriter>* out) {
   // ctor is private
   auto result = std::shared_ptr<RecordBatchFileWriter>(new RecordBatchFileWriter());
-  result->file_impl_.reset(new RecordBatchFileWriterImpl(sink, schema));
+  result->file_impl_.reset(new RecordBatchFileWriterImpl(sink, schema, options));
   *out = result;
   return Status::OK();
 }
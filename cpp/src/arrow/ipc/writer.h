@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "arrow/ipc/message.h"
+#include "arrow/ipc/options.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -101,8 +102,25 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
   static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
                      std::shared_ptr<RecordBatchWriter>* out);
 
+  /// Create a new writer from stream sink, schema and IPC write options. User
+  /// is responsible for closing the actual OutputStream.
+  ///
+  /// \param[in] sink output stream to write to
+  /// \param[in] schema the schema of the record batches to be written
+  /// \param[in] options options for serialization, e.g. body compression
+  /// \param[out] out the created stream writer
+  /// \return Status
+  static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+                     const IpcOptions& options,
+                     std::shared_ptr<RecordBatchWriter>* out);
+
   /// \brief Write a record batch to the stream
   ///
+  /// If a dictionary-encoded column of the batch has a different dictionary
+  /// than the one last written for that field, a replacement (or, with
+  /// IpcOptions::emit_dictionary_deltas, a delta) dictionary batch is written
+  /// first
+  ///
   /// \param[in] batch the record batch to write
   /// \param[in] allow_64bit allow array lengths over INT32_MAX - 1
   /// \return Status
@@ -138,8 +156,22 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
   static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
                      std::shared_ptr<RecordBatchWriter>* out);
 
+  /// Create a new writer from stream sink, schema and IPC write options
+  ///
+  /// \param[in] sink output stream to write to
+  /// \param[in] schema the schema of the record batches to be written
+  /// \param[in] options options for serialization, e.g. body compression
+  /// \param[out] out the created stream writer
+  /// \return Status
+  static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+                     const IpcOptions& options,
+                     std::shared_ptr<RecordBatchWriter>* out);
+
   /// \brief Write a record batch to the file
   ///
+  /// The file format does not support dictionary replacement: returns Invalid
+  /// if the dictionaries of the batch differ from those of the schema
+  ///
   /// \param[in] batch the record batch to write
   /// \param[in] allow_64bit allow array lengths over INT32_MAX - 1
   /// \return Status
@@ -191,6 +223,26 @@ Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
                         int max_recursion_depth = kMaxNestingDepth,
                         bool allow_64bit = false);
 
+/// \brief Low-level API for writing a record batch (without schema) to an
+/// OutputStream with the given IPC write options
+///
+/// \param[in] batch the record batch to write
+/// \param[in] buffer_start_offset the start offset to use in the buffer metadata,
+/// generally should be 0
+/// \param[in] dst an OutputStream
+/// \param[out] metadata_length the size of the length-prefixed flatbuffer
+/// including padding to a 64-byte boundary
+/// \param[out] body_length the size of the contiguous buffer block plus
+/// padding bytes
+/// \param[in] options options for serialization, e.g. body compression
+/// \param[in] pool the memory pool to allocate memory from
+/// \return Status
+ARROW_EXPORT
+Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
+                        io::OutputStream* dst, int32_t* metadata_length,
+                        int64_t* body_length, const IpcOptions& options,
+                        MemoryPool* pool);
+
 /// \brief Serialize record batch as encapsulated IPC message in a new buffer
 ///
 /// \param[in] batch the record batch
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/json/chunker.h"
+#include "arrow/json/options.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace json {
+
+void AssertChunkSize(Chunker& chunker, const std::string& str, uint32_t chunk_size) {
+  uint32_t actual_chunk_size;
+  ASSERT_OK(
+      chunker.Process(str.data(), static_cast<uint32_t>(str.size()), &actual_chunk_size));
+  ASSERT_EQ(actual_chunk_size, chunk_size);
+}
+
+// Check chunking of the whole block, then of its incomplete prefixes
+template <typename IntContainer>
+void AssertChunking(Chunker& chunker, const std::string& str,
+                    const IntContainer& lengths) {
+  uint32_t expected_chunk_size =
+      static_cast<uint32_t>(std::accumulate(lengths.begin(), lengths.end(), 0ULL));
+  AssertChunkSize(chunker, str, expected_chunk_size);
+
+  expected_chunk_size = 0;
+  for (const auto length : lengths) {
+    AssertChunkSize(chunker, str.substr(0, expected_chunk_size + length - 1),
+                    expected_chunk_size);
+
+    expected_chunk_size += static_cast<uint32_t>(length);
+    AssertChunkSize(chunker, str.substr(0, expected_chunk_size), expected_chunk_size);
+  }
+}
+
+class BaseChunkerTest : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    options_ = ParseOptions::Defaults();
+    options_.newlines_in_values = GetParam();
+  }
+
+  ParseOptions options_;
+};
+
+INSTANTIATE_TEST_CASE_P(ChunkerTest, BaseChunkerTest, ::testing::Values(true));
+
+INSTANTIATE_TEST_CASE_P(NoNewlineChunkerTest, BaseChunkerTest, ::testing::Values(false));
+
+TEST_P(BaseChunkerTest, Basics) {
+  Chunker chunker(options_);
+  if (options_.newlines_in_values) {
+    // Chunks end with the last complete object
+    AssertChunking(chunker, "{\"a\":1}\n{\"b\":[2,3]}\n{}",
+                   std::vector<int>{7, 12, 3});
+  } else {
+    // Chunks end with the last line separator
+    AssertChunking(chunker, "{\"a\":1}\n{\"b\":[2,3]}\n{}\n",
+                   std::vector<int>{8, 12, 3});
+  }
+}
+
+TEST_P(BaseChunkerTest, Empty) {
+  Chunker chunker(options_);
+  AssertChunkSize(chunker, "", 0);
+}
+
+TEST(ChunkerTest, MultilineObjects) {
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  Chunker chunker(options);
+
+  AssertChunking(chunker, "{\n  \"a\": {\"b\": 1}\n}\n[\n]",
+                 std::vector<int>{19, 4});
+  // Brackets and quotes in strings are ignored
+  AssertChunking(chunker, "{\"a\": \"}{\\\"\"}{\"b\": \"]\"}",
+                 std::vector<int>{13, 10});
+  // Unfinished escape or string
+  AssertChunkSize(chunker, "{\"a\": 1}{\"b\": \"\\", 8);
+  AssertChunkSize(chunker, "{\"a\": 1}{\"b\": \"}", 8);
+}
+
+TEST(ChunkerTest, Errors) {
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  Chunker chunker(options);
+
+  uint32_t out_size;
+  ASSERT_RAISES(Invalid, chunker.Process("{}}", 3, &out_size));
+  ASSERT_RAISES(Invalid, chunker.Process("]", 1, &out_size));
+}
+
+TEST(NoNewlineChunkerTest, LineSeparators) {
+  Chunker chunker(ParseOptions::Defaults());
+
+  AssertChunking(chunker, "{}\r\n{\"a\":\n1}\r{}\n", std::vector<int>{3, 1, 6, 3, 3});
+}
+
+}  // namespace json
+}  // namespace arrow
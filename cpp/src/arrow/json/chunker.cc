@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/chunker.h"
+
+#include <cstdint>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace json {
+
+namespace {
+
+// Find the last newline character in the given data block.
+// nullptr is returned if not found (like memchr()).
+const char* FindNewlineReverse(const char* data, uint32_t size) {
+  const char* s = data + size;
+  while (s != data) {
+    --s;
+    if (*s == '\n' || *s == '\r') {
+      return s;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+Chunker::Chunker(ParseOptions options) : options_(options) {}
+
+Status Chunker::ScanValues(const char* data, const char* data_end, const char** out) {
+  const char* last_end = data;
+  int64_t depth = 0;
+  const char* s = data;
+
+  while (s != data_end) {
+    switch (*s++) {
+      case '"':
+        // Skip string contents, which may contain any brackets
+        while (true) {
+          if (ARROW_PREDICT_FALSE(s == data_end)) {
+            *out = last_end;
+            return Status::OK();
+          }
+          const char c = *s++;
+          if (c == '"') {
+            break;
+          }
+          if (c == '\\') {
+            if (ARROW_PREDICT_FALSE(s == data_end)) {
+              *out = last_end;
+              return Status::OK();
+            }
+            ++s;
+          }
+        }
+        break;
+      case '{':
+      case '[':
+        ++depth;
+        break;
+      case '}':
+      case ']':
+        if (ARROW_PREDICT_FALSE(depth == 0)) {
+          return Status::Invalid("Unbalanced closing bracket in JSON data");
+        }
+        if (--depth == 0) {
+          last_end = s;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  *out = last_end;
+  return Status::OK();
+}
+
+Status Chunker::Process(const char* data, uint32_t size, uint32_t* out_size) {
+  if (options_.newlines_in_values) {
+    const char* end;
+    RETURN_NOT_OK(ScanValues(data, data + size, &end));
+    *out_size = static_cast<uint32_t>(end - data);
+  } else {
+    // Each object is on its own line: cut after the last line separator
+    const char* nl = FindNewlineReverse(data, size);
+    *out_size = (nl == nullptr) ? 0 : static_cast<uint32_t>(nl - data + 1);
+  }
+  return Status::OK();
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_JSON_CHUNKER_H
+#define ARROW_JSON_CHUNKER_H
+
+#include <cstdint>
+
+#include "arrow/json/options.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+
+/// \class Chunker
+/// \brief A reusable block-based chunker for newline-delimited JSON data
+///
+/// The chunker takes a block of JSON data and finds a suitable place
+/// to cut it up without splitting an object.
+/// If the block is truncated (i.e. not all data can be chunked), it is up
+/// to the caller to arrange the next block to start with the trailing data.
+class ARROW_EXPORT Chunker {
+ public:
+  explicit Chunker(ParseOptions options);
+
+  /// \brief Carve up a chunk in a block of data
+  ///
+  /// Process a block of JSON data, reading up to size bytes.
+  /// The number of bytes in the chunk is returned in out_size.
+  Status Process(const char* data, uint32_t size, uint32_t* out_size);
+
+ protected:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Chunker);
+
+  // Return the end of the last complete top-level value, scanning the
+  // structure of the data (for when objects may span several lines)
+  Status ScanValues(const char* data, const char* data_end, const char** out);
+
+  ParseOptions options_;
+};
+
+}  // namespace json
+}  // namespace arrow
+
+#endif  // ARROW_JSON_CHUNKER_H
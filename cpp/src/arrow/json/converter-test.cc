@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/json/converter.h"
+#include "arrow/memory_pool.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace json {
+
+void AssertUnified(const std::shared_ptr<DataType>& left,
+                   const std::shared_ptr<DataType>& right,
+                   const std::shared_ptr<DataType>& expected) {
+  std::shared_ptr<DataType> actual;
+  ASSERT_OK(UnifyTypes(left, right, &actual));
+  ASSERT_TRUE(actual->Equals(*expected)) << actual->ToString();
+}
+
+void AssertPromoted(const std::shared_ptr<DataType>& from_type,
+                    const std::string& from_json,
+                    const std::shared_ptr<DataType>& to_type,
+                    const std::string& expected_json) {
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(PromoteArray(default_memory_pool(), ArrayFromJSON(from_type, from_json),
+                         to_type, &actual));
+  ASSERT_OK(ValidateArray(*actual));
+  AssertArraysEqual(*ArrayFromJSON(to_type, expected_json), *actual);
+}
+
+TEST(UnifyTypes, Basics) {
+  AssertUnified(int64(), int64(), int64());
+  AssertUnified(null(), utf8(), utf8());
+  AssertUnified(boolean(), null(), boolean());
+  AssertUnified(int64(), float64(), float64());
+  AssertUnified(float64(), int64(), float64());
+
+  std::shared_ptr<DataType> out;
+  ASSERT_RAISES(Invalid, UnifyTypes(int64(), utf8(), &out));
+  ASSERT_RAISES(Invalid, UnifyTypes(list(int64()), struct_({}), &out));
+}
+
+TEST(UnifyTypes, Nested) {
+  AssertUnified(list(null()), list(int64()), list(int64()));
+  AssertUnified(list(list(int64())), list(list(float64())), list(list(float64())));
+
+  // Struct fields are merged in order of first appearance
+  AssertUnified(
+      struct_({field("a", int64()), field("b", null())}),
+      struct_({field("c", utf8()), field("b", boolean()), field("a", float64())}),
+      struct_({field("a", float64()), field("b", boolean()), field("c", utf8())}));
+
+  std::shared_ptr<DataType> out;
+  ASSERT_RAISES(Invalid, UnifyTypes(struct_({field("a", struct_({field("b", utf8())}))}),
+                                    struct_({field("a", struct_({field("b", int64())}))}),
+                                    &out));
+}
+
+TEST(PromoteArray, Basics) {
+  AssertPromoted(int64(), "[1, null, -2]", int64(), "[1, null, -2]");
+  AssertPromoted(int64(), "[1, null, -2]", float64(), "[1.0, null, -2.0]");
+  AssertPromoted(null(), "[null, null]", utf8(), "[null, null]");
+  AssertPromoted(null(), "[null, null]", list(int64()), "[null, null]");
+  AssertPromoted(null(), "[null]", struct_({field("a", boolean())}), "[null]");
+
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, PromoteArray(default_memory_pool(),
+                                      ArrayFromJSON(utf8(), "[\"x\"]"), int64(), &out));
+}
+
+TEST(PromoteArray, Nested) {
+  AssertPromoted(list(int64()), "[[1], null, [2, 3]]", list(float64()),
+                 "[[1.0], null, [2.0, 3.0]]");
+
+  auto from_type = struct_({field("b", int64()), field("a", null())});
+  auto to_type = struct_({field("a", utf8()), field("b", float64()), field("c", null()),
+                          field("d", list(boolean()))});
+  AssertPromoted(from_type, "[[1, null], null, [null, null]]", to_type,
+                 "[{\"b\": 1.0}, null, {}]");
+
+  // Sliced input
+  auto sliced = ArrayFromJSON(from_type, "[[1, null], null, [2, null]]")->Slice(1);
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(PromoteArray(default_memory_pool(), sliced, to_type, &actual));
+  ASSERT_OK(ValidateArray(*actual));
+  AssertArraysEqual(*ArrayFromJSON(to_type, "[null, {\"b\": 2.0}]"), *actual);
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,234 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/converter.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace json {
+
+using internal::checked_cast;
+
+namespace {
+
+std::string ChildPath(const std::string& path, const std::string& name) {
+  return path.empty() ? name : path + "." + name;
+}
+
+Status UnifyTypes(const std::string& path, const std::shared_ptr<DataType>& left,
+                  const std::shared_ptr<DataType>& right,
+                  std::shared_ptr<DataType>* out) {
+  if (left->Equals(*right) || right->id() == Type::NA) {
+    *out = left;
+    return Status::OK();
+  }
+  if (left->id() == Type::NA) {
+    *out = right;
+    return Status::OK();
+  }
+  if ((left->id() == Type::INT64 && right->id() == Type::DOUBLE) ||
+      (left->id() == Type::DOUBLE && right->id() == Type::INT64)) {
+    *out = float64();
+    return Status::OK();
+  }
+  if (left->id() == Type::STRUCT && right->id() == Type::STRUCT) {
+    const auto& left_struct = checked_cast<const StructType&>(*left);
+    std::vector<std::shared_ptr<Field>> fields = left->children();
+    for (const auto& right_field : right->children()) {
+      const int index = left_struct.GetFieldIndex(right_field->name());
+      if (index == -1) {
+        fields.push_back(right_field);
+        continue;
+      }
+      std::shared_ptr<DataType> type;
+      RETURN_NOT_OK(UnifyTypes(ChildPath(path, right_field->name()),
+                               fields[index]->type(), right_field->type(), &type));
+      fields[index] = field(right_field->name(), type);
+    }
+    *out = struct_(fields);
+    return Status::OK();
+  }
+  if (left->id() == Type::LIST && right->id() == Type::LIST) {
+    const auto& value_field = checked_cast<const ListType&>(*left).value_field();
+    std::shared_ptr<DataType> value_type;
+    RETURN_NOT_OK(UnifyTypes(path + "[]", value_field->type(),
+                             checked_cast<const ListType&>(*right).value_type(),
+                             &value_type));
+    *out = list(field(value_field->name(), value_type));
+    return Status::OK();
+  }
+  return Status::Invalid("JSON field '", path, "' has incompatible types ",
+                         left->ToString(), " and ", right->ToString(),
+                         " in different blocks");
+}
+
+Status AllocateZeroed(MemoryPool* pool, int64_t size, std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool, size, &buffer));
+  std::memset(buffer->mutable_data(), 0, static_cast<size_t>(size));
+  *out = std::move(buffer);
+  return Status::OK();
+}
+
+// Make an array of `length` nulls of the given type
+Status MakeNullArray(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                     int64_t length, std::shared_ptr<Array>* out) {
+  if (type->id() == Type::NA) {
+    *out = std::make_shared<NullArray>(length);
+    return Status::OK();
+  }
+  std::shared_ptr<Buffer> null_bitmap;
+  RETURN_NOT_OK(AllocateZeroed(pool, BitUtil::BytesForBits(length), &null_bitmap));
+
+  switch (type->id()) {
+    case Type::STRING:
+    case Type::BINARY: {
+      std::shared_ptr<Buffer> offsets, data;
+      RETURN_NOT_OK(AllocateZeroed(pool, (length + 1) * sizeof(int32_t), &offsets));
+      RETURN_NOT_OK(AllocateBuffer(pool, 0, &data));
+      *out = MakeArray(
+          ArrayData::Make(type, length, {null_bitmap, offsets, data}, length));
+      return Status::OK();
+    }
+    case Type::LIST: {
+      std::shared_ptr<Buffer> offsets;
+      std::shared_ptr<Array> values;
+      RETURN_NOT_OK(AllocateZeroed(pool, (length + 1) * sizeof(int32_t), &offsets));
+      RETURN_NOT_OK(MakeNullArray(
+          pool, checked_cast<const ListType&>(*type).value_type(), 0, &values));
+      *out = std::make_shared<ListArray>(type, length, offsets, values, null_bitmap,
+                                         length);
+      return Status::OK();
+    }
+    case Type::STRUCT: {
+      std::vector<std::shared_ptr<Array>> children;
+      for (const auto& child_field : type->children()) {
+        std::shared_ptr<Array> child;
+        RETURN_NOT_OK(MakeNullArray(pool, child_field->type(), length, &child));
+        children.push_back(std::move(child));
+      }
+      *out = std::make_shared<StructArray>(type, length, children, null_bitmap, length);
+      return Status::OK();
+    }
+    default: {
+      const int bit_width = checked_cast<const FixedWidthType&>(*type).bit_width();
+      std::shared_ptr<Buffer> data;
+      RETURN_NOT_OK(
+          AllocateZeroed(pool, BitUtil::BytesForBits(length * bit_width), &data));
+      *out = MakeArray(ArrayData::Make(type, length, {null_bitmap, data}, length));
+      return Status::OK();
+    }
+  }
+}
+
+}  // namespace
+
+Status UnifyTypes(const std::shared_ptr<DataType>& left,
+                  const std::shared_ptr<DataType>& right,
+                  std::shared_ptr<DataType>* out) {
+  return UnifyTypes("", left, right, out);
+}
+
+Status PromoteArray(MemoryPool* pool, const std::shared_ptr<Array>& array,
+                    const std::shared_ptr<DataType>& type, std::shared_ptr<Array>* out) {
+  if (array->type()->Equals(*type)) {
+    *out = array;
+    return Status::OK();
+  }
+  const ArrayData& data = *array->data();
+
+  // The promoted arrays keep the offset and null bitmap of `array`
+  switch (array->type_id()) {
+    case Type::NA:
+      return MakeNullArray(pool, type, array->length(), out);
+
+    case Type::INT64: {
+      if (type->id() != Type::DOUBLE) {
+        break;
+      }
+      const int64_t length = data.offset + data.length;
+      std::shared_ptr<Buffer> values;
+      RETURN_NOT_OK(AllocateBuffer(pool, length * sizeof(double), &values));
+      const auto in = data.GetValues<int64_t>(1, 0);
+      auto out_values = reinterpret_cast<double*>(values->mutable_data());
+      for (int64_t i = 0; i < length; ++i) {
+        out_values[i] = static_cast<double>(in[i]);
+      }
+      *out = MakeArray(ArrayData::Make(type, data.length, {data.buffers[0], values},
+                                       data.null_count, data.offset));
+      return Status::OK();
+    }
+
+    case Type::STRUCT: {
+      if (type->id() != Type::STRUCT) {
+        break;
+      }
+      const auto& struct_type = checked_cast<const StructType&>(*array->type());
+      std::vector<std::shared_ptr<Array>> children;
+      for (const auto& child_field : type->children()) {
+        const int index = struct_type.GetFieldIndex(child_field->name());
+        std::shared_ptr<Array> child;
+        if (index == -1) {
+          RETURN_NOT_OK(MakeNullArray(pool, child_field->type(),
+                                      data.offset + data.length, &child));
+        } else {
+          RETURN_NOT_OK(PromoteArray(pool, MakeArray(data.child_data[index]),
+                                     child_field->type(), &child));
+        }
+        children.push_back(std::move(child));
+      }
+      *out = std::make_shared<StructArray>(type, data.length, children, data.buffers[0],
+                                           data.null_count, data.offset);
+      return Status::OK();
+    }
+
+    case Type::LIST: {
+      if (type->id() != Type::LIST) {
+        break;
+      }
+      const auto& list_array = checked_cast<const ListArray&>(*array);
+      std::shared_ptr<Array> values;
+      RETURN_NOT_OK(PromoteArray(pool, list_array.values(),
+                                 checked_cast<const ListType&>(*type).value_type(),
+                                 &values));
+      *out = std::make_shared<ListArray>(type, data.length, data.buffers[1], values,
+                                         data.buffers[0], data.null_count, data.offset);
+      return Status::OK();
+    }
+
+    default:
+      break;
+  }
+  return Status::Invalid("Cannot promote JSON values of type ", array->type()->ToString(),
+                         " to ", type->ToString());
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_JSON_CONVERTER_H
+#define ARROW_JSON_CONVERTER_H
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class MemoryPool;
+
+namespace json {
+
+/// \brief Compute a type able to hold the values of two parsed blocks
+///
+/// Blocks are parsed independently, so the same field may be inferred with
+/// different types in different blocks.  The types are unified with the
+/// rules of BlockParser: the null type yields to any other type, int64
+/// yields to float64, struct fields are merged (in order of first
+/// appearance) and list value types are unified recursively.
+/// Other mixes of types are an error.
+ARROW_EXPORT
+Status UnifyTypes(const std::shared_ptr<DataType>& left,
+                  const std::shared_ptr<DataType>& right,
+                  std::shared_ptr<DataType>* out);
+
+/// \brief Convert a parsed block to a unified type
+///
+/// `type` must have been obtained by unifying the type of `array` with
+/// other types (see UnifyTypes).  Struct fields absent from `array` are
+/// filled with nulls.
+ARROW_EXPORT
+Status PromoteArray(MemoryPool* pool, const std::shared_ptr<Array>& array,
+                    const std::shared_ptr<DataType>& type, std::shared_ptr<Array>* out);
+
+}  // namespace json
+}  // namespace arrow
+
+#endif  // ARROW_JSON_CONVERTER_H
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <sstream>
+#include <string>
+
+#include "arrow/array.h"
+#include "arrow/json/chunker.h"
+#include "arrow/json/options.h"
+#include "arrow/json/parser.h"
+#include "arrow/memory_pool.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace json {
+
+static std::string BuildJSONData(int32_t num_rows = 10000) {
+  std::stringstream ss;
+  for (int32_t i = 0; i < num_rows; ++i) {
+    ss << "{\"id\": " << i << ", \"name\": \"user " << i
+       << "\", \"score\": " << i * 0.25 << ", \"active\": " << (i % 2 ? "true" : "false")
+       << ", \"tags\": [\"a\", \"b\"], \"address\": {\"city\": \"Paris\", \"zip\": "
+       << 75000 + i % 20 << "}}\n";
+  }
+  return ss.str();
+}
+
+static void BenchmarkJSONChunking(benchmark::State& state,  // NOLINT non-const reference
+                                  const std::string& json, ParseOptions options) {
+  Chunker chunker(options);
+
+  while (state.KeepRunning()) {
+    uint32_t chunk_size;
+    ABORT_NOT_OK(
+        chunker.Process(json.data(), static_cast<uint32_t>(json.size()), &chunk_size));
+    if (chunk_size == 0) {
+      std::cerr << "Chunking failed\n";
+      std::abort();
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+static void BM_ChunkJSONBlock(benchmark::State& state) {  // NOLINT non-const reference
+  auto json = BuildJSONData(5000);
+  BenchmarkJSONChunking(state, json, ParseOptions::Defaults());
+}
+
+static void BM_ChunkJSONMultilineBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto json = BuildJSONData(5000);
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  BenchmarkJSONChunking(state, json, options);
+}
+
+static void BenchmarkJSONParsing(benchmark::State& state,  // NOLINT non-const reference
+                                 const std::string& json, int32_t num_rows,
+                                 ParseOptions options) {
+  while (state.KeepRunning()) {
+    BlockParser parser(default_memory_pool(), options);
+    ABORT_NOT_OK(parser.Parse(json.data(), static_cast<uint32_t>(json.size())));
+    if (parser.num_rows() != num_rows) {
+      std::cerr << "Parsing incomplete\n";
+      std::abort();
+    }
+    std::shared_ptr<Array> parsed;
+    ABORT_NOT_OK(parser.Finish(&parsed));
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+static void BM_ParseJSONBlock(benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto json = BuildJSONData(num_rows);
+  BenchmarkJSONParsing(state, json, num_rows, ParseOptions::Defaults());
+}
+
+static void BM_ParseJSONBlockWithSchema(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto json = BuildJSONData(num_rows);
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("id", int32()), field("name", utf8()), field("score", float32()),
+              field("active", boolean()), field("tags", list(utf8())),
+              field("address", struct_({field("city", utf8()), field("zip", int32())}))});
+  BenchmarkJSONParsing(state, json, num_rows, options);
+}
+
+BENCHMARK(BM_ChunkJSONBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ChunkJSONMultilineBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseJSONBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseJSONBlockWithSchema)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+
+}  // namespace json
+}  // namespace arrow
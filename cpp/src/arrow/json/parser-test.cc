@@ -0,0 +1,229 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/json/options.h"
+#include "arrow/json/parser.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace json {
+
+Status Parse(const ParseOptions& options, const std::string& json,
+             std::shared_ptr<Array>* out) {
+  BlockParser parser(default_memory_pool(), options);
+  RETURN_NOT_OK(parser.Parse(json.data(), static_cast<uint32_t>(json.size())));
+  RETURN_NOT_OK(parser.Finish(out));
+  return Status::OK();
+}
+
+void AssertParsed(const ParseOptions& options, const std::string& json,
+                  const std::shared_ptr<DataType>& type,
+                  const std::string& expected_json) {
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(Parse(options, json, &actual));
+  ASSERT_OK(ValidateArray(*actual));
+  ASSERT_TRUE(actual->type()->Equals(*type)) << actual->type()->ToString();
+  AssertArraysEqual(*ArrayFromJSON(type, expected_json), *actual);
+}
+
+void AssertParsed(const std::string& json, const std::shared_ptr<DataType>& type,
+                  const std::string& expected_json) {
+  AssertParsed(ParseOptions::Defaults(), json, type, expected_json);
+}
+
+void AssertParseError(const ParseOptions& options, const std::string& json) {
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES(Invalid, Parse(options, json, &actual));
+}
+
+void AssertParseError(const std::string& json) {
+  AssertParseError(ParseOptions::Defaults(), json);
+}
+
+TEST(BlockParser, Basics) {
+  auto type = struct_({field("b", boolean()), field("i", int64()), field("f", float64()),
+                       field("s", utf8())});
+  AssertParsed(
+      "{\"b\": true, \"i\": 1, \"f\": 1.5, \"s\": \"foo\"}\n"
+      "{\"b\": false, \"i\": -2, \"f\": -0.25, \"s\": \"\"}\n",
+      type,
+      "[{\"b\": true, \"i\": 1, \"f\": 1.5, \"s\": \"foo\"},"
+      " {\"b\": false, \"i\": -2, \"f\": -0.25, \"s\": \"\"}]");
+}
+
+TEST(BlockParser, Empty) {
+  AssertParsed("", struct_({}), "[]");
+  AssertParsed(" \n\r\n ", struct_({}), "[]");
+  AssertParsed("{}\n{}\n", struct_({}), "[[], []]");
+}
+
+TEST(BlockParser, MissingAndNullFields) {
+  // Fields are ordered by first appearance, absent fields are null
+  auto type = struct_({field("a", int64()), field("n", null()), field("b", utf8())});
+  AssertParsed("{\"a\": 1, \"n\": null}\n{\"b\": \"x\"}\n{\"n\": null, \"a\": null}\n",
+               type, "[[1, null, null], [null, null, \"x\"], [null, null, null]]");
+
+  // Values following nulls
+  AssertParsed("{\"a\": null}\n{\"a\": null}\n{\"a\": true}\n",
+               struct_({field("a", boolean())}), "[[null], [null], [true]]");
+}
+
+TEST(BlockParser, NumberPromotion) {
+  AssertParsed("{\"x\": 1}\n{\"x\": 2.5}\n{\"x\": null}\n{\"x\": -3}\n",
+               struct_({field("x", float64())}), "[[1.0], [2.5], [null], [-3.0]]");
+  // Integers beyond the int64 range
+  AssertParsed("{\"x\": 1}\n{\"x\": 18446744073709551615}\n",
+               struct_({field("x", float64())}), "[[1.0], [18446744073709551615.0]]");
+  AssertParsed("{\"x\": 9223372036854775807}\n{\"x\": -9223372036854775808}\n",
+               struct_({field("x", int64())}),
+               "[[9223372036854775807], [-9223372036854775808]]");
+}
+
+TEST(BlockParser, Nested) {
+  auto type = struct_({field("l", list(int64())),
+                       field("o", struct_({field("x", utf8()), field("y", boolean())}))});
+  AssertParsed(
+      "{\"l\": [1, 2], \"o\": {\"x\": \"a\"}}\n"
+      "{\"l\": [], \"o\": null}\n"
+      "{\"l\": null, \"o\": {\"y\": true, \"x\": \"b\"}}\n",
+      type,
+      "[{\"l\": [1, 2], \"o\": {\"x\": \"a\"}},"
+      " {\"l\": [], \"o\": null},"
+      " {\"l\": null, \"o\": {\"x\": \"b\", \"y\": true}}]");
+
+  // Lists of objects, lists of lists
+  type = struct_({field("l", list(struct_({field("a", float64())}))),
+                  field("m", list(list(utf8())))});
+  AssertParsed("{\"l\": [{\"a\": 1}, {}, null, {\"a\": 0.5}], \"m\": [[\"x\"], []]}\n",
+               type, "[[[{\"a\": 1.0}, {}, null, {\"a\": 0.5}], [[\"x\"], []]]]");
+
+  // Element type inferred after empty lists and nulls
+  AssertParsed("{\"l\": []}\n{\"l\": [null]}\n{\"l\": [\"x\"]}\n",
+               struct_({field("l", list(utf8()))}), "[[[]], [[null]], [[\"x\"]]]");
+  AssertParsed("{\"l\": []}\n", struct_({field("l", list(null()))}), "[[[]]]");
+}
+
+TEST(BlockParser, Strings) {
+  AssertParsed("{\"s\": \"a\\\"b\\\\c\\nd\\u00e9\"}\n", struct_({field("s", utf8())}),
+               "[[\"a\\\"b\\\\c\\nd\xc3\xa9\"]]");
+}
+
+TEST(BlockParser, MultilineObjects) {
+  AssertParsed("{\n  \"a\": [\n    1\n  ]\n}\n{\"a\": [2]}",
+               struct_({field("a", list(int64()))}), "[[[1]], [[2]]]");
+}
+
+TEST(BlockParser, ExplicitSchema) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("i", int16()), field("u", uint8()), field("f", float32()),
+              field("t", timestamp(TimeUnit::SECOND)), field("b", binary()),
+              field("l", list(int32()))});
+  // Fields of the explicit schema always appear, before inferred fields
+  auto type = struct_({field("i", int16()), field("u", uint8()), field("f", float32()),
+                       field("t", timestamp(TimeUnit::SECOND)), field("b", binary()),
+                       field("l", list(int32())), field("x", int64())});
+  AssertParsed(options,
+               "{\"x\": 1, \"f\": 1, \"i\": -5, \"t\": \"1970-01-02\", \"b\": \"z\"}\n"
+               "{\"u\": 255, \"f\": 0.5, \"t\": 60, \"l\": [1, null]}\n",
+               type,
+               "[[-5, null, 1.0, 86400, \"z\", null, 1],"
+               " [null, 255, 0.5, 60, null, [1, null], null]]");
+  AssertParsed(options, "", struct_(options.explicit_schema->fields()), "[]");
+
+  // Conversion errors
+  AssertParseError(options, "{\"i\": 32768}\n");
+  AssertParseError(options, "{\"u\": -1}\n");
+  AssertParseError(options, "{\"i\": 1.5}\n");
+  AssertParseError(options, "{\"i\": \"1\"}\n");
+  AssertParseError(options, "{\"t\": \"yesterday\"}\n");
+  AssertParseError(options, "{\"l\": {}}\n");
+  AssertParseError(options, "{\"l\": [1.5]}\n");
+}
+
+TEST(BlockParser, UnexpectedFields) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int64())});
+  const std::string json = "{\"a\": 1, \"b\": {\"c\": [1, {}]}}\n{\"b\": 1, \"a\": 2}\n";
+
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParsed(options, json, struct_({field("a", int64())}), "[[1], [2]]");
+
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  AssertParseError(options, json);
+  AssertParsed(options, "{\"a\": 1}\n", struct_({field("a", int64())}), "[[1]]");
+
+  // Fields of nested objects follow the same rules
+  options.explicit_schema = schema({field("s", struct_({field("x", boolean())}))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParsed(options, "{\"s\": {\"y\": [], \"x\": true}}\n",
+               struct_({field("s", struct_({field("x", boolean())}))}), "[[[true]]]");
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  AssertParseError(options, "{\"s\": {\"y\": [], \"x\": true}}\n");
+}
+
+TEST(BlockParser, Errors) {
+  // Invalid JSON
+  AssertParseError("{\"a\": 1\n");
+  AssertParseError("{\"a\": tru}\n");
+  AssertParseError("{\"a\": \"\xff\"}\n");
+  // Rows must be objects
+  AssertParseError("[1, 2]\n");
+  AssertParseError("1\n");
+  AssertParseError("{}\n\"x\"\n");
+  // Mixed types
+  AssertParseError("{\"a\": 1}\n{\"a\": \"x\"}\n");
+  AssertParseError("{\"a\": [1]}\n{\"a\": {}}\n");
+  AssertParseError("{\"a\": [1, true]}\n");
+  AssertParseError("{\"a\": {\"b\": 1}}\n{\"a\": {\"b\": false}}\n");
+  // Duplicate fields
+  AssertParseError("{\"a\": 1, \"a\": 2}\n");
+
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("d", decimal(5, 2))});
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(NotImplemented, Parse(options, "{}\n", &out));
+}
+
+TEST(BlockParser, SeveralBlocks) {
+  BlockParser parser(default_memory_pool(), ParseOptions::Defaults());
+  const std::string first = "{\"a\": 1}\n";
+  const std::string second = "{\"b\": true}\n{\"a\": 2}\n";
+  ASSERT_OK(parser.Parse(first.data(), static_cast<uint32_t>(first.size())));
+  ASSERT_EQ(parser.num_rows(), 1);
+  ASSERT_OK(parser.Parse(second.data(), static_cast<uint32_t>(second.size())));
+  ASSERT_EQ(parser.num_rows(), 3);
+
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(parser.Finish(&actual));
+  auto type = struct_({field("a", int64()), field("b", boolean())});
+  AssertArraysEqual(*ArrayFromJSON(type, "[[1, null], [null, true], [2, null]]"),
+                    *actual);
+}
+
+}  // namespace json
+}  // namespace arrow
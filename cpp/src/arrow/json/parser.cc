@@ -0,0 +1,819 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/parser.h"
+
+#include "arrow/json/rapidjson-internal.h"  // IWYU pragma: keep
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rapidjson/encodedstream.h"
+#include "rapidjson/error/en.h"
+#include "rapidjson/memorystream.h"
+#include "rapidjson/reader.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer-builder.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parsing.h"
+
+namespace arrow {
+namespace json {
+
+namespace rj = arrow::rapidjson;
+
+using internal::checked_cast;
+using internal::StringConverter;
+
+namespace {
+
+bool IsSupportedType(const DataType& type) {
+  switch (type.id()) {
+    case Type::NA:
+    case Type::BOOL:
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+    case Type::UINT8:
+    case Type::UINT16:
+    case Type::UINT32:
+    case Type::UINT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::TIMESTAMP:
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LIST:
+    case Type::STRUCT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Builds the values of a JSON field.  The type of the field is either fixed
+// by the explicit schema, or inferred from the values appended so far.
+class ValueBuilder {
+ public:
+  static Status Make(MemoryPool* pool, const ParseOptions& options, std::string path,
+                     const std::shared_ptr<DataType>& type, bool fixed,
+                     std::unique_ptr<ValueBuilder>* out) {
+    if (!IsSupportedType(*type)) {
+      return Status::NotImplemented("JSON field '", path, "': conversion to ",
+                                    type->ToString(), " is not supported");
+    }
+    std::unique_ptr<ValueBuilder> builder(
+        new ValueBuilder(pool, options, std::move(path), type, fixed));
+    RETURN_NOT_OK(builder->Init());
+    *out = std::move(builder);
+    return Status::OK();
+  }
+
+  int64_t length() const { return length_; }
+
+  Type::type type_id() const { return type_->id(); }
+
+  Status AppendNull() {
+    if (type_->id() == Type::NA) {
+      ++length_;
+      return Status::OK();
+    }
+    RETURN_NOT_OK(validity_.Append(false));
+    switch (type_->id()) {
+      case Type::BOOL:
+        RETURN_NOT_OK(bool_values_.Append(false));
+        break;
+      case Type::STRING:
+      case Type::BINARY:
+        RETURN_NOT_OK(offsets_.Append(static_cast<int32_t>(data_.length())));
+        break;
+      case Type::LIST:
+        RETURN_NOT_OK(offsets_.Append(static_cast<int32_t>(values_->length())));
+        break;
+      case Type::STRUCT:
+        for (const auto& child : children_) {
+          RETURN_NOT_OK(child->AppendNull());
+        }
+        break;
+      default:
+        RETURN_NOT_OK(data_.Advance(byte_width_));
+        break;
+    }
+    ++length_;
+    return Status::OK();
+  }
+
+  Status AppendBool(bool value) {
+    switch (type_->id()) {
+      case Type::NA:
+        RETURN_NOT_OK(InferType(boolean(), "boolean"));
+        break;
+      case Type::BOOL:
+        break;
+      default:
+        return TypeError("boolean");
+    }
+    RETURN_NOT_OK(validity_.Append(true));
+    RETURN_NOT_OK(bool_values_.Append(value));
+    ++length_;
+    return Status::OK();
+  }
+
+  Status AppendInt64(int64_t value) {
+    switch (type_->id()) {
+      case Type::NA:
+        RETURN_NOT_OK(InferType(int64(), "number"));
+        return AppendValue(value);
+      case Type::INT64:
+      case Type::TIMESTAMP:
+        return AppendValue(value);
+      case Type::INT8:
+        return AppendInteger<int8_t>(value);
+      case Type::INT16:
+        return AppendInteger<int16_t>(value);
+      case Type::INT32:
+        return AppendInteger<int32_t>(value);
+      case Type::UINT8:
+        return AppendInteger<uint8_t>(value);
+      case Type::UINT16:
+        return AppendInteger<uint16_t>(value);
+      case Type::UINT32:
+        return AppendInteger<uint32_t>(value);
+      case Type::UINT64:
+        return AppendInteger<uint64_t>(value);
+      case Type::FLOAT:
+        return AppendValue(static_cast<float>(value));
+      case Type::DOUBLE:
+        return AppendValue(static_cast<double>(value));
+      default:
+        return TypeError("number");
+    }
+  }
+
+  // Append an integer too large for int64
+  Status AppendUInt64(uint64_t value) {
+    if (type_->id() == Type::UINT64) {
+      return AppendValue(value);
+    }
+    return AppendDouble(static_cast<double>(value));
+  }
+
+  Status AppendDouble(double value) {
+    switch (type_->id()) {
+      case Type::NA:
+        RETURN_NOT_OK(InferType(float64(), "number"));
+        return AppendValue(value);
+      case Type::INT64:
+        if (!fixed_) {
+          PromoteToDouble();
+          return AppendValue(value);
+        }
+        return ConversionError(value);
+      case Type::INT8:
+      case Type::INT16:
+      case Type::INT32:
+      case Type::UINT8:
+      case Type::UINT16:
+      case Type::UINT32:
+      case Type::UINT64:
+      case Type::TIMESTAMP:
+        return ConversionError(value);
+      case Type::FLOAT:
+        return AppendValue(static_cast<float>(value));
+      case Type::DOUBLE:
+        return AppendValue(value);
+      default:
+        return TypeError("number");
+    }
+  }
+
+  Status AppendString(const char* data, uint32_t size) {
+    switch (type_->id()) {
+      case Type::NA:
+        RETURN_NOT_OK(InferType(utf8(), "string"));
+        break;
+      case Type::STRING:
+      case Type::BINARY:
+        break;
+      case Type::TIMESTAMP: {
+        int64_t value;
+        if (!(*timestamp_converter_)(data, size, &value)) {
+          return ConversionError("'" + std::string(data, size) + "'");
+        }
+        return AppendValue(value);
+      }
+      default:
+        return TypeError("string");
+    }
+    RETURN_NOT_OK(validity_.Append(true));
+    RETURN_NOT_OK(data_.Append(data, size));
+    RETURN_NOT_OK(offsets_.Append(static_cast<int32_t>(data_.length())));
+    ++length_;
+    return Status::OK();
+  }
+
+  Status StartStruct() {
+    switch (type_->id()) {
+      case Type::NA:
+        return InferType(struct_({}), "object");
+      case Type::STRUCT:
+        return Status::OK();
+      default:
+        return TypeError("object");
+    }
+  }
+
+  // Get the builder for a field of the current object.  nullptr is
+  // returned if the field should be skipped.
+  Status GetChild(const char* key, uint32_t size, ValueBuilder** out) {
+    int index = -1;
+    // Objects usually list their fields in the same order, so try the field
+    // following the previous one before looking up the key
+    const int num_children = static_cast<int>(children_.size());
+    if (next_child_ < num_children && child_names_[next_child_].size() == size &&
+        std::memcmp(child_names_[next_child_].data(), key, size) == 0) {
+      index = next_child_;
+    } else {
+      auto it = child_indices_.find(std::string(key, size));
+      if (it != child_indices_.end()) {
+        index = it->second;
+      }
+    }
+
+    if (index == -1) {
+      std::string name(key, size);
+      if (fixed_) {
+        switch (options_.unexpected_field_behavior) {
+          case UnexpectedFieldBehavior::Ignore:
+            *out = nullptr;
+            return Status::OK();
+          case UnexpectedFieldBehavior::Error:
+            return Status::Invalid("JSON field '", ChildPath(name),
+                                   "' is not in the explicit schema");
+          case UnexpectedFieldBehavior::InferType:
+            break;
+        }
+      }
+      std::unique_ptr<ValueBuilder> child;
+      RETURN_NOT_OK(Make(pool_, options_, ChildPath(name), null(), false, &child));
+      // The field was absent from previous objects
+      RETURN_NOT_OK(child->AppendNulls(length_));
+      index = AddChild(std::move(name), std::move(child));
+    }
+
+    ValueBuilder* child = children_[index].get();
+    if (ARROW_PREDICT_FALSE(child->length() > length_)) {
+      return Status::Invalid("JSON field '", child->path_,
+                             "' appears twice in the same object");
+    }
+    next_child_ = index + 1;
+    *out = child;
+    return Status::OK();
+  }
+
+  Status EndStruct() {
+    // Fields absent from the object are null
+    for (const auto& child : children_) {
+      if (child->length() == length_) {
+        RETURN_NOT_OK(child->AppendNull());
+      }
+    }
+    next_child_ = 0;
+    RETURN_NOT_OK(validity_.Append(true));
+    ++length_;
+    return Status::OK();
+  }
+
+  Status StartList() {
+    switch (type_->id()) {
+      case Type::NA:
+        return InferType(list(null()), "array");
+      case Type::LIST:
+        return Status::OK();
+      default:
+        return TypeError("array");
+    }
+  }
+
+  // The builder for the values of the current array
+  ValueBuilder* value_builder() const { return values_.get(); }
+
+  Status EndList() {
+    RETURN_NOT_OK(validity_.Append(true));
+    RETURN_NOT_OK(offsets_.Append(static_cast<int32_t>(values_->length())));
+    ++length_;
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) {
+    if (type_->id() == Type::NA) {
+      *out = std::make_shared<NullArray>(length_);
+      return Status::OK();
+    }
+
+    const int64_t null_count = validity_.false_count();
+    std::shared_ptr<Buffer> null_bitmap;
+    if (null_count > 0) {
+      RETURN_NOT_OK(validity_.Finish(&null_bitmap));
+    }
+
+    switch (type_->id()) {
+      case Type::BOOL: {
+        std::shared_ptr<Buffer> values;
+        RETURN_NOT_OK(FinishBuffer(&bool_values_, &values));
+        *out = MakeArray(
+            ArrayData::Make(type_, length_, {null_bitmap, values}, null_count));
+        break;
+      }
+      case Type::STRING:
+      case Type::BINARY: {
+        std::shared_ptr<Buffer> offsets, data;
+        RETURN_NOT_OK(offsets_.Finish(&offsets));
+        RETURN_NOT_OK(FinishBuffer(&data_, &data));
+        *out = MakeArray(
+            ArrayData::Make(type_, length_, {null_bitmap, offsets, data}, null_count));
+        break;
+      }
+      case Type::LIST: {
+        std::shared_ptr<Buffer> offsets;
+        std::shared_ptr<Array> values;
+        RETURN_NOT_OK(offsets_.Finish(&offsets));
+        RETURN_NOT_OK(values_->Finish(&values));
+        const auto& value_field = checked_cast<const ListType&>(*type_).value_field();
+        auto list_type = list(field(value_field->name(), values->type()));
+        *out = std::make_shared<ListArray>(list_type, length_, offsets, values,
+                                           null_bitmap, null_count);
+        break;
+      }
+      case Type::STRUCT: {
+        std::vector<std::shared_ptr<Field>> fields;
+        std::vector<std::shared_ptr<Array>> children;
+        for (size_t i = 0; i < children_.size(); ++i) {
+          std::shared_ptr<Array> child;
+          RETURN_NOT_OK(children_[i]->Finish(&child));
+          fields.push_back(field(child_names_[i], child->type()));
+          children.push_back(std::move(child));
+        }
+        *out = std::make_shared<StructArray>(struct_(fields), length_, children,
+                                             null_bitmap, null_count);
+        break;
+      }
+      default: {
+        std::shared_ptr<Buffer> data;
+        RETURN_NOT_OK(FinishBuffer(&data_, &data));
+        *out =
+            MakeArray(ArrayData::Make(type_, length_, {null_bitmap, data}, null_count));
+        break;
+      }
+    }
+    return Status::OK();
+  }
+
+ protected:
+  ValueBuilder(MemoryPool* pool, const ParseOptions& options, std::string path,
+               std::shared_ptr<DataType> type, bool fixed)
+      : pool_(pool),
+        options_(options),
+        path_(std::move(path)),
+        type_(std::move(type)),
+        fixed_(fixed),
+        validity_(pool),
+        bool_values_(pool),
+        data_(pool),
+        offsets_(pool) {}
+
+  // Set up the storage and child builders for type_
+  Status Init() {
+    switch (type_->id()) {
+      case Type::NA:
+      case Type::BOOL:
+        break;
+      case Type::STRING:
+      case Type::BINARY:
+        RETURN_NOT_OK(offsets_.Append(0));
+        break;
+      case Type::TIMESTAMP:
+        timestamp_converter_.reset(new StringConverter<TimestampType>(type_));
+        byte_width_ = sizeof(int64_t);
+        break;
+      case Type::LIST: {
+        RETURN_NOT_OK(offsets_.Append(0));
+        const auto& value_type = checked_cast<const ListType&>(*type_).value_type();
+        RETURN_NOT_OK(Make(pool_, options_, path_ + "[]", value_type, fixed_, &values_));
+        break;
+      }
+      case Type::STRUCT:
+        for (const auto& child_field : type_->children()) {
+          std::unique_ptr<ValueBuilder> child;
+          RETURN_NOT_OK(Make(pool_, options_, ChildPath(child_field->name()),
+                             child_field->type(), fixed_, &child));
+          AddChild(child_field->name(), std::move(child));
+        }
+        break;
+      default:
+        byte_width_ = checked_cast<const FixedWidthType&>(*type_).bit_width() / 8;
+        break;
+    }
+    return Status::OK();
+  }
+
+  // Give a type to a field that only had nulls so far
+  Status InferType(const std::shared_ptr<DataType>& type, const char* kind) {
+    DCHECK_EQ(type_->id(), Type::NA);
+    if (fixed_) {
+      return TypeError(kind);
+    }
+    const int64_t num_nulls = length_;
+    type_ = type;
+    length_ = 0;
+    RETURN_NOT_OK(Init());
+    return AppendNulls(num_nulls);
+  }
+
+  // Convert the int64 values appended so far to float64, in place
+  void PromoteToDouble() {
+    auto values = reinterpret_cast<int64_t*>(data_.mutable_data());
+    for (int64_t i = 0; i < length_; ++i) {
+      const double value = static_cast<double>(values[i]);
+      std::memcpy(values + i, &value, sizeof(value));
+    }
+    type_ = float64();
+  }
+
+  // Finish a value buffer, which must not be null even if empty
+  template <typename Builder>
+  Status FinishBuffer(Builder* builder, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(builder->Finish(out));
+    if (*out == nullptr) {
+      RETURN_NOT_OK(AllocateBuffer(pool_, 0, out));
+    }
+    return Status::OK();
+  }
+
+  Status AppendNulls(int64_t count) {
+    for (int64_t i = 0; i < count; ++i) {
+      RETURN_NOT_OK(AppendNull());
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  Status AppendValue(T value) {
+    RETURN_NOT_OK(validity_.Append(true));
+    RETURN_NOT_OK(data_.Append(&value, sizeof(value)));
+    ++length_;
+    return Status::OK();
+  }
+
+  template <typename T>
+  Status AppendInteger(int64_t value) {
+    if (value < static_cast<int64_t>(std::numeric_limits<T>::min()) ||
+        (value > 0 && static_cast<uint64_t>(value) >
+                          static_cast<uint64_t>(std::numeric_limits<T>::max()))) {
+      return ConversionError(value);
+    }
+    return AppendValue(static_cast<T>(value));
+  }
+
+  template <typename T>
+  Status ConversionError(const T& value) const {
+    return Status::Invalid("JSON field '", path_, "': cannot convert ", value, " to ",
+                           type_->ToString());
+  }
+
+  Status TypeError(const char* kind) const {
+    if (fixed_) {
+      return Status::Invalid("JSON field '", path_, "': expected ", type_->ToString(),
+                             " value, got ", kind);
+    }
+    return Status::Invalid("JSON field '", path_, "': mixed ", KindName(), " and ",
+                           kind, " values");
+  }
+
+  // The JSON kind of the inferred type
+  const char* KindName() const {
+    switch (type_->id()) {
+      case Type::BOOL:
+        return "boolean";
+      case Type::STRING:
+        return "string";
+      case Type::LIST:
+        return "array";
+      case Type::STRUCT:
+        return "object";
+      default:
+        return "number";
+    }
+  }
+
+  std::string ChildPath(const std::string& name) const {
+    return path_.empty() ? name : path_ + "." + name;
+  }
+
+  int AddChild(std::string name, std::unique_ptr<ValueBuilder> child) {
+    const int index = static_cast<int>(children_.size());
+    child_indices_.emplace(name, index);
+    child_names_.push_back(std::move(name));
+    children_.push_back(std::move(child));
+    return index;
+  }
+
+  MemoryPool* pool_;
+  const ParseOptions& options_;
+  const std::string path_;
+  std::shared_ptr<DataType> type_;
+  const bool fixed_;
+  int64_t length_ = 0;
+
+  TypedBufferBuilder<bool> validity_;
+  // Boolean values
+  TypedBufferBuilder<bool> bool_values_;
+  // Fixed-width values, or string characters
+  BufferBuilder data_;
+  int byte_width_ = 0;
+  // String or list offsets
+  TypedBufferBuilder<int32_t> offsets_;
+  std::unique_ptr<StringConverter<TimestampType>> timestamp_converter_;
+  // List values
+  std::unique_ptr<ValueBuilder> values_;
+  // Struct fields
+  std::vector<std::unique_ptr<ValueBuilder>> children_;
+  std::vector<std::string> child_names_;
+  std::unordered_map<std::string, int> child_indices_;
+  int next_child_ = 0;
+};
+
+// Receives the SAX events of the RapidJSON reader, and forwards the values
+// to the builder of the field being parsed
+class Handler : public rj::BaseReaderHandler<rj::UTF8<>, Handler> {
+ public:
+  explicit Handler(ValueBuilder* root) : root_(root) {}
+
+  const Status& status() const { return status_; }
+
+  bool Null() {
+    if (skipping_) {
+      return EndSkippedValue();
+    }
+    return StartValue() && Check(target_->AppendNull()) && EndValue();
+  }
+
+  bool Bool(bool value) {
+    if (skipping_) {
+      return EndSkippedValue();
+    }
+    return StartValue() && Check(target_->AppendBool(value)) && EndValue();
+  }
+
+  bool Int(int value) { return Int64(value); }
+
+  bool Uint(unsigned value) { return Int64(value); }
+
+  bool Int64(int64_t value) {
+    if (skipping_) {
+      return EndSkippedValue();
+    }
+    return StartValue() && Check(target_->AppendInt64(value)) && EndValue();
+  }
+
+  bool Uint64(uint64_t value) {
+    if (skipping_) {
+      return EndSkippedValue();
+    }
+    if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+      return Int64(static_cast<int64_t>(value));
+    }
+    return StartValue() && Check(target_->AppendUInt64(value)) && EndValue();
+  }
+
+  bool Double(double value) {
+    if (skipping_) {
+      return EndSkippedValue();
+    }
+    return StartValue() && Check(target_->AppendDouble(value)) && EndValue();
+  }
+
+  bool String(const char* data, rj::SizeType size, bool) {
+    if (skipping_) {
+      return EndSkippedValue();
+    }
+    return StartValue() && Check(target_->AppendString(data, size)) && EndValue();
+  }
+
+  bool StartObject() {
+    if (skipping_) {
+      ++skip_depth_;
+      return true;
+    }
+    if (stack_.empty()) {
+      target_ = root_;
+    }
+    if (!Check(target_->StartStruct())) {
+      return false;
+    }
+    stack_.push_back(target_);
+    target_ = nullptr;
+    return true;
+  }
+
+  bool Key(const char* key, rj::SizeType size, bool) {
+    if (skipping_) {
+      return true;
+    }
+    if (!Check(stack_.back()->GetChild(key, size, &target_))) {
+      return false;
+    }
+    if (target_ == nullptr) {
+      skipping_ = true;
+      skip_depth_ = 0;
+    }
+    return true;
+  }
+
+  bool EndObject(rj::SizeType) {
+    if (skipping_) {
+      --skip_depth_;
+      return EndSkippedValue();
+    }
+    ValueBuilder* builder = stack_.back();
+    stack_.pop_back();
+    return Check(builder->EndStruct()) && EndValue();
+  }
+
+  bool StartArray() {
+    if (skipping_) {
+      ++skip_depth_;
+      return true;
+    }
+    if (!StartValue() || !Check(target_->StartList())) {
+      return false;
+    }
+    stack_.push_back(target_);
+    target_ = target_->value_builder();
+    return true;
+  }
+
+  bool EndArray(rj::SizeType) {
+    if (skipping_) {
+      --skip_depth_;
+      return EndSkippedValue();
+    }
+    ValueBuilder* builder = stack_.back();
+    stack_.pop_back();
+    return Check(builder->EndList()) && EndValue();
+  }
+
+ protected:
+  bool Check(Status st) {
+    if (ARROW_PREDICT_FALSE(!st.ok())) {
+      status_ = std::move(st);
+      return false;
+    }
+    return true;
+  }
+
+  // Check a value other than an object is nested in a row
+  bool StartValue() {
+    if (ARROW_PREDICT_FALSE(stack_.empty())) {
+      status_ = Status::Invalid("JSON rows must be objects");
+      return false;
+    }
+    return true;
+  }
+
+  // Point target_ to the builder for the next value of the enclosing
+  // container: the array values, or nothing until the next object key
+  bool EndValue() {
+    if (!stack_.empty()) {
+      ValueBuilder* parent = stack_.back();
+      target_ = parent->type_id() == Type::LIST ? parent->value_builder() : nullptr;
+    }
+    return true;
+  }
+
+  // Stop skipping once the skipped field's value is complete
+  bool EndSkippedValue() {
+    if (skip_depth_ == 0) {
+      skipping_ = false;
+      return EndValue();
+    }
+    return true;
+  }
+
+  ValueBuilder* root_;
+  ValueBuilder* target_ = nullptr;
+  std::vector<ValueBuilder*> stack_;
+  bool skipping_ = false;
+  int64_t skip_depth_ = 0;
+  Status status_;
+};
+
+}  // namespace
+
+class BlockParser::Impl {
+ public:
+  Impl(MemoryPool* pool, ParseOptions options)
+      : pool_(pool), options_(std::move(options)) {}
+
+  Status Parse(const char* data, uint32_t size) {
+    if (!root_) {
+      RETURN_NOT_OK(MakeRoot());
+    }
+    Handler handler(root_.get());
+    rj::MemoryStream memory_stream(data, size);
+    rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream> input(memory_stream);
+    rj::Reader reader;
+
+    // Parse one row at a time, until the end of the block
+    while (true) {
+      auto result = reader.Parse<kParseFlags>(input, handler);
+      switch (result.Code()) {
+        case rj::kParseErrorNone:
+          continue;
+        case rj::kParseErrorDocumentEmpty:
+          // Only whitespace remains
+          return Status::OK();
+        case rj::kParseErrorTermination:
+          // Error raised by the handler
+          return handler.status();
+        default:
+          return Status::Invalid("JSON parse error: ",
+                                 rj::GetParseError_En(result.Code()), " in row ",
+                                 root_->length());
+      }
+    }
+  }
+
+  int64_t num_rows() const { return root_ ? root_->length() : 0; }
+
+  Status Finish(std::shared_ptr<Array>* out) {
+    if (!root_) {
+      RETURN_NOT_OK(MakeRoot());
+    }
+    return root_->Finish(out);
+  }
+
+ protected:
+  static constexpr unsigned kParseFlags =
+      rj::kParseIterativeFlag | rj::kParseStopWhenDoneFlag |
+      rj::kParseValidateEncodingFlag | rj::kParseNanAndInfFlag;
+
+  Status MakeRoot() {
+    if (options_.explicit_schema) {
+      return ValueBuilder::Make(pool_, options_, "",
+                                struct_(options_.explicit_schema->fields()), true,
+                                &root_);
+    }
+    return ValueBuilder::Make(pool_, options_, "", struct_({}), false, &root_);
+  }
+
+  MemoryPool* pool_;
+  const ParseOptions options_;
+  std::unique_ptr<ValueBuilder> root_;
+};
+
+constexpr unsigned BlockParser::Impl::kParseFlags;
+
+BlockParser::BlockParser(MemoryPool* pool, ParseOptions options)
+    : impl_(new Impl(pool, std::move(options))) {}
+
+BlockParser::~BlockParser() {}
+
+Status BlockParser::Parse(const char* data, uint32_t size) {
+  return impl_->Parse(data, size);
+}
+
+int64_t BlockParser::num_rows() const { return impl_->num_rows(); }
+
+Status BlockParser::Finish(std::shared_ptr<Array>* out) { return impl_->Finish(out); }
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_JSON_PARSER_H
+#define ARROW_JSON_PARSER_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/json/options.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class MemoryPool;
+
+namespace json {
+
+/// \class BlockParser
+/// \brief A block-based parser for newline-delimited JSON data
+///
+/// The parser takes a block of JSON data and builds Arrow arrays from it
+/// in a single pass.  Each top-level value must be an object, and becomes a row.
+/// Fields of ParseOptions::explicit_schema are converted to their given type.
+/// The type of other fields is inferred from the values seen:
+/// - null values give the null type
+/// - booleans give the boolean type
+/// - numbers give int64, or float64 if any value in the field is not an
+///   integer or doesn't fit in an int64
+/// - strings give utf8
+/// - arrays give a list type, whose value type is inferred likewise
+/// - objects give a struct type, with fields in the order they were first seen
+///
+/// Other mixes of types in the same field are an error.
+class ARROW_EXPORT BlockParser {
+ public:
+  BlockParser(MemoryPool* pool, ParseOptions options);
+  ~BlockParser();
+
+  /// \brief Parse a block of data
+  ///
+  /// The block must hold whole objects, as carved up by the Chunker.
+  /// Rows are appended to those of previous calls.
+  Status Parse(const char* data, uint32_t size);
+
+  /// \brief Return the number of rows parsed so far
+  int64_t num_rows() const;
+
+  /// \brief Return the parsed rows as a StructArray with a child array
+  /// per JSON field
+  ///
+  /// The parser can't be used anymore after this.
+  Status Finish(std::shared_ptr<Array>* out);
+
+ protected:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(BlockParser);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace json
+}  // namespace arrow
+
+#endif  // ARROW_JSON_PARSER_H
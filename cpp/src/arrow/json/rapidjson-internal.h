@@ -0,0 +1,44 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Include this header before any RapidJSON header, to configure it and put it
+// in the arrow namespace (matching arrow/ipc/json-internal.h)
+
+#ifndef ARROW_JSON_RAPIDJSON_INTERNAL_H
+#define ARROW_JSON_RAPIDJSON_INTERNAL_H
+
+#include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/sse-util.h"
+
+#define RAPIDJSON_HAS_STDSTRING 1
+#define RAPIDJSON_HAS_CXX11_RVALUE_REFS 1
+#define RAPIDJSON_HAS_CXX11_RANGE_FOR 1
+
+#define RAPIDJSON_NAMESPACE arrow::rapidjson
+#define RAPIDJSON_NAMESPACE_BEGIN \
+  namespace arrow {               \
+  namespace rapidjson {
+#define RAPIDJSON_NAMESPACE_END \
+  }                             \
+  }
+
+// Let RapidJSON skip whitespace 16 bytes at a time
+#ifdef ARROW_HAVE_SSE4_2
+#define RAPIDJSON_SSE42 1
+#endif
+
+#endif  // ARROW_JSON_RAPIDJSON_INTERNAL_H
@@ -0,0 +1,223 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/options.h"
+#include "arrow/json/reader.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+namespace json {
+
+class TestReader : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() {
+    read_options_ = ReadOptions::Defaults();
+    read_options_.use_threads = GetParam();
+    parse_options_ = ParseOptions::Defaults();
+  }
+
+  Status Read(const std::string& data, std::shared_ptr<Table>* out) {
+    auto input =
+        std::make_shared<io::BufferReader>(Buffer::FromString(std::string(data)));
+    std::shared_ptr<TableReader> reader;
+    RETURN_NOT_OK(TableReader::Make(default_memory_pool(), input, read_options_,
+                                    parse_options_, &reader));
+    return reader->Read(out);
+  }
+
+  void AssertColumn(const Table& table, int i,
+                    const std::shared_ptr<Field>& expected_field,
+                    const std::string& expected_json) {
+    auto column = table.column(i);
+    ASSERT_TRUE(column->field()->Equals(*expected_field)) << column->field()->ToString();
+    for (const auto& chunk : column->data()->chunks()) {
+      ASSERT_OK(ValidateArray(*chunk));
+    }
+    ChunkedArray expected({ArrayFromJSON(expected_field->type(), expected_json)});
+    ASSERT_TRUE(column->data()->Equals(expected));
+  }
+
+ protected:
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+};
+
+TEST_P(TestReader, Basics) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Read("{\"a\": 1, \"b\": \"x\"}\n{\"b\": null, \"c\": [true]}\n{\"a\": 3}",
+                 &table));
+  ASSERT_EQ(table->num_rows(), 3);
+  ASSERT_EQ(table->num_columns(), 3);
+  AssertColumn(*table, 0, field("a", int64()), "[1, null, 3]");
+  AssertColumn(*table, 1, field("b", utf8()), "[\"x\", null, null]");
+  AssertColumn(*table, 2, field("c", list(boolean())), "[null, [true], null]");
+}
+
+TEST_P(TestReader, Empty) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Read("", &table));
+  ASSERT_EQ(table->num_rows(), 0);
+  ASSERT_EQ(table->num_columns(), 0);
+
+  parse_options_.explicit_schema = schema({field("a", int32())});
+  ASSERT_OK(Read("\n", &table));
+  ASSERT_EQ(table->num_rows(), 0);
+  ASSERT_TRUE(table->schema()->Equals(*parse_options_.explicit_schema));
+}
+
+TEST_P(TestReader, TypesAcrossBlocks) {
+  // Each block is parsed independently, then types are unified
+  std::stringstream ss;
+  std::vector<std::string> expected_x, expected_s;
+  for (int i = 0; i < 1000; ++i) {
+    ss << "{\"i\": " << i;
+    if (i == 500) {
+      ss << ", \"x\": 0.5";
+      expected_x.push_back("0.5");
+    } else if (i % 7 == 0) {
+      ss << ", \"x\": " << i;
+      expected_x.push_back(std::to_string(i));
+    } else {
+      expected_x.push_back("null");
+    }
+    if (i >= 900) {
+      ss << ", \"s\": {\"z\": \"" << i << "\"}";
+      expected_s.push_back("{\"z\": \"" + std::to_string(i) + "\"}");
+    } else {
+      ss << ", \"s\": null";
+      expected_s.push_back("null");
+    }
+    ss << "}\n";
+  }
+  read_options_.block_size = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Read(ss.str(), &table));
+  ASSERT_EQ(table->num_rows(), 1000);
+  ASSERT_GT(table->column(0)->data()->num_chunks(), 1);
+
+  auto join = [](const std::vector<std::string>& values) {
+    std::string out = "[";
+    for (const auto& value : values) {
+      out += (out.size() > 1 ? ", " : "") + value;
+    }
+    return out + "]";
+  };
+  std::vector<std::string> expected_i;
+  for (int i = 0; i < 1000; ++i) {
+    expected_i.push_back(std::to_string(i));
+  }
+  AssertColumn(*table, 0, field("i", int64()), join(expected_i));
+  AssertColumn(*table, 1, field("x", float64()), join(expected_x));
+  AssertColumn(*table, 2, field("s", struct_({field("z", utf8())})), join(expected_s));
+}
+
+TEST_P(TestReader, ExplicitSchema) {
+  parse_options_.explicit_schema =
+      schema({field("b", int8(), /*nullable=*/false), field("a", utf8())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Read("{\"a\": \"x\", \"b\": 1, \"c\": 2}\n{\"b\": 2}\n", &table));
+  ASSERT_TRUE(table->schema()->Equals(*parse_options_.explicit_schema));
+  AssertColumn(*table, 0, field("b", int8(), false), "[1, 2]");
+  AssertColumn(*table, 1, field("a", utf8()), "[\"x\", null]");
+}
+
+TEST_P(TestReader, NewlinesInValues) {
+  parse_options_.newlines_in_values = true;
+  read_options_.block_size = 16;
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Read("{\n  \"a\": [\n    1,\n    2\n  ]\n}\n{\"a\": [\n3]}  {}\n", &table));
+  AssertColumn(*table, 0, field("a", list(int64())), "[[1, 2], [3], null]");
+}
+
+TEST_P(TestReader, Errors) {
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(Invalid, Read("{\"a\": 1}\n{\"a\": }\n", &table));
+
+  // Incompatible types in different blocks
+  std::stringstream ss;
+  for (int i = 0; i < 200; ++i) {
+    ss << "{\"a\": 1}\n";
+  }
+  ss << "{\"a\": \"x\"}\n";
+  read_options_.block_size = 100;
+  ASSERT_RAISES(Invalid, Read(ss.str(), &table));
+}
+
+TEST_P(TestReader, CompressedInput) {
+  std::stringstream ss;
+  for (int i = 0; i < 1000; ++i) {
+    ss << "{\"i\": " << i << "}\n";
+  }
+  const std::string data = ss.str();
+  std::unique_ptr<util::Codec> codec;
+  ASSERT_OK(util::Codec::Create(Compression::GZIP, &codec));
+  auto input = reinterpret_cast<const uint8_t*>(data.data());
+  int64_t max_len = codec->MaxCompressedLen(data.size(), input);
+  std::string compressed(max_len, '\0');
+  int64_t compressed_len;
+  ASSERT_OK(codec->Compress(data.size(), input, max_len,
+                            reinterpret_cast<uint8_t*>(&compressed[0]), &compressed_len));
+  compressed.resize(compressed_len);
+  read_options_.block_size = 1000;
+  read_options_.compression = Compression::GZIP;
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Read(compressed, &table));
+  ASSERT_EQ(table->num_rows(), 1000);
+  ASSERT_GT(table->column(0)->data()->num_chunks(), 1);
+
+  // Not compressed
+  ASSERT_RAISES(IOError, Read(data, &table));
+}
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestReader, ::testing::Values(false, true));
+
+TEST(ParseOne, Basics) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("b", boolean())});
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(
+      ParseOne(options, Buffer::FromString("{\"a\": 1}\n{\"b\": false}\n"), &batch));
+  ASSERT_OK(batch->Validate());
+  ASSERT_TRUE(batch->schema()->Equals(
+      *schema({field("b", boolean()), field("a", int64())})));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[null, false]"), *batch->column(0));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, null]"), *batch->column(1));
+}
+
+}  // namespace json
+}  // namespace arrow
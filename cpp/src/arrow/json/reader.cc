@@ -0,0 +1,291 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/reader.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/readahead.h"
+#include "arrow/json/chunker.h"
+#include "arrow/json/converter.h"
+#include "arrow/json/options.h"
+#include "arrow/json/parser.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace json {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+using internal::ThreadPool;
+using io::internal::ReadaheadBuffer;
+using io::internal::ReadaheadSpooler;
+
+static constexpr int64_t kDefaultLeftPadding = 2048;  // 2 kB
+static constexpr int64_t kDefaultRightPadding = 16;
+
+// The struct type all parsed blocks are unified with
+static std::shared_ptr<DataType> InitialType(const ParseOptions& options) {
+  if (options.explicit_schema) {
+    return struct_(options.explicit_schema->fields());
+  }
+  return struct_({});
+}
+
+class TableReaderImpl : public TableReader {
+ public:
+  TableReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                  ThreadPool* thread_pool, const ReadOptions& read_options,
+                  const ParseOptions& parse_options)
+      : pool_(pool),
+        thread_pool_(thread_pool),
+        read_options_(read_options),
+        parse_options_(parse_options) {
+    // Readahead one block per worker thread
+    const int32_t block_queue_size = thread_pool ? thread_pool->GetCapacity() : 1;
+    readahead_ = std::make_shared<ReadaheadSpooler>(
+        pool_, input, read_options_.block_size, block_queue_size, kDefaultLeftPadding,
+        kDefaultRightPadding);
+  }
+
+  ~TableReaderImpl() {
+    if (task_group_) {
+      // In case of error, make sure all pending tasks are finished before
+      // we start destroying members
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  Status Read(std::shared_ptr<Table>* out) override {
+    task_group_ = thread_pool_ ? internal::TaskGroup::MakeThreaded(thread_pool_)
+                               : internal::TaskGroup::MakeSerial();
+    Chunker chunker(parse_options_);
+
+    RETURN_NOT_OK(ReadNextBlock());
+    while (!eof_ && task_group_->ok()) {
+      // Consume current chunk
+      uint32_t chunk_size = 0;
+      RETURN_NOT_OK(chunker.Process(reinterpret_cast<const char*>(cur_data_),
+                                    static_cast<uint32_t>(cur_size_), &chunk_size));
+      if (chunk_size > 0) {
+        // Got a chunk of rows
+        ParseChunk(chunk_size);
+      } else {
+        // Need to fetch more data to get at least one row
+        RETURN_NOT_OK(ReadNextBlock());
+      }
+    }
+    if (eof_ && cur_size_ > 0) {
+      // Parse remaining data, e.g. a last row without a trailing newline
+      ParseChunk(static_cast<uint32_t>(cur_size_));
+    }
+
+    // Finish all pending parallel tasks
+    RETURN_NOT_OK(task_group_->Finish());
+    return MakeTable(out);
+  }
+
+ protected:
+  // Read a next data block, stitch it to trailing data
+  Status ReadNextBlock() {
+    bool trailing_data = cur_size_ > 0;
+    ReadaheadBuffer rh;
+
+    if (trailing_data) {
+      if (readahead_->GetLeftPadding() < cur_size_) {
+        // Growth heuristic to try and ensure sufficient left padding
+        // in subsequent reads
+        readahead_->SetLeftPadding(cur_size_ * 3 / 2);
+      }
+    }
+
+    RETURN_NOT_OK(readahead_->Read(&rh));
+    if (!rh.buffer) {
+      // EOF, let caller finish with existing data
+      eof_ = true;
+      return Status::OK();
+    }
+
+    std::shared_ptr<Buffer> new_block = rh.buffer;
+    uint8_t* new_data = rh.buffer->mutable_data() + rh.left_padding;
+    int64_t new_size = rh.buffer->size() - rh.left_padding - rh.right_padding;
+    DCHECK_GT(new_size, 0);  // ensured by ReadaheadSpooler
+
+    if (trailing_data) {
+      // Try to copy trailing data at the beginning of new block
+      if (cur_size_ <= rh.left_padding) {
+        // Can left-extend new block inside padding area
+        new_data -= cur_size_;
+        new_size += cur_size_;
+        std::memcpy(new_data, cur_data_, cur_size_);
+      } else {
+        // Need to allocate bigger block and concatenate trailing + present data
+        RETURN_NOT_OK(
+            AllocateBuffer(pool_, cur_size_ + new_size + rh.right_padding, &new_block));
+        std::memcpy(new_block->mutable_data(), cur_data_, cur_size_);
+        std::memcpy(new_block->mutable_data() + cur_size_, new_data, new_size);
+        std::memset(new_block->mutable_data() + cur_size_ + new_size, 0,
+                    rh.right_padding);
+        new_data = new_block->mutable_data();
+        new_size = cur_size_ + new_size;
+      }
+    }
+    cur_block_ = new_block;
+    cur_data_ = new_data;
+    cur_size_ = new_size;
+    return Status::OK();
+  }
+
+  // Parse the next chunk_size bytes of the current block as a task
+  void ParseChunk(uint32_t chunk_size) {
+    const char* chunk_data = reinterpret_cast<const char*>(cur_data_);
+    std::shared_ptr<Buffer> chunk_buffer = cur_block_;
+    size_t chunk_index;
+    {
+      std::lock_guard<std::mutex> lock(chunks_mutex_);
+      chunk_index = chunks_.size();
+      chunks_.emplace_back();
+    }
+
+    // "mutable" allows to modify captured by-copy chunk_buffer
+    task_group_->Append([=]() mutable -> Status {
+      BlockParser parser(pool_, parse_options_);
+      RETURN_NOT_OK(parser.Parse(chunk_data, chunk_size));
+      std::shared_ptr<Array> parsed;
+      RETURN_NOT_OK(parser.Finish(&parsed));
+      {
+        std::lock_guard<std::mutex> lock(chunks_mutex_);
+        chunks_[chunk_index] = std::move(parsed);
+      }
+      // Keep chunk buffer alive within closure and release it at the end
+      chunk_buffer.reset();
+      return Status::OK();
+    });
+    cur_data_ += chunk_size;
+    cur_size_ -= chunk_size;
+  }
+
+  // Unify the types of the parsed chunks and make a column per field
+  Status MakeTable(std::shared_ptr<Table>* out) {
+    auto type = InitialType(parse_options_);
+    for (const auto& chunk : chunks_) {
+      RETURN_NOT_OK(UnifyTypes(type, chunk->type(), &type));
+    }
+
+    const int num_fields = type->num_children();
+    std::vector<ArrayVector> field_chunks(num_fields);
+    for (const auto& chunk : chunks_) {
+      std::shared_ptr<Array> promoted;
+      RETURN_NOT_OK(PromoteArray(pool_, chunk, type, &promoted));
+      const auto& struct_array = checked_cast<const StructArray&>(*promoted);
+      for (int i = 0; i < num_fields; ++i) {
+        field_chunks[i].push_back(struct_array.field(i));
+      }
+    }
+
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Column>> columns;
+    for (int i = 0; i < num_fields; ++i) {
+      auto column_field = type->child(i);
+      if (parse_options_.explicit_schema) {
+        // Keep the nullability and metadata of explicit fields
+        auto explicit_field =
+            parse_options_.explicit_schema->GetFieldByName(column_field->name());
+        if (explicit_field && explicit_field->type()->Equals(*column_field->type())) {
+          column_field = explicit_field;
+        }
+      }
+      auto chunked =
+          std::make_shared<ChunkedArray>(field_chunks[i], column_field->type());
+      fields.push_back(column_field);
+      columns.push_back(std::make_shared<Column>(column_field, chunked));
+    }
+    *out = Table::Make(schema(fields), columns);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ThreadPool* thread_pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+
+  std::shared_ptr<ReadaheadSpooler> readahead_;
+  std::shared_ptr<internal::TaskGroup> task_group_;
+
+  std::shared_ptr<Buffer> cur_block_;
+  const uint8_t* cur_data_ = nullptr;
+  int64_t cur_size_ = 0;
+  bool eof_ = false;
+
+  std::mutex chunks_mutex_;
+  // The parsed chunks, as struct arrays
+  ArrayVector chunks_;
+};
+
+Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                         const ReadOptions& read_options,
+                         const ParseOptions& parse_options,
+                         std::shared_ptr<TableReader>* out) {
+  // Decompress a compressed input as it is read ahead of the chunker
+  RETURN_NOT_OK(io::MakeDecompressedInputStream(pool, read_options.compression,
+                                                read_options.use_threads, input,
+                                                &input));
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  *out = std::make_shared<TableReaderImpl>(pool, input, thread_pool, read_options,
+                                           parse_options);
+  return Status::OK();
+}
+
+Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
+                std::shared_ptr<RecordBatch>* out) {
+  BlockParser parser(default_memory_pool(), options);
+  RETURN_NOT_OK(parser.Parse(reinterpret_cast<const char*>(json->data()),
+                             static_cast<uint32_t>(json->size())));
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser.Finish(&parsed));
+
+  std::shared_ptr<DataType> type;
+  std::shared_ptr<Array> promoted;
+  RETURN_NOT_OK(UnifyTypes(InitialType(options), parsed->type(), &type));
+  RETURN_NOT_OK(PromoteArray(default_memory_pool(), parsed, type, &promoted));
+  const auto& struct_array = checked_cast<const StructArray&>(*promoted);
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < struct_array.num_fields(); ++i) {
+    columns.push_back(struct_array.field(i));
+  }
+  *out = RecordBatch::Make(schema(struct_array.type()->children()),
+                           struct_array.length(), columns);
+  return Status::OK();
+}
+
+}  // namespace json
+}  // namespace arrow
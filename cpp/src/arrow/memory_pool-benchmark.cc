@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/memory_pool.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+
+// Number of allocations alive at once in each thread
+constexpr int kLiveAllocations = 64;
+
+// Allocation sizes typical of builders' and decoders' small buffers
+static int64_t AllocationSize(int64_t i) { return 8 + (i * 2654435761LL) % 4096; }
+
+// Allocate, grow and free small buffers, like a builder appending values
+static void AllocateReallocateFree(MemoryPool* pool, benchmark::State& state) {
+  std::vector<std::pair<uint8_t*, int64_t>> allocations(kLiveAllocations,
+                                                        {nullptr, 0});
+  int64_t i = 0;
+  while (state.KeepRunning()) {
+    for (auto& allocation : allocations) {
+      const int64_t size = AllocationSize(i++);
+      ABORT_NOT_OK(pool->Allocate(size, &allocation.first));
+      ABORT_NOT_OK(pool->Reallocate(size, size * 2, &allocation.first));
+      allocation.second = size * 2;
+    }
+    for (auto& allocation : allocations) {
+      pool->Free(allocation.first, allocation.second);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kLiveAllocations);
+}
+
+static void BM_DefaultPool(benchmark::State& state) {  // NOLINT non-const reference
+  AllocateReallocateFree(default_memory_pool(), state);
+}
+
+static ThreadCachingMemoryPool* thread_caching_pool() {
+  static ThreadCachingMemoryPool pool;
+  return &pool;
+}
+
+static void BM_ThreadCachingPool(
+    benchmark::State& state) {  // NOLINT non-const reference
+  AllocateReallocateFree(thread_caching_pool(), state);
+}
+
+// Per-batch scratch memory: allocate many buffers, then release them at once
+static void BM_ArenaPool(benchmark::State& state) {  // NOLINT non-const reference
+  ArenaMemoryPool pool;
+  int64_t i = 0;
+  while (state.KeepRunning()) {
+    for (int j = 0; j < kLiveAllocations; ++j) {
+      uint8_t* data;
+      const int64_t size = AllocationSize(i++);
+      ABORT_NOT_OK(pool.Allocate(size, &data));
+      ABORT_NOT_OK(pool.Reallocate(size, size * 2, &data));
+    }
+    pool.Reset();
+  }
+  state.SetItemsProcessed(state.iterations() * kLiveAllocations);
+}
+
+// Size of the scanned column, much larger than what the TLB covers with 4 KB pages
+constexpr int64_t kScanLength = 32 << 20;
+
+// Scan a large int64 column sequentially, then gather from it at random
+// positions, like a hash join probing a build side. The gather is dominated by
+// TLB misses, which huge pages reduce.
+static void ScanLargeBuffer(MemoryPool* pool, benchmark::State& state) {
+  const int64_t nbytes = kScanLength * sizeof(int64_t);
+  uint8_t* data;
+  ABORT_NOT_OK(pool->Allocate(nbytes, &data));
+  auto values = reinterpret_cast<int64_t*>(data);
+  for (int64_t i = 0; i < kScanLength; ++i) {
+    values[i] = i;
+  }
+  const bool gather = state.range(0) != 0;
+
+  int64_t total = 0;
+  while (state.KeepRunning()) {
+    if (gather) {
+      uint64_t position = 0;
+      for (int64_t i = 0; i < kScanLength / 16; ++i) {
+        position = (position * 6364136223846793005ULL + 1442695040888963407ULL);
+        total += values[(position >> 16) % kScanLength];
+      }
+    } else {
+      for (int64_t i = 0; i < kScanLength; ++i) {
+        total += values[i];
+      }
+    }
+  }
+  benchmark::DoNotOptimize(total);
+  pool->Free(data, nbytes);
+  state.SetBytesProcessed(state.iterations() * (gather ? nbytes / 16 : nbytes));
+}
+
+static void BM_ScanDefaultPool(benchmark::State& state) {  // NOLINT non-const reference
+  ScanLargeBuffer(default_memory_pool(), state);
+}
+
+static void BM_ScanLargeBufferPool(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto options = LargeBufferOptions::Defaults();
+  options.numa_policy = NumaPolicy::INTERLEAVE;
+  std::unique_ptr<LargeBufferMemoryPool> pool;
+  ABORT_NOT_OK(LargeBufferMemoryPool::Make(default_memory_pool(), options, &pool));
+  ScanLargeBuffer(pool.get(), state);
+}
+
+BENCHMARK(BM_DefaultPool)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ThreadCachingPool)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ArenaPool);
+// Argument: 0 for a sequential scan, 1 for a random gather
+BENCHMARK(BM_ScanDefaultPool)->Arg(0)->Arg(1);
+BENCHMARK(BM_ScanLargeBufferPool)->Arg(0)->Arg(1);
+
+}  // namespace arrow
@@ -15,10 +15,20 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/builder.h"
 #include "arrow/memory_pool-test.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
@@ -99,4 +109,581 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pool->bytes_allocated());
   ASSERT_EQ(0, pp.bytes_allocated());
 }
+
+class TestTaggingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  TestTaggingMemoryPool() : pool_(default_memory_pool()) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  TaggingMemoryPool pool_;
+};
+
+TEST_F(TestTaggingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestTaggingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestTaggingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(TaggingMemoryPool, Tags) {
+  TaggingMemoryPool pool(default_memory_pool());
+  uint8_t* untagged;
+  uint8_t* data1;
+  uint8_t* data2;
+  uint8_t* data3;
+  ASSERT_EQ("", ScopedMemoryTag::current());
+  ASSERT_OK(pool.Allocate(10, &untagged));
+  {
+    ScopedMemoryTag outer("ipc");
+    ASSERT_OK(pool.Allocate(100, &data1));
+    {
+      ScopedMemoryTag inner("dictionary");
+      ASSERT_EQ("dictionary", ScopedMemoryTag::current());
+      ASSERT_OK(pool.Allocate(200, &data2));
+      ASSERT_OK(pool.Allocate(0, &data3));
+      // Stays attributed to the allocating tag
+      ASSERT_OK(pool.Reallocate(100, 300, &data1));
+    }
+    ASSERT_EQ("ipc", ScopedMemoryTag::current());
+    pool.Free(data2, 200);
+  }
+  ASSERT_EQ("", ScopedMemoryTag::current());
+  pool.Free(data3, 0);
+
+  auto stats = pool.GetTagStats();
+  ASSERT_EQ(3, stats.size());
+  ASSERT_EQ("", stats[0].tag);
+  ASSERT_EQ(10, stats[0].bytes_allocated);
+  ASSERT_EQ(1, stats[0].num_allocations);
+  ASSERT_EQ("dictionary", stats[1].tag);
+  ASSERT_EQ(0, stats[1].bytes_allocated);
+  ASSERT_EQ(200, stats[1].max_memory);
+  ASSERT_EQ(2, stats[1].num_allocations);
+  ASSERT_EQ("ipc", stats[2].tag);
+  ASSERT_EQ(300, stats[2].bytes_allocated);
+  ASSERT_EQ(300, stats[2].max_memory);
+  ASSERT_EQ(1, stats[2].num_allocations);
+  ASSERT_EQ(310, pool.bytes_allocated());
+
+  std::stringstream ss;
+  pool.PrintReport(&ss);
+  ASSERT_NE(std::string::npos, ss.str().find("(untagged)"));
+  ASSERT_NE(std::string::npos, ss.str().find("dictionary"));
+
+  // Tags are local to each thread
+  std::thread thread([&]() { ASSERT_OK(pool.Allocate(20, &data2)); });
+  thread.join();
+  ASSERT_EQ(30, pool.GetTagStats()[0].bytes_allocated);
+
+  pool.Free(untagged, 10);
+  pool.Free(data1, 300);
+  pool.Free(data2, 20);
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(TaggingMemoryPool, NegativeSize) {
+  TaggingMemoryPool pool(default_memory_pool());
+  uint8_t* data;
+  ASSERT_RAISES(Invalid, pool.Allocate(-1, &data));
+  ASSERT_OK(pool.Allocate(100, &data));
+  ASSERT_RAISES(Invalid, pool.Reallocate(100, -1, &data));
+  ASSERT_EQ(100, pool.bytes_allocated());
+  pool.Free(data, 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  auto stats = pool.GetTagStats();
+  ASSERT_EQ(1, stats.size());
+  ASSERT_EQ(1, stats[0].num_allocations);
+  ASSERT_EQ(100, stats[0].max_memory);
+}
+
+TEST(TaggingMemoryPool, InternedTags) {
+  MemoryTag tag("interned");
+  ASSERT_EQ(tag.id(), MemoryTag("interned").id());
+  ASSERT_NE(tag.id(), MemoryTag("other interned").id());
+  ASSERT_EQ("interned", tag.name());
+
+  TaggingMemoryPool pool(default_memory_pool());
+  uint8_t* data;
+  {
+    ScopedMemoryTag scope(tag);
+    ASSERT_EQ("interned", ScopedMemoryTag::current());
+    ASSERT_OK(pool.Allocate(64, &data));
+  }
+  // Allocations stay aligned behind the tag header
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+
+  auto stats = pool.GetTagStats();
+  ASSERT_EQ(1, stats.size());
+  ASSERT_EQ("interned", stats[0].tag);
+  ASSERT_EQ(64, stats[0].bytes_allocated);
+  pool.Free(data, 64);
+  ASSERT_EQ(0, pool.GetTagStats()[0].bytes_allocated);
+}
+
+TEST(TaggingMemoryPool, ConcurrentTags) {
+  TaggingMemoryPool pool(default_memory_pool());
+  constexpr int kNumThreads = 4;
+  constexpr int kNumAllocations = 1000;
+  std::vector<std::vector<uint8_t*>> allocations(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&pool, &allocations, i]() {
+      ScopedMemoryTag tag("thread" + std::to_string(i));
+      std::vector<uint8_t*>& data = allocations[i];
+      data.resize(kNumAllocations);
+      for (auto& ptr : data) {
+        ASSERT_OK(pool.Allocate(i + 1, &ptr));
+      }
+      for (auto& ptr : data) {
+        ASSERT_OK(pool.Reallocate(i + 1, 2 * (i + 1), &ptr));
+      }
+      for (int j = 0; j < kNumAllocations / 2; ++j) {
+        pool.Free(data[j], 2 * (i + 1));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto stats = pool.GetTagStats();
+  ASSERT_EQ(kNumThreads, stats.size());
+  int64_t total = 0;
+  for (int i = 0; i < kNumThreads; ++i) {
+    ASSERT_EQ("thread" + std::to_string(i), stats[i].tag);
+    ASSERT_EQ(kNumAllocations, stats[i].num_allocations);
+    ASSERT_EQ(kNumAllocations / 2 * 2 * (i + 1), stats[i].bytes_allocated);
+    total += stats[i].bytes_allocated;
+  }
+  ASSERT_EQ(total, pool.bytes_allocated());
+
+  for (int i = 0; i < kNumThreads; ++i) {
+    for (int j = kNumAllocations / 2; j < kNumAllocations; ++j) {
+      pool.Free(allocations[i][j], 2 * (i + 1));
+    }
+  }
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(TaggingMemoryPool, BuilderTags) {
+  TaggingMemoryPool pool(default_memory_pool());
+  std::shared_ptr<Array> ints;
+  std::shared_ptr<Array> strings;
+  {
+    ScopedMemoryTag outer("component");
+    Int32Builder int_builder(&pool);
+    ASSERT_OK(int_builder.AppendValues({1, 2, 3}));
+    ASSERT_OK(int_builder.Finish(&ints));
+
+    StringDictionaryBuilder dict_builder(&pool);
+    ASSERT_OK(dict_builder.Append("a"));
+    ASSERT_OK(dict_builder.Append("b"));
+    ASSERT_OK(dict_builder.Finish(&strings));
+  }
+
+  std::vector<std::string> tags;
+  for (const auto& stats : pool.GetTagStats()) {
+    ASSERT_GT(stats.bytes_allocated, 0);
+    tags.push_back(stats.tag);
+  }
+  ASSERT_EQ(std::vector<std::string>({"builder", "dictionary"}), tags);
+
+  ints.reset();
+  strings.reset();
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+class TestLimitedMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  TestLimitedMemoryPool() : pool_(default_memory_pool(), -1) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  LimitedMemoryPool pool_;
+};
+
+TEST_F(TestLimitedMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestLimitedMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+  ASSERT_EQ(0, pool_.budget()->bytes_reserved());
+}
+
+TEST_F(TestLimitedMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(LimitedMemoryPool, HardLimit) {
+  LimitedMemoryPool pool(default_memory_pool(), 1000);
+  const int64_t allocated_before = default_memory_pool()->bytes_allocated();
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(600, &data1));
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(500, &data2));
+  ASSERT_EQ(600, pool.budget()->bytes_reserved());
+  ASSERT_EQ(allocated_before + 600, default_memory_pool()->bytes_allocated());
+
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(600, 1200, &data1));
+  ASSERT_OK(pool.Reallocate(600, 200, &data1));
+  ASSERT_EQ(200, pool.budget()->bytes_reserved());
+  ASSERT_OK(pool.Allocate(500, &data2));
+  ASSERT_EQ(700, pool.bytes_allocated());
+  ASSERT_EQ(1000, pool.budget()->limit());
+
+  pool.Free(data1, 200);
+  pool.Free(data2, 500);
+  ASSERT_EQ(0, pool.budget()->bytes_reserved());
+  ASSERT_EQ(700, pool.budget()->max_reserved());
+}
+
+TEST(MemoryBudget, Hierarchy) {
+  std::shared_ptr<MemoryBudget> process, query1, query2, op;
+  ASSERT_OK(MemoryBudget::Make(1000, &process));
+  ASSERT_OK(process->MakeChild(700, &query1));
+  ASSERT_OK(process->MakeChild(-1, &query2));
+  ASSERT_OK(query1->MakeChild(100, &op));
+  ASSERT_EQ(query1.get(), op->parent());
+  ASSERT_EQ(nullptr, process->parent());
+
+  ASSERT_OK(op->Reserve(100));
+  ASSERT_RAISES(OutOfMemory, op->Reserve(1));
+  ASSERT_OK(query1->Reserve(600));
+  ASSERT_RAISES(OutOfMemory, query1->Reserve(1));
+  ASSERT_EQ(700, process->bytes_reserved());
+
+  // Limited by the parent
+  ASSERT_RAISES(OutOfMemory, query2->Reserve(301));
+  ASSERT_EQ(0, query2->bytes_reserved());
+  ASSERT_EQ(700, process->bytes_reserved());
+  ASSERT_OK(query2->Reserve(300));
+  ASSERT_RAISES(OutOfMemory, process->Reserve(1));
+
+  op->Release(100);
+  ASSERT_EQ(600, query1->bytes_reserved());
+  ASSERT_OK(query2->Reserve(100));
+  query1->Release(600);
+  query2->Release(400);
+  ASSERT_EQ(0, process->bytes_reserved());
+}
+
+TEST(MemoryBudget, SoftLimit) {
+  std::shared_ptr<MemoryBudget> root, child;
+  ASSERT_OK(MemoryBudget::Make(1000, &root));
+  ASSERT_OK(root->MakeChild(-1, &child));
+
+  // A cache holding memory in the child budget, shed on request
+  int64_t cached = 0;
+  std::vector<int64_t> excesses;
+  root->SetSoftLimit(500, [&](MemoryBudget* budget, int64_t excess) {
+    ASSERT_EQ(root.get(), budget);
+    excesses.push_back(excess);
+    const int64_t shed = std::min(cached, excess);
+    child->Release(shed);
+    cached -= shed;
+  });
+
+  ASSERT_OK(child->Reserve(400));
+  cached = 400;
+  ASSERT_TRUE(excesses.empty());
+  // Above the soft limit: the cache sheds memory
+  ASSERT_OK(child->Reserve(300));
+  ASSERT_EQ(excesses, std::vector<int64_t>({200}));
+  ASSERT_EQ(200, cached);
+  ASSERT_EQ(500, root->bytes_reserved());
+
+  // Over the hard limit: the callback runs before retrying
+  ASSERT_OK(root->Reserve(600));
+  ASSERT_EQ(0, cached);
+  ASSERT_EQ(900, root->bytes_reserved());
+  ASSERT_RAISES(OutOfMemory, root->Reserve(200));
+
+  root->SetSoftLimit(-1, nullptr);
+  root->Release(600);
+  child->Release(300);
+  ASSERT_EQ(0, root->bytes_reserved());
+}
+
+TEST(MemoryBudget, Threads) {
+  std::shared_ptr<MemoryBudget> root;
+  ASSERT_OK(MemoryBudget::Make(64 * 1000, &root));
+  LimitedMemoryPool pool(default_memory_pool(), root);
+
+  const int kNumThreads = 8;
+  std::vector<std::thread> threads;
+  std::atomic<int> failures(0);
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < 1000; ++j) {
+        uint8_t* data;
+        if (pool.Allocate(64 * 100, &data).ok()) {
+          pool.Free(data, 64 * 100);
+        } else {
+          ++failures;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, failures.load());
+  ASSERT_EQ(0, root->bytes_reserved());
+  ASSERT_LE(root->max_reserved(), 64 * 100 * kNumThreads);
+}
+
+class TestLargeBufferMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  void SetUp() override {
+    ASSERT_OK(LargeBufferMemoryPool::Make(default_memory_pool(),
+                                          LargeBufferOptions::Defaults(), &pool_));
+  }
+
+  ::arrow::MemoryPool* memory_pool() override { return pool_.get(); }
+
+ protected:
+  std::unique_ptr<LargeBufferMemoryPool> pool_;
+};
+
+TEST_F(TestLargeBufferMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestLargeBufferMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestLargeBufferMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(LargeBufferMemoryPool, LargeAllocations) {
+  ProxyMemoryPool backing(default_memory_pool());
+  auto options = LargeBufferOptions::Defaults();
+  options.threshold = 1 << 20;
+  std::unique_ptr<LargeBufferMemoryPool> pool;
+  ASSERT_OK(LargeBufferMemoryPool::Make(&backing, options, &pool));
+
+  uint8_t* data;
+  const int64_t size = 3 << 20;
+  ASSERT_OK(pool->Allocate(size, &data));
+#ifdef __linux__
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % (2 << 20));
+  ASSERT_EQ(0, backing.bytes_allocated());
+#endif
+  ASSERT_EQ(size, pool->bytes_allocated());
+  data[0] = 1;
+  data[size - 1] = 2;
+
+  // Large to large
+  ASSERT_OK(pool->Reallocate(size, 2 * size, &data));
+  ASSERT_EQ(1, data[0]);
+  ASSERT_EQ(2, data[size - 1]);
+  ASSERT_EQ(2 * size, pool->bytes_allocated());
+
+  // Large to small
+  ASSERT_OK(pool->Reallocate(2 * size, 100, &data));
+  ASSERT_EQ(1, data[0]);
+  ASSERT_EQ(100, backing.bytes_allocated());
+  ASSERT_EQ(100, pool->bytes_allocated());
+
+  // Small to large
+  ASSERT_OK(pool->Reallocate(100, size, &data));
+  ASSERT_EQ(1, data[0]);
+#ifdef __linux__
+  ASSERT_EQ(0, backing.bytes_allocated());
+#endif
+
+  pool->Free(data, size);
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(0, backing.bytes_allocated());
+  ASSERT_EQ(2 * size, pool->max_memory());
+}
+
+TEST(LargeBufferMemoryPool, NumaPolicies) {
+  const int num_nodes = LargeBufferMemoryPool::GetNumaNodeCount();
+  ASSERT_GE(num_nodes, 1);
+
+  auto options = LargeBufferOptions::Defaults();
+  options.threshold = 1 << 20;
+  std::unique_ptr<LargeBufferMemoryPool> pool;
+  options.numa_policy = NumaPolicy::BIND;
+  options.numa_node = num_nodes;
+  ASSERT_RAISES(Invalid, LargeBufferMemoryPool::Make(default_memory_pool(), options,
+                                                     &pool));
+
+  for (auto policy : {NumaPolicy::BIND, NumaPolicy::PREFERRED, NumaPolicy::INTERLEAVE}) {
+    options.numa_policy = policy;
+    options.numa_node = num_nodes - 1;
+    ASSERT_OK(LargeBufferMemoryPool::Make(default_memory_pool(), options, &pool));
+    uint8_t* data;
+    ASSERT_OK(pool->Allocate(4 << 20, &data));
+    std::memset(data, 1, 4 << 20);
+    pool->Free(data, 4 << 20);
+  }
+}
+
+class TestThreadCachingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ThreadCachingMemoryPool pool_;
+};
+
+TEST_F(TestThreadCachingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestThreadCachingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestThreadCachingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(ThreadCachingMemoryPool, ReuseBlocks) {
+  ProxyMemoryPool backing(default_memory_pool());
+  {
+    ThreadCachingMemoryPool pool(&backing);
+    uint8_t* data1;
+    uint8_t* data2;
+    ASSERT_OK(pool.Allocate(100, &data1));
+    ASSERT_EQ(128, backing.bytes_allocated());
+    pool.Free(data1, 100);
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(128, pool.bytes_cached());
+
+    // Same size class
+    ASSERT_OK(pool.Allocate(120, &data2));
+    ASSERT_EQ(data1, data2);
+    ASSERT_EQ(0, pool.bytes_cached());
+
+    // Reallocation within the size class happens in place
+    ASSERT_OK(pool.Reallocate(120, 65, &data2));
+    ASSERT_EQ(data1, data2);
+    ASSERT_EQ(65, pool.bytes_allocated());
+    ASSERT_OK(pool.Reallocate(65, 1000, &data2));
+    ASSERT_EQ(1000, pool.bytes_allocated());
+    ASSERT_EQ(128, pool.bytes_cached());
+
+    // Large allocations bypass the caches
+    uint8_t* large;
+    ASSERT_OK(pool.Allocate(ThreadCachingMemoryPool::kMaxCachedSize + 1, &large));
+    pool.Free(large, ThreadCachingMemoryPool::kMaxCachedSize + 1);
+    ASSERT_EQ(128, pool.bytes_cached());
+
+    pool.Free(data2, 1000);
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(128 + 1024, pool.bytes_cached());
+  }
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
+TEST(ThreadCachingMemoryPool, Threads) {
+  ProxyMemoryPool backing(default_memory_pool());
+  {
+    ThreadCachingMemoryPool pool(&backing);
+    const int kNumThreads = 8;
+    const int kNumAllocations = 2000;
+
+    // Blocks allocated by one thread are freed by another
+    std::vector<std::vector<std::pair<uint8_t*, int64_t>>> allocations(kNumThreads);
+    auto allocate = [&](int i) {
+      for (int j = 0; j < kNumAllocations; ++j) {
+        const int64_t size = 1 + (i * 7919 + j * 104729) % 40000;
+        uint8_t* data;
+        ABORT_NOT_OK(pool.Allocate(size, &data));
+        std::memset(data, i, static_cast<size_t>(size));
+        allocations[i].emplace_back(data, size);
+      }
+    };
+    auto free = [&](int i) {
+      for (const auto& allocation : allocations[(i + 1) % kNumThreads]) {
+        ASSERT_EQ(allocation.first[allocation.second - 1], (i + 1) % kNumThreads);
+        pool.Free(allocation.first, allocation.second);
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back(allocate, i);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    threads.clear();
+    for (int i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back(free, i);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(backing.bytes_allocated(), pool.bytes_cached());
+  }
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
+class TestArenaMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ArenaMemoryPool pool_;
+};
+
+TEST_F(TestArenaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestArenaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestArenaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(ArenaMemoryPool, BumpAllocation) {
+  ProxyMemoryPool backing(default_memory_pool());
+  {
+    ArenaMemoryPool pool(&backing, 1024);
+    uint8_t* data1;
+    uint8_t* data2;
+    uint8_t* data3;
+    ASSERT_OK(pool.Allocate(100, &data1));
+    ASSERT_OK(pool.Allocate(10, &data2));
+    ASSERT_EQ(data1 + 128, data2);
+    ASSERT_EQ(1024, pool.bytes_reserved());
+
+    // The last allocation grows in place
+    ASSERT_OK(pool.Reallocate(10, 500, &data2));
+    ASSERT_EQ(data1 + 128, data2);
+    // Others are copied
+    data1[0] = 42;
+    ASSERT_OK(pool.Reallocate(100, 200, &data1));
+    ASSERT_EQ(data2 + 512, data1);
+    ASSERT_EQ(42, data1[0]);
+    ASSERT_EQ(700, pool.bytes_allocated());
+
+    // No more room in the first chunk
+    ASSERT_OK(pool.Allocate(300, &data3));
+    ASSERT_EQ(2048, pool.bytes_reserved());
+    // Larger than a chunk
+    ASSERT_OK(pool.Allocate(5000, &data3));
+    ASSERT_EQ(2048 + 5056, pool.bytes_reserved());
+    ASSERT_EQ(backing.bytes_allocated(), pool.bytes_reserved());
+
+    pool.Reset();
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(1024, pool.bytes_reserved());
+    ASSERT_OK(pool.Allocate(100, &data3));
+    ASSERT_EQ(data1 - 640, data3);
+    pool.Free(data3, 100);
+  }
+  ASSERT_EQ(0, backing.bytes_allocated());
+}
+
 }  // namespace arrow
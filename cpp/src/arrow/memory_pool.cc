@@ -18,14 +18,29 @@
 #include "arrow/memory_pool.h"
 
 #include <algorithm>  // IWYU pragma: keep
+#include <cerrno>
 #include <cstdlib>    // IWYU pragma: keep
 #include <cstring>    // IWYU pragma: keep
+#include <deque>
+#include <fstream>
+#include <iomanip>
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
 #include <memory>
 #include <sstream>  // IWYU pragma: keep
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
 
 #ifdef ARROW_JEMALLOC
@@ -286,4 +301,1059 @@ int64_t ProxyMemoryPool::bytes_allocated() const { return impl_->bytes_allocated
 
 int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
+///////////////////////////////////////////////////////////////////////
+// TaggingMemoryPool implementation
+
+namespace {
+
+// Tag names are interned process-wide to ids below kMaxMemoryTags. Id 0 is the
+// empty tag, and the last id collects the tags beyond the capacity.
+constexpr int32_t kMaxMemoryTags = 256;
+constexpr int32_t kOtherMemoryTag = kMaxMemoryTags - 1;
+
+class MemoryTagRegistry {
+ public:
+  MemoryTagRegistry() {
+    names_.emplace_back();
+    ids_.emplace("", 0);
+  }
+
+  static MemoryTagRegistry* instance() {
+    // Leaked, as tags may be entered from threads outliving static destruction
+    static auto registry = new MemoryTagRegistry();
+    return registry;
+  }
+
+  int32_t Intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+      return it->second;
+    }
+    if (static_cast<int32_t>(names_.size()) >= kOtherMemoryTag) {
+      if (static_cast<int32_t>(names_.size()) == kOtherMemoryTag) {
+        names_.emplace_back("(other)");
+      }
+      return kOtherMemoryTag;
+    }
+    const auto id = static_cast<int32_t>(names_.size());
+    names_.push_back(name);
+    ids_.emplace(name, id);
+    return id;
+  }
+
+  // A deque, so that references to the names stay valid as tags are added
+  const std::string& name(int32_t id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return names_[id];
+  }
+
+  int32_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int32_t>(names_.size());
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, int32_t> ids_;
+  std::deque<std::string> names_;
+};
+
+thread_local int32_t current_memory_tag = 0;
+
+}  // namespace
+
+MemoryTag::MemoryTag(const std::string& name)
+    : id_(MemoryTagRegistry::instance()->Intern(name)) {}
+
+const std::string& MemoryTag::name() const {
+  return MemoryTagRegistry::instance()->name(id_);
+}
+
+ScopedMemoryTag::ScopedMemoryTag(const std::string& tag)
+    : previous_(current_memory_tag) {
+  current_memory_tag = MemoryTagRegistry::instance()->Intern(tag);
+}
+
+ScopedMemoryTag::ScopedMemoryTag(const MemoryTag& tag) : previous_(current_memory_tag) {
+  current_memory_tag = tag.id();
+}
+
+ScopedMemoryTag::~ScopedMemoryTag() { current_memory_tag = previous_; }
+
+const std::string& ScopedMemoryTag::current() {
+  return MemoryTagRegistry::instance()->name(current_memory_tag);
+}
+
+class TaggingMemoryPool::TaggingMemoryPoolImpl {
+ public:
+  // Keeps the returned pointers 64-byte aligned
+  static constexpr int64_t kHeaderSize = 64;
+
+  explicit TaggingMemoryPoolImpl(MemoryPool* pool)
+      : pool_(pool), counters_(new TagCounters[kMaxMemoryTags]) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size > std::numeric_limits<int64_t>::max() - kHeaderSize) {
+      return Status::OutOfMemory("malloc size overflows with the tag header");
+    }
+    uint8_t* base;
+    RETURN_NOT_OK(pool_->Allocate(size + kHeaderSize, &base));
+    const int32_t tag = current_memory_tag;
+    *reinterpret_cast<int32_t*>(base) = tag;
+    counters_[tag].num_allocations.fetch_add(1);
+    Track(tag, size);
+    *out = base + kHeaderSize;
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    if (new_size > std::numeric_limits<int64_t>::max() - kHeaderSize) {
+      return Status::OutOfMemory("realloc size overflows with the tag header");
+    }
+    uint8_t* base = *ptr - kHeaderSize;
+    RETURN_NOT_OK(
+        pool_->Reallocate(old_size + kHeaderSize, new_size + kHeaderSize, &base));
+    // The header moves with the data
+    Track(*reinterpret_cast<const int32_t*>(base), new_size - old_size);
+    *ptr = base + kHeaderSize;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    uint8_t* base = buffer - kHeaderSize;
+    const int32_t tag = *reinterpret_cast<const int32_t*>(base);
+    pool_->Free(base, size + kHeaderSize);
+    Track(tag, -size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::vector<MemoryTagStats> GetTagStats() const {
+    auto registry = MemoryTagRegistry::instance();
+    std::vector<MemoryTagStats> out;
+    for (int32_t tag = 0; tag < registry->size(); ++tag) {
+      const TagCounters& counters = counters_[tag];
+      if (counters.num_allocations.load() > 0) {
+        out.push_back({registry->name(tag), counters.bytes_allocated.load(),
+                       counters.max_memory.load(), counters.num_allocations.load()});
+      }
+    }
+    std::sort(out.begin(), out.end(),
+              [](const MemoryTagStats& left, const MemoryTagStats& right) {
+                return left.tag < right.tag;
+              });
+    return out;
+  }
+
+ private:
+  struct TagCounters {
+    std::atomic<int64_t> bytes_allocated{0};
+    std::atomic<int64_t> max_memory{0};
+    std::atomic<int64_t> num_allocations{0};
+  };
+
+  void Track(int32_t tag, int64_t diff) {
+    TagCounters& counters = counters_[tag];
+    auto allocated = counters.bytes_allocated.fetch_add(diff) + diff;
+    // As in MemoryPoolStats, the peak is not exact under concurrent updates
+    if (diff > 0 && allocated > counters.max_memory) {
+      counters.max_memory = allocated;
+    }
+    stats_.UpdateAllocatedBytes(diff);
+  }
+
+  MemoryPool* pool_;
+  std::unique_ptr<TagCounters[]> counters_;
+  internal::MemoryPoolStats stats_;
+};
+
+constexpr int64_t TaggingMemoryPool::TaggingMemoryPoolImpl::kHeaderSize;
+
+TaggingMemoryPool::TaggingMemoryPool(MemoryPool* pool) {
+  impl_.reset(new TaggingMemoryPoolImpl(pool));
+}
+
+TaggingMemoryPool::~TaggingMemoryPool() {}
+
+Status TaggingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status TaggingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void TaggingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t TaggingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t TaggingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::vector<MemoryTagStats> TaggingMemoryPool::GetTagStats() const {
+  return impl_->GetTagStats();
+}
+
+void TaggingMemoryPool::PrintReport(std::ostream* os) const {
+  *os << std::left << std::setw(32) << "tag" << std::right << std::setw(16)
+      << "bytes allocated" << std::setw(16) << "max memory" << std::setw(16)
+      << "allocations" << std::endl;
+  for (const auto& tag : GetTagStats()) {
+    *os << std::left << std::setw(32) << (tag.tag.empty() ? "(untagged)" : tag.tag)
+        << std::right << std::setw(16) << tag.bytes_allocated << std::setw(16)
+        << tag.max_memory << std::setw(16) << tag.num_allocations << std::endl;
+  }
+  *os << std::left << std::setw(32) << "(total)" << std::right << std::setw(16)
+      << bytes_allocated() << std::setw(16) << max_memory() << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////
+// MemoryBudget implementation
+
+MemoryBudget::MemoryBudget(std::shared_ptr<MemoryBudget> parent, int64_t limit)
+    : parent_(std::move(parent)),
+      limit_(limit),
+      soft_limit_(-1),
+      bytes_reserved_(0),
+      max_reserved_(0) {}
+
+MemoryBudget::~MemoryBudget() {
+  DCHECK_EQ(bytes_reserved_.load(), 0) << "MemoryBudget destroyed with reservations";
+}
+
+Status MemoryBudget::Make(int64_t limit, std::shared_ptr<MemoryBudget>* out) {
+  out->reset(new MemoryBudget(nullptr, limit));
+  return Status::OK();
+}
+
+Status MemoryBudget::MakeChild(int64_t limit, std::shared_ptr<MemoryBudget>* out) {
+  out->reset(new MemoryBudget(shared_from_this(), limit));
+  return Status::OK();
+}
+
+MemoryBudget* MemoryBudget::TryReserve(int64_t nbytes) {
+  for (MemoryBudget* budget = this; budget != nullptr; budget = budget->parent_.get()) {
+    const int64_t reserved = budget->bytes_reserved_.fetch_add(nbytes) + nbytes;
+    if (budget->limit_ >= 0 && reserved > budget->limit_) {
+      // Undo this level and the ones below
+      budget->bytes_reserved_.fetch_sub(nbytes);
+      if (budget != this) {
+        ReleaseFrom(budget, nbytes);
+      }
+      return budget;
+    }
+    // As in MemoryPoolStats, the maximum needn't be rigorous
+    if (reserved > budget->max_reserved_.load()) {
+      budget->max_reserved_.store(reserved);
+    }
+  }
+  return nullptr;
+}
+
+// Release from this budget up to, but excluding, `last`
+void MemoryBudget::ReleaseFrom(MemoryBudget* last, int64_t nbytes) {
+  for (MemoryBudget* budget = this; budget != last; budget = budget->parent_.get()) {
+    budget->bytes_reserved_.fetch_sub(nbytes);
+  }
+}
+
+void MemoryBudget::NotifySoftLimit(MemoryBudget* budget, int64_t excess) {
+  std::shared_ptr<SoftLimitCallback> callback;
+  {
+    std::lock_guard<std::mutex> lock(budget->callback_mutex_);
+    callback = budget->callback_;
+  }
+  if (callback) {
+    (*callback)(budget, excess);
+  }
+}
+
+Status MemoryBudget::Reserve(int64_t nbytes) {
+  DCHECK_GE(nbytes, 0);
+  MemoryBudget* exceeded = TryReserve(nbytes);
+  if (exceeded != nullptr) {
+    // Give caches a chance to shed memory, then retry
+    NotifySoftLimit(exceeded, exceeded->bytes_reserved() + nbytes - exceeded->limit_);
+    exceeded = TryReserve(nbytes);
+    if (exceeded != nullptr) {
+      return Status::OutOfMemory("Memory budget exceeded: reserving ", nbytes,
+                                 " bytes over ", exceeded->bytes_reserved(),
+                                 " bytes reserved, limit is ", exceeded->limit_);
+    }
+  }
+  for (MemoryBudget* budget = this; budget != nullptr; budget = budget->parent_.get()) {
+    const int64_t soft_limit = budget->soft_limit_.load();
+    if (soft_limit >= 0) {
+      const int64_t excess = budget->bytes_reserved() - soft_limit;
+      if (excess > 0) {
+        NotifySoftLimit(budget, excess);
+      }
+    }
+  }
+  return Status::OK();
+}
+
+void MemoryBudget::Release(int64_t nbytes) {
+  DCHECK_GE(nbytes, 0);
+  ReleaseFrom(nullptr, nbytes);
+}
+
+void MemoryBudget::SetSoftLimit(int64_t soft_limit, SoftLimitCallback callback) {
+  std::lock_guard<std::mutex> lock(callback_mutex_);
+  callback_ = callback ? std::make_shared<SoftLimitCallback>(std::move(callback))
+                       : nullptr;
+  soft_limit_.store(soft_limit);
+}
+
+///////////////////////////////////////////////////////////////////////
+// LimitedMemoryPool implementation
+
+LimitedMemoryPool::LimitedMemoryPool(MemoryPool* pool,
+                                     std::shared_ptr<MemoryBudget> budget)
+    : pool_(pool), budget_(std::move(budget)) {}
+
+LimitedMemoryPool::LimitedMemoryPool(MemoryPool* pool, int64_t limit) : pool_(pool) {
+  DCHECK_OK(MemoryBudget::Make(limit, &budget_));
+}
+
+LimitedMemoryPool::~LimitedMemoryPool() {}
+
+Status LimitedMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (size < 0) {
+    return Status::Invalid("negative malloc size");
+  }
+  RETURN_NOT_OK(budget_->Reserve(size));
+  Status st = pool_->Allocate(size, out);
+  if (!st.ok()) {
+    budget_->Release(size);
+    return st;
+  }
+  stats_.UpdateAllocatedBytes(size);
+  return Status::OK();
+}
+
+Status LimitedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  if (new_size < 0) {
+    return Status::Invalid("negative realloc size");
+  }
+  const int64_t diff = new_size - old_size;
+  if (diff > 0) {
+    RETURN_NOT_OK(budget_->Reserve(diff));
+  }
+  Status st = pool_->Reallocate(old_size, new_size, ptr);
+  if (!st.ok()) {
+    if (diff > 0) {
+      budget_->Release(diff);
+    }
+    return st;
+  }
+  if (diff < 0) {
+    budget_->Release(-diff);
+  }
+  stats_.UpdateAllocatedBytes(diff);
+  return Status::OK();
+}
+
+void LimitedMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  pool_->Free(buffer, size);
+  budget_->Release(size);
+  stats_.UpdateAllocatedBytes(-size);
+}
+
+int64_t LimitedMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t LimitedMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+///////////////////////////////////////////////////////////////////////
+// LargeBufferMemoryPool implementation
+
+LargeBufferOptions LargeBufferOptions::Defaults() { return LargeBufferOptions(); }
+
+namespace {
+
+constexpr int64_t kHugePageSize = 2 << 20;  // 2 MB on x86-64 and most ARM64
+
+#ifdef __linux__
+
+// Values of the Linux mbind() modes
+constexpr int kMpolPreferred = 1;
+constexpr int kMpolBind = 2;
+constexpr int kMpolInterleave = 3;
+
+Status BindMemory(uint8_t* data, int64_t size, NumaPolicy::type policy, int node) {
+  const int num_nodes = LargeBufferMemoryPool::GetNumaNodeCount();
+  const int bits_per_word = static_cast<int>(sizeof(unsigned long) * 8);  // NOLINT
+  std::vector<unsigned long> mask(num_nodes / bits_per_word + 1, 0);  // NOLINT
+  int mode;
+  switch (policy) {
+    case NumaPolicy::BIND:
+      mode = kMpolBind;
+      break;
+    case NumaPolicy::PREFERRED:
+      mode = kMpolPreferred;
+      break;
+    default:
+      mode = kMpolInterleave;
+      break;
+  }
+  if (mode == kMpolInterleave) {
+    for (int i = 0; i < num_nodes; ++i) {
+      mask[i / bits_per_word] |= 1UL << (i % bits_per_word);
+    }
+  } else {
+    mask[node / bits_per_word] |= 1UL << (node % bits_per_word);
+  }
+  // The kernel reads maxnode - 1 bits
+  const unsigned long max_node = mask.size() * bits_per_word + 1;  // NOLINT
+  if (syscall(SYS_mbind, data, static_cast<unsigned long>(size), mode,  // NOLINT
+              mask.data(), max_node, 0) != 0) {
+    return Status::IOError("mbind failed: ", std::strerror(errno));
+  }
+  return Status::OK();
+}
+
+#endif
+
+}  // namespace
+
+LargeBufferMemoryPool::LargeBufferMemoryPool(MemoryPool* pool,
+                                             const LargeBufferOptions& options)
+    : pool_(pool), options_(options) {}
+
+LargeBufferMemoryPool::~LargeBufferMemoryPool() {}
+
+Status LargeBufferMemoryPool::Make(MemoryPool* pool, const LargeBufferOptions& options,
+                                   std::unique_ptr<LargeBufferMemoryPool>* out) {
+  if (options.threshold <= 0) {
+    return Status::Invalid("Large buffer threshold must be positive");
+  }
+  if ((options.numa_policy == NumaPolicy::BIND ||
+       options.numa_policy == NumaPolicy::PREFERRED) &&
+      (options.numa_node < 0 || options.numa_node >= GetNumaNodeCount())) {
+    return Status::Invalid("NUMA node ", options.numa_node, " does not exist");
+  }
+  out->reset(new LargeBufferMemoryPool(pool, options));
+  return Status::OK();
+}
+
+int LargeBufferMemoryPool::GetNumaNodeCount() {
+#ifdef __linux__
+  // A list of ranges such as "0-3,5"
+  std::ifstream online("/sys/devices/system/node/online");
+  std::string ranges;
+  if (!std::getline(online, ranges)) {
+    return 1;
+  }
+  int num_nodes = 1;
+  std::stringstream ss(ranges);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    const size_t dash = range.find('-');
+    const std::string last = dash == std::string::npos ? range : range.substr(dash + 1);
+    num_nodes = std::max(num_nodes, std::atoi(last.c_str()) + 1);
+  }
+  return num_nodes;
+#else
+  return 1;
+#endif
+}
+
+bool LargeBufferMemoryPool::IsLarge(int64_t size) const {
+#ifdef __linux__
+  return size >= options_.threshold;
+#else
+  return false;
+#endif
+}
+
+#ifdef __linux__
+
+static int64_t MappingAlignment(bool huge_pages) {
+  return huge_pages ? kHugePageSize : static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+}
+
+Status LargeBufferMemoryPool::MapLarge(int64_t size, uint8_t** out) {
+  const int64_t alignment = MappingAlignment(options_.huge_pages);
+  if (size > std::numeric_limits<int64_t>::max() - 2 * alignment) {
+    return Status::OutOfMemory("malloc of size ", size, " failed");
+  }
+  const int64_t mapped_size = BitUtil::RoundUp(size, alignment);
+  // Over-map so as to align the start on a huge page boundary
+  const int64_t reserved_size =
+      options_.huge_pages ? mapped_size + alignment : mapped_size;
+  void* reserved = mmap(nullptr, static_cast<size_t>(reserved_size),
+                        PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (reserved == MAP_FAILED) {
+    return Status::OutOfMemory("malloc of size ", size,
+                               " failed: ", std::strerror(errno));
+  }
+  auto reserved_start = reinterpret_cast<uint8_t*>(reserved);
+  auto data = reinterpret_cast<uint8_t*>(
+      BitUtil::RoundUp(reinterpret_cast<int64_t>(reserved_start), alignment));
+  uint8_t* reserved_end = reserved_start + reserved_size;
+  if (data > reserved_start) {
+    munmap(reserved_start, data - reserved_start);
+  }
+  if (reserved_end > data + mapped_size) {
+    munmap(data + mapped_size, reserved_end - (data + mapped_size));
+  }
+
+  // The pages are not touched yet, so that the policies apply to all of them
+  if (options_.huge_pages) {
+    // Fails if transparent huge pages are disabled, which is harmless
+    ARROW_UNUSED(madvise(data, static_cast<size_t>(mapped_size), MADV_HUGEPAGE));
+  }
+  if (options_.numa_policy != NumaPolicy::DEFAULT) {
+    Status st = BindMemory(data, mapped_size, options_.numa_policy, options_.numa_node);
+    if (!st.ok()) {
+      munmap(data, static_cast<size_t>(mapped_size));
+      return st;
+    }
+  }
+  *out = data;
+  return Status::OK();
+}
+
+void LargeBufferMemoryPool::UnmapLarge(uint8_t* buffer, int64_t size) {
+  const int64_t mapped_size =
+      BitUtil::RoundUp(size, MappingAlignment(options_.huge_pages));
+  munmap(buffer, static_cast<size_t>(mapped_size));
+}
+
+#else
+
+Status LargeBufferMemoryPool::MapLarge(int64_t size, uint8_t** out) {
+  return Status::NotImplemented("Large buffer mappings are only supported on Linux");
+}
+
+void LargeBufferMemoryPool::UnmapLarge(uint8_t* buffer, int64_t size) {}
+
+#endif
+
+Status LargeBufferMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (IsLarge(size)) {
+    RETURN_NOT_OK(MapLarge(size, out));
+  } else {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+  }
+  stats_.UpdateAllocatedBytes(size);
+  return Status::OK();
+}
+
+Status LargeBufferMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                         uint8_t** ptr) {
+  const bool old_large = IsLarge(old_size);
+  const bool new_large = IsLarge(new_size);
+  if (!old_large && !new_large) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+  } else {
+    uint8_t* out;
+    if (new_large) {
+      RETURN_NOT_OK(MapLarge(new_size, &out));
+    } else {
+      RETURN_NOT_OK(pool_->Allocate(new_size, &out));
+    }
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    if (old_large) {
+      UnmapLarge(*ptr, old_size);
+    } else {
+      pool_->Free(*ptr, old_size);
+    }
+    *ptr = out;
+  }
+  stats_.UpdateAllocatedBytes(new_size - old_size);
+  return Status::OK();
+}
+
+void LargeBufferMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  if (IsLarge(size)) {
+    UnmapLarge(buffer, size);
+  } else {
+    pool_->Free(buffer, size);
+  }
+  stats_.UpdateAllocatedBytes(-size);
+}
+
+int64_t LargeBufferMemoryPool::bytes_allocated() const {
+  return stats_.bytes_allocated();
+}
+
+int64_t LargeBufferMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+///////////////////////////////////////////////////////////////////////
+// ThreadCachingMemoryPool implementation
+
+namespace {
+
+// Size classes are powers of two from 64 bytes to kMaxCachedSize
+constexpr int kMinSizeClassShift = 6;
+constexpr int kNumSizeClasses = 10;
+static_assert((int64_t(1) << (kMinSizeClassShift + kNumSizeClasses - 1)) ==
+                  ThreadCachingMemoryPool::kMaxCachedSize,
+              "size classes should cover kMaxCachedSize");
+
+// Number of blocks moved at once between thread caches and central lists
+constexpr size_t kTransferBatch = 32;
+// Thread caches overflow to the central lists beyond this many bytes per class
+constexpr int64_t kMaxThreadCacheBytesPerClass = 256 * 1024;
+// Thread caches publish their statistics every so many bytes
+constexpr int64_t kStatsBatchBytes = 256 * 1024;
+
+inline int SizeClass(int64_t size) {
+  return size <= (1 << kMinSizeClassShift) ? 0
+                                           : BitUtil::Log2(size) - kMinSizeClassShift;
+}
+
+inline int64_t ClassSize(int size_class) {
+  return int64_t(1) << (size_class + kMinSizeClassShift);
+}
+
+}  // namespace
+
+class ThreadCachingMemoryPool::Impl {
+ public:
+  explicit Impl(MemoryPool* pool) : pool_(pool), central_bytes_(0) {
+    std::lock_guard<std::mutex> lock(live_pools_mutex());
+    id_ = next_pool_id()++;
+    live_pools()[id_] = this;
+  }
+
+  ~Impl() {
+    {
+      // Exiting threads won't flush their caches into this pool anymore
+      std::lock_guard<std::mutex> lock(live_pools_mutex());
+      live_pools().erase(id_);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int c = 0; c < kNumSizeClasses; ++c) {
+      for (uint8_t* block : central_[c]) {
+        pool_->Free(block, ClassSize(c));
+      }
+      for (auto& cache : caches_) {
+        for (uint8_t* block : cache->free_lists[c]) {
+          pool_->Free(block, ClassSize(c));
+        }
+      }
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    ThreadCache* cache = GetThreadCache();
+    if (size <= 0 || size > kMaxCachedSize) {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    } else {
+      const int c = SizeClass(size);
+      std::vector<uint8_t*>* list = &cache->free_lists[c];
+      if (list->empty()) {
+        Refill(cache, c);
+      }
+      if (list->empty()) {
+        RETURN_NOT_OK(pool_->Allocate(ClassSize(c), out));
+      } else {
+        *out = list->back();
+        list->pop_back();
+        cache->AddCached(-ClassSize(c));
+      }
+    }
+    cache->UpdateAllocatedBytes(size, &stats_);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const bool old_cached = old_size > 0 && old_size <= kMaxCachedSize;
+    const bool new_cached = new_size > 0 && new_size <= kMaxCachedSize;
+    if (old_cached && new_cached && SizeClass(old_size) == SizeClass(new_size)) {
+      // Fits in the same block
+      GetThreadCache()->UpdateAllocatedBytes(new_size - old_size, &stats_);
+      return Status::OK();
+    }
+    if (!old_cached && !new_cached && old_size > 0 && new_size > 0) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+      GetThreadCache()->UpdateAllocatedBytes(new_size - old_size, &stats_);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    ThreadCache* cache = GetThreadCache();
+    if (size <= 0 || size > kMaxCachedSize) {
+      pool_->Free(buffer, size);
+    } else {
+      const int c = SizeClass(size);
+      std::vector<uint8_t*>* list = &cache->free_lists[c];
+      list->push_back(buffer);
+      cache->AddCached(ClassSize(c));
+      if (static_cast<int64_t>(list->size()) * ClassSize(c) >
+              kMaxThreadCacheBytesPerClass &&
+          list->size() > kTransferBatch) {
+        Overflow(cache, c);
+      }
+    }
+    cache->UpdateAllocatedBytes(-size, &stats_);
+  }
+
+  int64_t bytes_allocated() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t total = 0;
+    for (const auto& cache : caches_) {
+      total += cache->bytes_allocated.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  int64_t max_memory() { return std::max(stats_.max_memory(), bytes_allocated()); }
+
+  int64_t bytes_cached() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t total = central_bytes_;
+    for (const auto& cache : caches_) {
+      total += cache->bytes_cached.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+ private:
+  // Only modified by the owning thread; other threads read the counters
+  struct ThreadCache {
+    ThreadCache() : bytes_allocated(0), bytes_cached(0), unpublished_bytes(0) {}
+
+    void UpdateAllocatedBytes(int64_t diff, internal::MemoryPoolStats* stats) {
+      bytes_allocated.store(bytes_allocated.load(std::memory_order_relaxed) + diff,
+                            std::memory_order_relaxed);
+      unpublished_bytes += diff;
+      if (unpublished_bytes >= kStatsBatchBytes ||
+          unpublished_bytes <= -kStatsBatchBytes) {
+        stats->UpdateAllocatedBytes(unpublished_bytes);
+        unpublished_bytes = 0;
+      }
+    }
+
+    void AddCached(int64_t diff) {
+      bytes_cached.store(bytes_cached.load(std::memory_order_relaxed) + diff,
+                         std::memory_order_relaxed);
+    }
+
+    std::vector<uint8_t*> free_lists[kNumSizeClasses];
+    std::atomic<int64_t> bytes_allocated;
+    std::atomic<int64_t> bytes_cached;
+    int64_t unpublished_bytes;
+  };
+
+  // The caches of a thread, one per pool used by the thread
+  struct ThreadCaches {
+    ~ThreadCaches() {
+      std::lock_guard<std::mutex> lock(live_pools_mutex());
+      for (const auto& binding : bindings) {
+        auto it = live_pools().find(binding.first);
+        if (it != live_pools().end()) {
+          it->second->ReleaseThreadCache(binding.second);
+        }
+      }
+    }
+
+    std::vector<std::pair<uint64_t, ThreadCache*>> bindings;
+  };
+
+  ThreadCache* GetThreadCache() {
+    ThreadCaches& thread_caches = thread_caches_;
+    for (const auto& binding : thread_caches.bindings) {
+      if (binding.first == id_) {
+        return binding.second;
+      }
+    }
+    return NewThreadCache(&thread_caches);
+  }
+
+  ThreadCache* NewThreadCache(ThreadCaches* thread_caches) {
+    {
+      // Forget about the caches of destroyed pools
+      std::lock_guard<std::mutex> lock(live_pools_mutex());
+      auto& bindings = thread_caches->bindings;
+      bindings.erase(std::remove_if(bindings.begin(), bindings.end(),
+                                    [](const std::pair<uint64_t, ThreadCache*>& b) {
+                                      return live_pools().count(b.first) == 0;
+                                    }),
+                     bindings.end());
+    }
+    ThreadCache* cache;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!orphan_caches_.empty()) {
+        // Reuse the cache of an exited thread
+        cache = orphan_caches_.back();
+        orphan_caches_.pop_back();
+      } else {
+        caches_.emplace_back(new ThreadCache());
+        cache = caches_.back().get();
+      }
+    }
+    thread_caches->bindings.emplace_back(id_, cache);
+    return cache;
+  }
+
+  // Called when the thread owning the cache exits
+  void ReleaseThreadCache(ThreadCache* cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int c = 0; c < kNumSizeClasses; ++c) {
+      std::vector<uint8_t*>& list = cache->free_lists[c];
+      central_[c].insert(central_[c].end(), list.begin(), list.end());
+      central_bytes_ += static_cast<int64_t>(list.size()) * ClassSize(c);
+      list.clear();
+    }
+    cache->bytes_cached.store(0);
+    stats_.UpdateAllocatedBytes(cache->unpublished_bytes);
+    cache->unpublished_bytes = 0;
+    orphan_caches_.push_back(cache);
+  }
+
+  // Move a batch of blocks from the central list to the thread cache
+  void Refill(ThreadCache* cache, int c) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<uint8_t*>& central = central_[c];
+    const size_t n = std::min(central.size(), kTransferBatch);
+    cache->free_lists[c].insert(cache->free_lists[c].end(), central.end() - n,
+                                central.end());
+    central.resize(central.size() - n);
+    central_bytes_ -= static_cast<int64_t>(n) * ClassSize(c);
+    cache->AddCached(static_cast<int64_t>(n) * ClassSize(c));
+  }
+
+  // Move half of the thread cache's blocks to the central list
+  void Overflow(ThreadCache* cache, int c) {
+    std::vector<uint8_t*>& list = cache->free_lists[c];
+    const size_t n = list.size() / 2;
+    std::lock_guard<std::mutex> lock(mutex_);
+    central_[c].insert(central_[c].end(), list.end() - n, list.end());
+    list.resize(list.size() - n);
+    central_bytes_ += static_cast<int64_t>(n) * ClassSize(c);
+    cache->AddCached(-static_cast<int64_t>(n) * ClassSize(c));
+  }
+
+  // Registry of live pools, leaked to outlive thread-local destructors
+  static std::mutex& live_pools_mutex() {
+    static std::mutex* mutex = new std::mutex();
+    return *mutex;
+  }
+
+  static std::unordered_map<uint64_t, Impl*>& live_pools() {
+    static auto pools = new std::unordered_map<uint64_t, Impl*>();
+    return *pools;
+  }
+
+  static uint64_t& next_pool_id() {
+    static uint64_t id = 0;
+    return id;
+  }
+
+  static thread_local ThreadCaches thread_caches_;
+
+  MemoryPool* pool_;
+  // Unique among all pools ever created, unlike the address
+  uint64_t id_;
+  internal::MemoryPoolStats stats_;
+
+  // Protects the central lists and the list of caches
+  std::mutex mutex_;
+  std::vector<uint8_t*> central_[kNumSizeClasses];
+  int64_t central_bytes_;
+  std::vector<std::unique_ptr<ThreadCache>> caches_;
+  std::vector<ThreadCache*> orphan_caches_;
+};
+
+thread_local ThreadCachingMemoryPool::Impl::ThreadCaches
+    ThreadCachingMemoryPool::Impl::thread_caches_;
+
+constexpr int64_t ThreadCachingMemoryPool::kMaxCachedSize;
+
+ThreadCachingMemoryPool::ThreadCachingMemoryPool(MemoryPool* pool)
+    : impl_(new Impl(pool)) {}
+
+ThreadCachingMemoryPool::~ThreadCachingMemoryPool() {}
+
+Status ThreadCachingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ThreadCachingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                           uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ThreadCachingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t ThreadCachingMemoryPool::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t ThreadCachingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ThreadCachingMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+class ArenaMemoryPool::Impl {
+ public:
+  Impl(MemoryPool* pool, int64_t chunk_size)
+      : pool_(pool),
+        chunk_size_(BitUtil::RoundUpToMultipleOf64(chunk_size)),
+        position_(0),
+        last_allocation_(nullptr),
+        bytes_reserved_(0) {}
+
+  ~Impl() {
+    for (const auto& chunk : chunks_) {
+      pool_->Free(chunk.first, chunk.second);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    const int64_t aligned_size = BitUtil::RoundUpToMultipleOf64(size);
+    if (chunks_.empty() || position_ + aligned_size > chunks_.back().second) {
+      RETURN_NOT_OK(NewChunk(aligned_size));
+    }
+    *out = chunks_.back().first + position_;
+    position_ += aligned_size;
+    last_allocation_ = *out;
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (*ptr == last_allocation_ && new_size > 0) {
+        // Grow or shrink in place if the chunk has room
+        const int64_t start = last_allocation_ - chunks_.back().first;
+        const int64_t end = start + BitUtil::RoundUpToMultipleOf64(new_size);
+        if (end <= chunks_.back().second) {
+          position_ = end;
+          stats_.UpdateAllocatedBytes(new_size - old_size);
+          return Status::OK();
+        }
+      }
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffer == zero_size_area) {
+      DCHECK_EQ(size, 0);
+      return;
+    }
+    if (buffer == last_allocation_) {
+      // Reuse the memory of the last allocation
+      position_ = last_allocation_ - chunks_.back().first;
+      last_allocation_ = nullptr;
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Keep the first chunk, unless oversized
+    size_t keep = (!chunks_.empty() && chunks_[0].second == chunk_size_) ? 1 : 0;
+    for (size_t i = keep; i < chunks_.size(); ++i) {
+      pool_->Free(chunks_[i].first, chunks_[i].second);
+      bytes_reserved_ -= chunks_[i].second;
+    }
+    chunks_.resize(keep);
+    position_ = 0;
+    last_allocation_ = nullptr;
+    stats_.UpdateAllocatedBytes(-stats_.bytes_allocated());
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_reserved() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_reserved_;
+  }
+
+ private:
+  Status NewChunk(int64_t min_size) {
+    const int64_t size = std::max(chunk_size_, min_size);
+    uint8_t* data;
+    RETURN_NOT_OK(pool_->Allocate(size, &data));
+    chunks_.emplace_back(data, size);
+    bytes_reserved_ += size;
+    position_ = 0;
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  const int64_t chunk_size_;
+  std::mutex mutex_;
+  // (data, size) of the chunks, the last one being allocated from
+  std::vector<std::pair<uint8_t*, int64_t>> chunks_;
+  int64_t position_;
+  uint8_t* last_allocation_;
+  int64_t bytes_reserved_;
+  internal::MemoryPoolStats stats_;
+};
+
+constexpr int64_t ArenaMemoryPool::kDefaultChunkSize;
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* pool, int64_t chunk_size)
+    : impl_(new Impl(pool, chunk_size)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) { impl_->Free(buffer, size); }
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
 }  // namespace arrow
@@ -20,7 +20,12 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
 
 #include "arrow/util/visibility.h"
 
@@ -142,6 +147,193 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief An allocation tag, interned to a small integer id
+///
+/// Interning takes a lock, so code on hot paths should construct its tags
+/// once, e.g. as function-local statics, and enter them by id.
+class ARROW_EXPORT MemoryTag {
+ public:
+  explicit MemoryTag(const std::string& name);
+
+  int32_t id() const { return id_; }
+  const std::string& name() const;
+
+ private:
+  int32_t id_;
+};
+
+/// \brief Attributes the allocations of the current thread to a tag, e.g. a
+/// component name, for its lifetime
+///
+/// Scopes nest: allocations are attributed to the innermost tag. Tags are
+/// local to a thread and do not propagate to tasks spawned on other threads.
+/// Only TaggingMemoryPool takes them into account.
+class ARROW_EXPORT ScopedMemoryTag {
+ public:
+  /// \brief Enter a tag, interning it first
+  explicit ScopedMemoryTag(const std::string& tag);
+  /// \brief Enter an interned tag, without locking
+  explicit ScopedMemoryTag(const MemoryTag& tag);
+  ~ScopedMemoryTag();
+
+  /// \brief The innermost tag of the current thread, empty if none
+  static const std::string& current();
+
+ private:
+  ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+  ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+  int32_t previous_;
+};
+
+/// \brief Statistics of the allocations attributed to a tag
+struct ARROW_EXPORT MemoryTagStats {
+  /// The tag, empty for allocations made outside of any ScopedMemoryTag
+  std::string tag;
+  /// Bytes currently allocated
+  int64_t bytes_allocated;
+  /// Peak of bytes_allocated
+  int64_t max_memory;
+  /// Number of calls to Allocate
+  int64_t num_allocations;
+};
+
+/// \brief A memory pool aggregating statistics per allocation tag
+///
+/// Each allocation is attributed to the ScopedMemoryTag current in the
+/// allocating thread, and stays attributed to it when reallocated or freed
+/// from other scopes. Actual allocation is delegated to the wrapped pool.
+///
+/// The tag id is stored in a 64-byte header in front of each allocation, and
+/// the statistics are kept in atomic counters per tag, so that tracking takes
+/// no lock. The wrapped pool accounts for the headers too. Up to 255 distinct
+/// tags are reported by name; further tags are reported as "(other)".
+class ARROW_EXPORT TaggingMemoryPool : public MemoryPool {
+ public:
+  explicit TaggingMemoryPool(MemoryPool* pool);
+  ~TaggingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The statistics of each tag seen so far, ordered by tag
+  std::vector<MemoryTagStats> GetTagStats() const;
+
+  /// \brief Print a table of the statistics of each tag
+  void PrintReport(std::ostream* os) const;
+
+ private:
+  class TaggingMemoryPoolImpl;
+  std::unique_ptr<TaggingMemoryPoolImpl> impl_;
+};
+
+/// \brief A hierarchical memory budget, e.g. process, query, operator
+///
+/// Reserving bytes from a budget reserves them from all its ancestors too.
+/// A reservation fails with OutOfMemory if it would exceed the hard limit of
+/// any of these budgets. Accounting is lock-free.
+///
+/// Each budget may also have a soft limit. Reservations leaving a budget above
+/// its soft limit, or failing on its hard limit, call the budget's soft limit
+/// callback (outside of any lock) so that caches can release memory. A
+/// reservation failing on a hard limit is retried once after the callback.
+class ARROW_EXPORT MemoryBudget : public std::enable_shared_from_this<MemoryBudget> {
+ public:
+  /// \brief Callback called with the budget and the number of bytes by which
+  /// it exceeds its soft limit
+  using SoftLimitCallback = std::function<void(MemoryBudget* budget, int64_t excess)>;
+
+  /// \brief Create a root budget
+  ///
+  /// \param[in] limit the hard limit in bytes, or -1 for no limit
+  /// \param[out] out the created budget
+  /// \return Status
+  static Status Make(int64_t limit, std::shared_ptr<MemoryBudget>* out);
+
+  /// \brief Create a child budget, whose reservations also count against this one
+  ///
+  /// \param[in] limit the hard limit in bytes, or -1 for no limit besides
+  /// the ancestors' limits
+  /// \param[out] out the created budget
+  /// \return Status
+  Status MakeChild(int64_t limit, std::shared_ptr<MemoryBudget>* out);
+
+  ~MemoryBudget();
+
+  /// \brief Reserve bytes from this budget and its ancestors
+  Status Reserve(int64_t nbytes);
+
+  /// \brief Release bytes previously reserved
+  void Release(int64_t nbytes);
+
+  /// \brief Set the soft limit and the callback called when exceeding it
+  ///
+  /// The callback may be called concurrently from several threads, and must
+  /// not reserve from the budget.
+  void SetSoftLimit(int64_t soft_limit, SoftLimitCallback callback);
+
+  int64_t limit() const { return limit_; }
+  int64_t soft_limit() const { return soft_limit_.load(); }
+  /// \brief The parent budget, null for a root budget
+  MemoryBudget* parent() const { return parent_.get(); }
+
+  /// \brief The number of bytes currently reserved, including by descendants
+  int64_t bytes_reserved() const { return bytes_reserved_.load(); }
+  /// \brief The peak number of bytes reserved
+  int64_t max_reserved() const { return max_reserved_.load(); }
+
+ private:
+  MemoryBudget(std::shared_ptr<MemoryBudget> parent, int64_t limit);
+
+  // Try to reserve from this budget and its ancestors.  On failure, returns
+  // the budget whose limit was hit, with nothing reserved.
+  MemoryBudget* TryReserve(int64_t nbytes);
+  void ReleaseFrom(MemoryBudget* last, int64_t nbytes);
+  void NotifySoftLimit(MemoryBudget* budget, int64_t excess);
+
+  std::shared_ptr<MemoryBudget> parent_;
+  const int64_t limit_;
+  std::atomic<int64_t> soft_limit_;
+  std::atomic<int64_t> bytes_reserved_;
+  std::atomic<int64_t> max_reserved_;
+  std::mutex callback_mutex_;
+  std::shared_ptr<SoftLimitCallback> callback_;
+};
+
+/// \brief A memory pool whose allocations are accounted against a MemoryBudget
+///
+/// Allocations fail with OutOfMemory past the budget's hard limit (or that of
+/// one of its ancestors), without reaching the wrapped pool.
+class ARROW_EXPORT LimitedMemoryPool : public MemoryPool {
+ public:
+  LimitedMemoryPool(MemoryPool* pool, std::shared_ptr<MemoryBudget> budget);
+  /// \brief Create a pool with a root budget of the given hard limit
+  LimitedMemoryPool(MemoryPool* pool, int64_t limit);
+  ~LimitedMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  const std::shared_ptr<MemoryBudget>& budget() const { return budget_; }
+
+ private:
+  MemoryPool* pool_;
+  std::shared_ptr<MemoryBudget> budget_;
+  internal::MemoryPoolStats stats_;
+};
+
 /// Return the process-wide default memory pool.
 ARROW_EXPORT MemoryPool* default_memory_pool();
 
@@ -151,6 +343,156 @@ ARROW_EXPORT MemoryPool* default_memory_pool();
 #define ARROW_MEMORY_POOL_DEFAULT = default_memory_pool()
 #endif
 
+/// \brief NUMA memory placement policies
+struct NumaPolicy {
+  enum type {
+    /// Allocate on the node of the thread first touching the memory
+    DEFAULT,
+    /// Allocate on the given node only
+    BIND,
+    /// Allocate on the given node if possible
+    PREFERRED,
+    /// Interleave pages over all nodes
+    INTERLEAVE
+  };
+};
+
+/// \brief Options of LargeBufferMemoryPool
+struct ARROW_EXPORT LargeBufferOptions {
+  /// Allocations of at least this size are mapped directly, smaller ones go to
+  /// the wrapped pool
+  int64_t threshold = 4 << 20;
+  /// Whether to align mappings to huge pages and ask for transparent huge pages
+  bool huge_pages = true;
+  NumaPolicy::type numa_policy = NumaPolicy::DEFAULT;
+  /// The node for the BIND and PREFERRED policies
+  int numa_node = 0;
+
+  static LargeBufferOptions Defaults();
+};
+
+/// \brief A memory pool mapping large allocations directly from the operating
+/// system, on huge pages and NUMA nodes as configured
+///
+/// Huge pages reduce TLB misses when scanning large column buffers. Placing
+/// buffers on the NUMA node of the threads processing them avoids
+/// cross-socket memory traffic; interleaving spreads bandwidth over all nodes.
+/// Readers taking a MemoryPool (e.g. IPC and Parquet) thereby allocate their
+/// buffers on the chosen node.
+///
+/// Only supported on Linux; elsewhere, all allocations go to the wrapped pool.
+class ARROW_EXPORT LargeBufferMemoryPool : public MemoryPool {
+ public:
+  /// \brief Create a pool
+  ///
+  /// \param[in] pool the pool for allocations under the threshold
+  /// \param[in] options the pool options
+  /// \param[out] out the created pool
+  /// \return Status, an error if the NUMA node does not exist
+  static Status Make(MemoryPool* pool, const LargeBufferOptions& options,
+                     std::unique_ptr<LargeBufferMemoryPool>* out);
+
+  ~LargeBufferMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  const LargeBufferOptions& options() const { return options_; }
+
+  /// \brief The number of NUMA nodes of the system, 1 if unknown
+  static int GetNumaNodeCount();
+
+ private:
+  LargeBufferMemoryPool(MemoryPool* pool, const LargeBufferOptions& options);
+
+  bool IsLarge(int64_t size) const;
+  Status MapLarge(int64_t size, uint8_t** out);
+  void UnmapLarge(uint8_t* buffer, int64_t size);
+
+  MemoryPool* pool_;
+  LargeBufferOptions options_;
+  internal::MemoryPoolStats stats_;
+};
+
+/// \brief A memory pool caching small allocations in per-thread free lists
+///
+/// Allocations of up to kMaxCachedSize bytes are rounded up to a power-of-two
+/// size class (at least 64 bytes) and served from a free list local to the
+/// calling thread, without synchronization. Thread caches exchange blocks
+/// with central free lists in batches, and larger allocations go directly to
+/// the wrapped pool. Reallocations within a size class happen in place.
+///
+/// Statistics are kept per thread; max_memory() is only updated every few
+/// hundred kilobytes of allocations per thread.
+///
+/// Cached blocks are only returned to the wrapped pool when this pool is
+/// destroyed.
+class ARROW_EXPORT ThreadCachingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kMaxCachedSize = 32 * 1024;
+
+  explicit ThreadCachingMemoryPool(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+  ~ThreadCachingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The number of bytes held in free lists, for reuse
+  int64_t bytes_cached() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief A memory pool allocating from large chunks by bumping a pointer,
+/// and releasing all allocations at once
+///
+/// Meant for per-batch scratch memory. Free() only updates statistics, except
+/// for the last allocation whose memory is reused; reallocating the last
+/// allocation happens in place while the chunk has room.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultChunkSize = 1 << 20;  // 1 MB
+
+  explicit ArenaMemoryPool(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT,
+                           int64_t chunk_size = kDefaultChunkSize);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief Release all allocations, keeping the first chunk for reuse
+  ///
+  /// No memory allocated from the arena may be used after this call.
+  void Reset();
+
+  /// \brief The number of bytes of chunks obtained from the wrapped pool
+  int64_t bytes_reserved() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace arrow
 
 #endif  // ARROW_MEMORY_POOL_H
@@ -182,6 +182,29 @@ static inline int CountLeadingZeros(uint64_t value) {
 #endif
 }
 
+/// \brief Count the number of trailing zeros in an unsigned integer.
+static inline int CountTrailingZeros(uint64_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  if (value == 0) return 64;
+  return static_cast<int>(__builtin_ctzll(value));
+#elif defined(_MSC_VER)
+  unsigned long index;                    // NOLINT
+  if (_BitScanForward64(&index, value)) {  // NOLINT
+    return static_cast<int>(index);
+  } else {
+    return 64;
+  }
+#else
+  if (value == 0) return 64;
+  int bitpos = 0;
+  while ((value & 1) == 0) {
+    value >>= 1;
+    ++bitpos;
+  }
+  return bitpos;
+#endif
+}
+
 // Returns the minimum number of bits needed to represent an unsigned value
 static inline int NumRequiredBits(uint64_t x) { return 64 - CountLeadingZeros(x); }
 
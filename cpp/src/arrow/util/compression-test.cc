@@ -446,6 +446,49 @@ TEST_P(CodecTest, StreamingRoundtrip) {
   }
 }
 
+TEST_P(CodecTest, FrameLength) {
+  if (GetCompression() == Compression::BZ2) {
+    // SKIP: BZ2 doesn't support one-shot compression
+    return;
+  }
+
+  auto codec = MakeCodec();
+  vector<uint8_t> data = MakeCompressibleData(100000);
+  int64_t max_compressed_len = codec->MaxCompressedLen(data.size(), data.data());
+  vector<uint8_t> frame(max_compressed_len);
+  int64_t compressed_len;
+  ASSERT_OK(codec->Compress(data.size(), data.data(), max_compressed_len, frame.data(),
+                            &compressed_len));
+  frame.resize(compressed_len);
+
+  int64_t frame_len;
+  if (GetCompression() != Compression::ZSTD) {
+    // Only zstd frames (and BGZF members, not produced here) can be delimited
+    ASSERT_RAISES(NotImplemented,
+                  codec->GetFrameLength(frame.size(), frame.data(), &frame_len));
+    return;
+  }
+  ASSERT_OK(codec->GetFrameLength(frame.size(), frame.data(), &frame_len));
+  ASSERT_EQ(frame_len, compressed_len);
+
+  // Followed by another frame
+  vector<uint8_t> frames(frame);
+  frames.insert(frames.end(), frame.begin(), frame.end());
+  ASSERT_OK(codec->GetFrameLength(frames.size(), frames.data(), &frame_len));
+  ASSERT_EQ(frame_len, compressed_len);
+
+  // Incomplete frame
+  for (int64_t size : {0, 5, 20, static_cast<int>(compressed_len) - 1}) {
+    ASSERT_OK(codec->GetFrameLength(size, frame.data(), &frame_len));
+    ASSERT_EQ(frame_len, 0);
+  }
+
+  // Not a frame
+  vector<uint8_t> garbage = MakeRandomData(100);
+  ASSERT_RAISES(IOError,
+                codec->GetFrameLength(garbage.size(), garbage.data(), &frame_len));
+}
+
 INSTANTIATE_TEST_CASE_P(TestGZip, CodecTest, ::testing::Values(Compression::GZIP));
 
 INSTANTIATE_TEST_CASE_P(TestSnappy, CodecTest, ::testing::Values(Compression::SNAPPY));
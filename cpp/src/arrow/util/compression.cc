@@ -54,6 +54,11 @@ Decompressor::~Decompressor() {}
 
 Codec::~Codec() {}
 
+Status Codec::GetFrameLength(int64_t input_len, const uint8_t* input,
+                             int64_t* frame_len) {
+  return Status::NotImplemented("Frame length not available for codec '", name(), "'");
+}
+
 Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* result) {
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
@@ -144,6 +144,18 @@ class ARROW_EXPORT Codec {
   /// \brief Create a streaming decompressor instance
   virtual Status MakeDecompressor(std::shared_ptr<Decompressor>* out) = 0;
 
+  /// \brief Find the length of the compressed frame starting at input
+  ///
+  /// Some formats are made of independently decompressible frames whose
+  /// length can be known without decompressing them (e.g. zstd frames or
+  /// BGZF blocks).  On success, frame_len is the length of the first frame
+  /// in the input, or 0 if the input is too short to tell.
+  ///
+  /// NotImplemented is returned if the frame length cannot be known
+  /// before decompression (the default).
+  virtual Status GetFrameLength(int64_t input_len, const uint8_t* input,
+                                int64_t* frame_len);
+
   virtual const char* name() const = 0;
 };
 
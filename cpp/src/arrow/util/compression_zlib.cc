@@ -80,6 +80,10 @@ static Status ZlibErrorPrefix(const char* prefix_msg, const char* msg) {
   return Status::IOError(prefix_msg, (msg) ? msg : "(unknown error)");
 }
 
+static Status GZipMemberNotDelimited() {
+  return Status::NotImplemented("gzip member length not known before inflating");
+}
+
 // ----------------------------------------------------------------------
 // gzip decompressor implementation
 
@@ -325,6 +329,43 @@ class GZipCodec::GZipCodecImpl {
     return Status::OK();
   }
 
+  Status GetFrameLength(int64_t input_len, const uint8_t* input, int64_t* frame_len) {
+    // Only BGZF members (gzip members with a "BC" extra subfield giving
+    // the member size, see the SAM/BAM specification) can be delimited
+    // without inflating them
+    *frame_len = 0;
+    if (format_ == GZipCodec::DEFLATE) {
+      return GZipMemberNotDelimited();
+    }
+    // Fixed header (10 bytes) followed by the extra field length (2 bytes)
+    if (input_len < 12) {
+      return Status::OK();
+    }
+    if (input[0] != 0x1f || input[1] != 0x8b || input[2] != 8 || !(input[3] & 4)) {
+      // Not a gzip member with an extra field
+      return GZipMemberNotDelimited();
+    }
+    const int64_t extra_len = input[10] | (input[11] << 8);
+    if (input_len < 12 + extra_len) {
+      return Status::OK();
+    }
+    const uint8_t* subfield = input + 12;
+    const uint8_t* extra_end = subfield + extra_len;
+    while (subfield + 4 <= extra_end) {
+      const int64_t subfield_len = subfield[2] | (subfield[3] << 8);
+      if (subfield[0] == 'B' && subfield[1] == 'C' && subfield_len == 2 &&
+          subfield + 6 <= extra_end) {
+        const int64_t member_len = (subfield[4] | (subfield[5] << 8)) + 1;
+        if (member_len <= input_len) {
+          *frame_len = member_len;
+        }
+        return Status::OK();
+      }
+      subfield += 4 + subfield_len;
+    }
+    return GZipMemberNotDelimited();
+  }
+
   Status InitCompressor() {
     EndDecompressor();
     memset(&stream_, 0, sizeof(stream_));
@@ -520,6 +561,11 @@ Status GZipCodec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
   return impl_->MakeDecompressor(out);
 }
 
+Status GZipCodec::GetFrameLength(int64_t input_len, const uint8_t* input,
+                                 int64_t* frame_len) {
+  return impl_->GetFrameLength(input_len, input, frame_len);
+}
+
 const char* GZipCodec::name() const { return "gzip"; }
 
 }  // namespace util
@@ -56,6 +56,10 @@ class ARROW_EXPORT GZipCodec : public Codec {
 
   Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
 
+  /// BGZF members can be delimited, other gzip members cannot
+  Status GetFrameLength(int64_t input_len, const uint8_t* input,
+                        int64_t* frame_len) override;
+
   const char* name() const override;
 
  private:
@@ -227,6 +227,84 @@ Status ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input,
   return Status::OK();
 }
 
+// Frame layout constants from the zstd format specification (RFC 8478)
+static constexpr uint32_t kZSTDFrameMagic = 0xFD2FB528U;
+static constexpr uint32_t kZSTDSkippableFrameMagic = 0x184D2A50U;
+static constexpr uint32_t kZSTDSkippableFrameMagicMask = 0xFFFFFFF0U;
+
+static inline uint32_t ReadLE32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+Status ZSTDCodec::GetFrameLength(int64_t input_len, const uint8_t* input,
+                                 int64_t* frame_len) {
+  *frame_len = 0;
+  if (input_len < 8) {
+    return Status::OK();
+  }
+  const uint32_t magic = ReadLE32(input);
+  if ((magic & kZSTDSkippableFrameMagicMask) == kZSTDSkippableFrameMagic) {
+    const int64_t length = 8 + static_cast<int64_t>(ReadLE32(input + 4));
+    if (length <= input_len) {
+      *frame_len = length;
+    }
+    return Status::OK();
+  }
+  if (magic != kZSTDFrameMagic) {
+    return Status::IOError("Corrupt ZSTD compressed data: invalid frame magic");
+  }
+
+  // Frame header: descriptor, then optional window descriptor, dictionary id
+  // and content size
+  static const int64_t kDictIdSizes[] = {0, 1, 2, 4};
+  static const int64_t kContentSizeSizes[] = {0, 2, 4, 8};
+  const uint8_t descriptor = input[4];
+  const bool single_segment = (descriptor >> 5) & 1;
+  const bool has_checksum = (descriptor >> 2) & 1;
+  const int content_size_flag = descriptor >> 6;
+  int64_t pos = 5 + (single_segment ? 0 : 1) + kDictIdSizes[descriptor & 3] +
+                kContentSizeSizes[content_size_flag];
+  if (content_size_flag == 0 && single_segment) {
+    pos += 1;
+  }
+
+  // Blocks: 3-byte little-endian header, then contents
+  while (true) {
+    if (pos + 3 > input_len) {
+      return Status::OK();
+    }
+    const uint32_t header = static_cast<uint32_t>(input[pos]) |
+                            (static_cast<uint32_t>(input[pos + 1]) << 8) |
+                            (static_cast<uint32_t>(input[pos + 2]) << 16);
+    const bool last_block = header & 1;
+    const uint32_t block_type = (header >> 1) & 3;
+    const int64_t block_size = header >> 3;
+    pos += 3;
+    switch (block_type) {
+      case 0:  // Raw block
+      case 2:  // Compressed block
+        pos += block_size;
+        break;
+      case 1:  // RLE block: a single byte repeated block_size times
+        pos += 1;
+        break;
+      default:
+        return Status::IOError("Corrupt ZSTD compressed data: reserved block type");
+    }
+    if (last_block) {
+      break;
+    }
+  }
+  if (has_checksum) {
+    pos += 4;
+  }
+  if (pos <= input_len) {
+    *frame_len = pos;
+  }
+  return Status::OK();
+}
+
 int64_t ZSTDCodec::MaxCompressedLen(int64_t input_len,
                                     const uint8_t* ARROW_ARG_UNUSED(input)) {
   return ZSTD_compressBound(input_len);
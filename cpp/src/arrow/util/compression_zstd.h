@@ -46,6 +46,9 @@ class ARROW_EXPORT ZSTDCodec : public Codec {
 
   Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
 
+  Status GetFrameLength(int64_t input_len, const uint8_t* input,
+                        int64_t* frame_len) override;
+
   const char* name() const override { return "zstd"; }
 };
 
@@ -0,0 +1,215 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/type.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/parsing.h"
+
+namespace arrow {
+
+using internal::StringConverter;
+using internal::StringFormatter;
+
+template <typename FormatterType>
+std::string Format(const FormatterType& formatter,
+                   typename FormatterType::value_type value) {
+  constexpr int32_t kMaxLength = FormatterType::kMaxLength;
+  char buffer[kMaxLength];
+  const int32_t length = formatter(value, buffer);
+  EXPECT_LE(length, kMaxLength);
+  return std::string(buffer, length);
+}
+
+template <typename FormatterType>
+void AssertFormatting(const FormatterType& formatter,
+                      typename FormatterType::value_type value,
+                      const std::string& expected) {
+  ASSERT_EQ(Format(formatter, value), expected);
+}
+
+TEST(Formatting, Boolean) {
+  StringFormatter<BooleanType> formatter;
+
+  AssertFormatting(formatter, true, "true");
+  AssertFormatting(formatter, false, "false");
+}
+
+template <typename ARROW_TYPE>
+void TestIntegerFormatting() {
+  using c_type = typename ARROW_TYPE::c_type;
+  StringFormatter<ARROW_TYPE> formatter;
+
+  AssertFormatting(formatter, 0, "0");
+  AssertFormatting(formatter, 7, "7");
+  AssertFormatting(formatter, 10, "10");
+  AssertFormatting(formatter, 99, "99");
+  AssertFormatting(formatter, 100, "100");
+  AssertFormatting(formatter, std::numeric_limits<c_type>::max(),
+                   std::to_string(std::numeric_limits<c_type>::max()));
+  AssertFormatting(formatter, std::numeric_limits<c_type>::min(),
+                   std::to_string(std::numeric_limits<c_type>::min()));
+
+  // Around powers of ten
+  c_type power = 1;
+  while (power <= std::numeric_limits<c_type>::max() / 10) {
+    power = static_cast<c_type>(power * 10);
+    AssertFormatting(formatter, power, std::to_string(power));
+    AssertFormatting(formatter, static_cast<c_type>(power - 1),
+                     std::to_string(power - 1));
+  }
+
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> dist(std::numeric_limits<c_type>::min(),
+                                              std::numeric_limits<c_type>::max());
+  for (int i = 0; i < 1000; ++i) {
+    const auto value = static_cast<c_type>(dist(gen));
+    AssertFormatting(formatter, value, std::to_string(value));
+  }
+}
+
+TEST(Formatting, Integers) {
+  TestIntegerFormatting<Int8Type>();
+  TestIntegerFormatting<Int16Type>();
+  TestIntegerFormatting<Int32Type>();
+  TestIntegerFormatting<Int64Type>();
+  TestIntegerFormatting<UInt8Type>();
+  TestIntegerFormatting<UInt16Type>();
+  TestIntegerFormatting<UInt32Type>();
+}
+
+TEST(Formatting, UInt64) {
+  StringFormatter<UInt64Type> formatter;
+
+  AssertFormatting(formatter, 0, "0");
+  AssertFormatting(formatter, 10000000000000000000ULL, "10000000000000000000");
+  AssertFormatting(formatter, 9999999999999999999ULL, "9999999999999999999");
+  AssertFormatting(formatter, 18446744073709551615ULL, "18446744073709551615");
+}
+
+TEST(Formatting, FloatingPoint) {
+  StringFormatter<DoubleType> formatter;
+
+  AssertFormatting(formatter, 0.0, "0.0");
+  AssertFormatting(formatter, -0.0, "-0.0");
+  AssertFormatting(formatter, 1.0, "1.0");
+  AssertFormatting(formatter, 1.5, "1.5");
+  AssertFormatting(formatter, -2.25, "-2.25");
+  AssertFormatting(formatter, 0.1, "0.1");
+  AssertFormatting(formatter, 123456.789, "123456.789");
+  AssertFormatting(formatter, 1e-6, "0.000001");
+  AssertFormatting(formatter, 1e-7, "1e-7");
+  AssertFormatting(formatter, 1e20, "100000000000000000000.0");
+  AssertFormatting(formatter, 1e21, "1e21");
+  AssertFormatting(formatter, -1.5e300, "-1.5e300");
+  AssertFormatting(formatter, std::numeric_limits<double>::infinity(), "inf");
+  AssertFormatting(formatter, -std::numeric_limits<double>::infinity(), "-inf");
+  AssertFormatting(formatter, std::nan(""), "nan");
+
+  StringFormatter<FloatType> float_formatter;
+  AssertFormatting(float_formatter, 0.1f, "0.1");
+  AssertFormatting(float_formatter, 3.0f, "3.0");
+  AssertFormatting(float_formatter, 1e-10f, "1e-10");
+}
+
+TEST(Formatting, FloatingPointRoundTrip) {
+  StringFormatter<DoubleType> formatter;
+  StringConverter<DoubleType> converter;
+
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<uint64_t> dist;
+  for (int i = 0; i < 1000; ++i) {
+    // Any bit pattern except NaNs
+    const uint64_t bits = dist(gen);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    if (std::isnan(value)) {
+      continue;
+    }
+    const std::string s = Format(formatter, value);
+    double out;
+    ASSERT_TRUE(converter(s.data(), s.length(), &out)) << s;
+    ASSERT_EQ(out, value) << s;
+  }
+}
+
+TEST(Formatting, Dates) {
+  StringFormatter<Date32Type> formatter;
+
+  AssertFormatting(formatter, 0, "1970-01-01");
+  AssertFormatting(formatter, 59, "1970-03-01");
+  AssertFormatting(formatter, 11016, "2000-02-29");
+  AssertFormatting(formatter, 17849, "2018-11-14");
+  AssertFormatting(formatter, -1, "1969-12-31");
+  AssertFormatting(formatter, -719528, "0000-01-01");
+  AssertFormatting(formatter, 2932896, "9999-12-31");
+  AssertFormatting(formatter, 2932897, "10000-01-01");
+  AssertFormatting(formatter, -719529, "-0001-12-31");
+
+  StringFormatter<Date64Type> date64_formatter;
+  AssertFormatting(date64_formatter, 0, "1970-01-01");
+  AssertFormatting(date64_formatter, 1542153600000LL, "2018-11-14");
+  AssertFormatting(date64_formatter, -1, "1969-12-31");
+}
+
+TEST(Formatting, Timestamps) {
+  StringFormatter<TimestampType> formatter(timestamp(TimeUnit::SECOND));
+
+  AssertFormatting(formatter, 0, "1970-01-01 00:00:00");
+  AssertFormatting(formatter, 1542129070LL, "2018-11-13 17:11:10");
+  AssertFormatting(formatter, 951782400LL, "2000-02-29 00:00:00");
+  AssertFormatting(formatter, -1, "1969-12-31 23:59:59");
+  AssertFormatting(formatter, -14182940LL, "1969-07-20 20:17:40");
+
+  StringFormatter<TimestampType> milli_formatter(timestamp(TimeUnit::MILLI));
+  AssertFormatting(milli_formatter, 1542129070123LL, "2018-11-13 17:11:10.123");
+  AssertFormatting(milli_formatter, -1, "1969-12-31 23:59:59.999");
+
+  StringFormatter<TimestampType> micro_formatter(timestamp(TimeUnit::MICRO));
+  AssertFormatting(micro_formatter, 1542129070000001LL, "2018-11-13 17:11:10.000001");
+
+  StringFormatter<TimestampType> nano_formatter(timestamp(TimeUnit::NANO));
+  AssertFormatting(nano_formatter, 1542129070123456789LL,
+                   "2018-11-13 17:11:10.123456789");
+  AssertFormatting(nano_formatter, std::numeric_limits<int64_t>::min(),
+                   "1677-09-21 00:12:43.145224192");
+}
+
+TEST(Formatting, TimestampRoundTrip) {
+  StringFormatter<TimestampType> formatter(timestamp(TimeUnit::SECOND));
+  StringConverter<TimestampType> converter(timestamp(TimeUnit::SECOND));
+
+  std::default_random_engine gen(42);
+  // Years 0000 to 9999
+  std::uniform_int_distribution<int64_t> dist(-62167219200LL, 253402300799LL);
+  for (int i = 0; i < 1000; ++i) {
+    const int64_t value = dist(gen);
+    const std::string s = Format(formatter, value);
+    int64_t out;
+    ASSERT_TRUE(converter(s.data(), s.length(), &out)) << s;
+    ASSERT_EQ(out, value) << s;
+  }
+}
+
+}  // namespace arrow
@@ -0,0 +1,382 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This is a private header for number-to-string formatting utilities
+
+#ifndef ARROW_UTIL_FORMATTING_H
+#define ARROW_UTIL_FORMATTING_H
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include <double-conversion/double-conversion.h>
+
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief A class providing conversion from some Arrow data types to strings
+///
+/// Conversion is triggered by calling operator() with a value and an output
+/// buffer of at least `kMaxLength` characters.  It returns the number of
+/// characters written.  The output can be read back by the StringConverter
+/// for the same type (see parsing.h).
+///
+/// As with StringConverter, it's recommended to use a single instance many
+/// times, if doing bulk conversion.  All formatters can be constructed from
+/// their data type; only the timestamp formatter requires it.
+template <typename ARROW_TYPE, typename Enable = void>
+class StringFormatter;
+
+template <>
+class StringFormatter<BooleanType> {
+ public:
+  using value_type = bool;
+  static constexpr int32_t kMaxLength = 5;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& = NULLPTR) {}
+
+  int32_t operator()(value_type value, char* out) const {
+    if (value) {
+      std::memcpy(out, "true", 4);
+      return 4;
+    }
+    std::memcpy(out, "false", 5);
+    return 5;
+  }
+};
+
+namespace detail {
+
+// The 100 two-digit numbers "00" to "99", concatenated
+inline const char* DigitPairs() {
+  static const char pairs[] =
+      "00010203040506070809"
+      "10111213141516171819"
+      "20212223242526272829"
+      "30313233343536373839"
+      "40414243444546474849"
+      "50515253545556575859"
+      "60616263646566676869"
+      "70717273747576777879"
+      "80818283848586878889"
+      "90919293949596979899";
+  return pairs;
+}
+
+// Return the number of decimal digits of `value`
+inline int32_t CountDigits(uint64_t value) {
+  static const uint64_t powers_of_ten[] = {1ULL,
+                                           10ULL,
+                                           100ULL,
+                                           1000ULL,
+                                           10000ULL,
+                                           100000ULL,
+                                           1000000ULL,
+                                           10000000ULL,
+                                           100000000ULL,
+                                           1000000000ULL,
+                                           10000000000ULL,
+                                           100000000000ULL,
+                                           1000000000000ULL,
+                                           10000000000000ULL,
+                                           100000000000000ULL,
+                                           1000000000000000ULL,
+                                           10000000000000000ULL,
+                                           100000000000000000ULL,
+                                           1000000000000000000ULL,
+                                           10000000000000000000ULL};
+  // Setting the lowest bit doesn't change the number of digits, and makes
+  // 0 count as one digit
+  value |= 1;
+  // Approximate log10 from log2 (1233 / 4096 ~= log10(2)), then correct
+  const int32_t bits = 64 - BitUtil::CountLeadingZeros(value);
+  const int32_t approx = (bits * 1233) >> 12;
+  return approx + (value >= powers_of_ten[approx]);
+}
+
+// Write the decimal digits of `value` backwards, two at a time, so that the
+// last digit is at `end - 1`
+inline void FormatDigitsBackwards(uint64_t value, char* end) {
+  const char* pairs = DigitPairs();
+  while (value >= 100) {
+    const auto pair = static_cast<uint32_t>(value % 100) * 2;
+    value /= 100;
+    *--end = pairs[pair + 1];
+    *--end = pairs[pair];
+  }
+  if (value >= 10) {
+    const auto pair = static_cast<uint32_t>(value) * 2;
+    *--end = pairs[pair + 1];
+    *--end = pairs[pair];
+  } else {
+    *--end = static_cast<char>('0' + value);
+  }
+}
+
+inline int32_t FormatUnsigned(uint64_t value, char* out) {
+  const int32_t length = CountDigits(value);
+  FormatDigitsBackwards(value, out + length);
+  return length;
+}
+
+// Write `value` with at least `width` digits, left-padded with zeros
+inline int32_t FormatUnsignedPadded(uint64_t value, int32_t width, char* out) {
+  const int32_t digits = CountDigits(value);
+  const int32_t length = digits > width ? digits : width;
+  std::memset(out, '0', static_cast<size_t>(length - digits));
+  FormatDigitsBackwards(value, out + length);
+  return length;
+}
+
+}  // namespace detail
+
+template <typename ARROW_TYPE>
+class StringFormatter<ARROW_TYPE, enable_if_unsigned_integer<ARROW_TYPE>> {
+ public:
+  using value_type = typename ARROW_TYPE::c_type;
+  static constexpr int32_t kMaxLength = std::numeric_limits<value_type>::digits10 + 1;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& = NULLPTR) {}
+
+  int32_t operator()(value_type value, char* out) const {
+    return detail::FormatUnsigned(value, out);
+  }
+};
+
+template <typename ARROW_TYPE>
+class StringFormatter<ARROW_TYPE, enable_if_signed_integer<ARROW_TYPE>> {
+ public:
+  using value_type = typename ARROW_TYPE::c_type;
+  static constexpr int32_t kMaxLength = std::numeric_limits<value_type>::digits10 + 2;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& = NULLPTR) {}
+
+  int32_t operator()(value_type value, char* out) const {
+    if (value >= 0) {
+      return detail::FormatUnsigned(static_cast<uint64_t>(value), out);
+    }
+    // Negate in unsigned arithmetic, which is well-defined for the minimum value
+    *out = '-';
+    return 1 + detail::FormatUnsigned(0 - static_cast<uint64_t>(value), out + 1);
+  }
+};
+
+// Floating-point values are written in their shortest representation that
+// round-trips, e.g. "1.5", "1.0", "1e-7" or "inf".
+template <class ARROW_TYPE>
+class FloatToStringFormatterMixin {
+ public:
+  using value_type = typename ARROW_TYPE::c_type;
+  // Including space for the terminating NUL written by double-conversion
+  static constexpr int32_t kMaxLength = 32;
+
+  explicit FloatToStringFormatterMixin(const std::shared_ptr<DataType>& = NULLPTR)
+      : formatter_(flags_, "inf", "nan", 'e', -6 /* decimal_in_shortest_low */,
+                   21 /* decimal_in_shortest_high */, 0, 0) {}
+
+  int32_t operator()(value_type value, char* out) const {
+    double_conversion::StringBuilder builder(out, kMaxLength);
+    Format(value, &builder);
+    return static_cast<int32_t>(builder.position());
+  }
+
+ protected:
+  // Integral values get a trailing ".0" so as not to be read as integers
+  static const int flags_ =
+      double_conversion::DoubleToStringConverter::EMIT_TRAILING_DECIMAL_POINT |
+      double_conversion::DoubleToStringConverter::EMIT_TRAILING_ZERO_AFTER_POINT;
+
+  void Format(float value, double_conversion::StringBuilder* builder) const {
+    formatter_.ToShortestSingle(value, builder);
+  }
+
+  void Format(double value, double_conversion::StringBuilder* builder) const {
+    formatter_.ToShortest(value, builder);
+  }
+
+  double_conversion::DoubleToStringConverter formatter_;
+};
+
+template <>
+class StringFormatter<FloatType> : public FloatToStringFormatterMixin<FloatType> {
+ public:
+  using FloatToStringFormatterMixin::FloatToStringFormatterMixin;
+};
+
+template <>
+class StringFormatter<DoubleType> : public FloatToStringFormatterMixin<DoubleType> {
+ public:
+  using FloatToStringFormatterMixin::FloatToStringFormatterMixin;
+};
+
+namespace detail {
+
+// Convert a number of days since 1970-01-01 to a proleptic Gregorian date
+// (see http://howardhinnant.github.io/date_algorithms.html#civil_from_days)
+inline void CivilFromDays(int64_t days, int64_t* year, uint32_t* month, uint32_t* day) {
+  days += 719468;
+  const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  const auto day_of_era = static_cast<uint32_t>(days - era * 146097);
+  const uint32_t year_of_era =
+      (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const uint32_t day_of_year =
+      day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const uint32_t month_index = (5 * day_of_year + 2) / 153;
+  *day = day_of_year - (153 * month_index + 2) / 5 + 1;
+  *month = month_index < 10 ? month_index + 3 : month_index - 9;
+  *year = static_cast<int64_t>(year_of_era) + era * 400 + (*month <= 2);
+}
+
+// Floor division, rounding towards negative infinity
+inline int64_t FloorDivide(int64_t value, int64_t divisor, int64_t* remainder) {
+  int64_t quotient = value / divisor;
+  *remainder = value % divisor;
+  if (*remainder < 0) {
+    --quotient;
+    *remainder += divisor;
+  }
+  return quotient;
+}
+
+inline void FormatTwoDigits(uint32_t value, char* out) {
+  std::memcpy(out, DigitPairs() + value * 2, 2);
+}
+
+// Write "YYYY-MM-DD", with more year digits or a sign if necessary
+inline int32_t FormatDate(int64_t days, char* out) {
+  int64_t year;
+  uint32_t month, day;
+  CivilFromDays(days, &year, &month, &day);
+  char* p = out;
+  if (year < 0) {
+    *p++ = '-';
+    year = -year;
+  }
+  p += FormatUnsignedPadded(static_cast<uint64_t>(year), 4, p);
+  *p++ = '-';
+  FormatTwoDigits(month, p);
+  p += 2;
+  *p++ = '-';
+  FormatTwoDigits(day, p);
+  p += 2;
+  return static_cast<int32_t>(p - out);
+}
+
+}  // namespace detail
+
+template <>
+class StringFormatter<Date32Type> {
+ public:
+  using value_type = Date32Type::c_type;
+  // Sign and 7 year digits, then "-MM-DD"
+  static constexpr int32_t kMaxLength = 14;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& = NULLPTR) {}
+
+  int32_t operator()(value_type value, char* out) const {
+    return detail::FormatDate(value, out);
+  }
+};
+
+template <>
+class StringFormatter<Date64Type> {
+ public:
+  using value_type = Date64Type::c_type;
+  // Sign and 12 year digits, then "-MM-DD"
+  static constexpr int32_t kMaxLength = 19;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& = NULLPTR) {}
+
+  int32_t operator()(value_type value, char* out) const {
+    int64_t remainder;
+    return detail::FormatDate(detail::FloorDivide(value, 86400000LL, &remainder), out);
+  }
+};
+
+template <>
+class StringFormatter<TimestampType> {
+ public:
+  using value_type = TimestampType::c_type;
+  // Date, then " hh:mm:ss" and up to 9 fractional digits
+  static constexpr int32_t kMaxLength = 40;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& type)
+      : unit_(checked_cast<TimestampType*>(type.get())->unit()) {
+    switch (unit_) {
+      case TimeUnit::SECOND:
+        units_per_second_ = 1;
+        fraction_digits_ = 0;
+        break;
+      case TimeUnit::MILLI:
+        units_per_second_ = 1000;
+        fraction_digits_ = 3;
+        break;
+      case TimeUnit::MICRO:
+        units_per_second_ = 1000000;
+        fraction_digits_ = 6;
+        break;
+      case TimeUnit::NANO:
+        units_per_second_ = 1000000000;
+        fraction_digits_ = 9;
+        break;
+    }
+  }
+
+  // Write "YYYY-MM-DD hh:mm:ss", followed by the fraction of second for
+  // units smaller than the second
+  int32_t operator()(value_type value, char* out) const {
+    int64_t fraction, seconds_of_day;
+    const int64_t seconds = detail::FloorDivide(value, units_per_second_, &fraction);
+    const int64_t days = detail::FloorDivide(seconds, 86400, &seconds_of_day);
+
+    char* p = out + detail::FormatDate(days, out);
+    const auto seconds_of_day32 = static_cast<uint32_t>(seconds_of_day);
+    *p++ = ' ';
+    detail::FormatTwoDigits(seconds_of_day32 / 3600, p);
+    p[2] = ':';
+    detail::FormatTwoDigits(seconds_of_day32 / 60 % 60, p + 3);
+    p[5] = ':';
+    detail::FormatTwoDigits(seconds_of_day32 % 60, p + 6);
+    p += 8;
+    if (fraction_digits_ > 0) {
+      *p++ = '.';
+      p += detail::FormatUnsignedPadded(static_cast<uint64_t>(fraction),
+                                        fraction_digits_, p);
+    }
+    return static_cast<int32_t>(p - out);
+  }
+
+ protected:
+  const TimeUnit::type unit_;
+  int64_t units_per_second_;
+  int32_t fraction_digits_;
+};
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_FORMATTING_H
@@ -35,6 +35,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/memory_pool.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
@@ -708,6 +709,13 @@ struct DictionaryTraits<BooleanType> {
   }
 };
 
+/// \brief The tag attributing dictionaries materialized from memo tables in
+/// TaggingMemoryPool
+inline const MemoryTag& DictionaryMemoryTag() {
+  static const MemoryTag tag("dictionary");
+  return tag;
+}
+
 template <typename T>
 struct DictionaryTraits<T, enable_if_has_c_type<T>> {
   using c_type = typename T::c_type;
@@ -718,6 +726,7 @@ struct DictionaryTraits<T, enable_if_has_c_type<T>> {
                                        const MemoTableType& memo_table,
                                        int64_t start_offset,
                                        std::shared_ptr<ArrayData>* out) {
+    ScopedMemoryTag tag(DictionaryMemoryTag());
     std::shared_ptr<Buffer> dict_buffer;
     auto dict_length = static_cast<int64_t>(memo_table.size()) - start_offset;
     // This makes a copy, but we assume a dictionary array is usually small
@@ -742,6 +751,7 @@ struct DictionaryTraits<T, enable_if_binary<T>> {
                                        const MemoTableType& memo_table,
                                        int64_t start_offset,
                                        std::shared_ptr<ArrayData>* out) {
+    ScopedMemoryTag tag(DictionaryMemoryTag());
     std::shared_ptr<Buffer> dict_offsets;
     std::shared_ptr<Buffer> dict_data;
 
@@ -773,6 +783,7 @@ struct DictionaryTraits<T, enable_if_fixed_size_binary<T>> {
                                        const MemoTableType& memo_table,
                                        int64_t start_offset,
                                        std::shared_ptr<ArrayData>* out) {
+    ScopedMemoryTag tag(DictionaryMemoryTag());
     const T& concrete_type = internal::checked_cast<const T&>(*type);
     std::shared_ptr<Buffer> dict_data;
 
@@ -68,7 +68,9 @@
 #undef Realloc
 #undef Free
 #else  // POSIX-like platforms
+#include <limits.h>
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -488,6 +490,81 @@ Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes) {
   return Status::OK();
 }
 
+#ifndef _WIN32
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+Status FileWritev(int fd, const std::vector<io::BufferSpan>& spans) {
+  // Split the spans into iovecs of at most the maximum write size
+  std::vector<struct iovec> iov;
+  iov.reserve(spans.size());
+  for (const auto& span : spans) {
+    auto data = reinterpret_cast<uint8_t*>(const_cast<void*>(span.data));
+    int64_t remaining = span.size;
+    while (remaining > 0) {
+      const int64_t chunksize =
+          std::min(static_cast<int64_t>(ARROW_MAX_IO_CHUNKSIZE), remaining);
+      iov.push_back({data, static_cast<size_t>(chunksize)});
+      data += chunksize;
+      remaining -= chunksize;
+    }
+  }
+
+  size_t pos = 0;
+  while (pos < iov.size()) {
+    // Each call writes at most IOV_MAX iovecs and ARROW_MAX_IO_CHUNKSIZE bytes
+    int count = 0;
+    int64_t call_size = 0;
+    while (pos + count < iov.size() && count < IOV_MAX &&
+           (count == 0 || call_size + static_cast<int64_t>(iov[pos + count].iov_len) <=
+                              ARROW_MAX_IO_CHUNKSIZE)) {
+      call_size += iov[pos + count].iov_len;
+      ++count;
+    }
+
+    ssize_t ret = writev(fd, iov.data() + pos, count);
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+    if (ret == -1) {
+      return Status::IOError(std::string("Error writing bytes from file: ") +
+                             std::string(strerror(errno)));
+    }
+    if (ret == 0) {
+      // Every call has at least one non-empty iovec, so no progress is an error
+      return Status::IOError("Error writing bytes from file: no bytes written");
+    }
+
+    // Skip the iovecs that were written and trim a partially written one
+    size_t written = static_cast<size_t>(ret);
+    while (written > 0) {
+      if (written >= iov[pos].iov_len) {
+        written -= iov[pos].iov_len;
+        ++pos;
+      } else {
+        iov[pos].iov_base = reinterpret_cast<uint8_t*>(iov[pos].iov_base) + written;
+        iov[pos].iov_len -= written;
+        written = 0;
+      }
+    }
+  }
+  return Status::OK();
+}
+
+#else
+
+Status FileWritev(int fd, const std::vector<io::BufferSpan>& spans) {
+  // No vectored writes on Windows
+  for (const auto& span : spans) {
+    RETURN_NOT_OK(FileWrite(fd, reinterpret_cast<const uint8_t*>(span.data), span.size));
+  }
+  return Status::OK();
+}
+
+#endif
+
 Status FileTruncate(int fd, const int64_t size) {
   int ret, errno_actual;
 
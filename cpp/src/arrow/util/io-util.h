@@ -21,6 +21,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
@@ -163,6 +164,8 @@ Status FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nbytes,
 ARROW_EXPORT
 Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes);
 ARROW_EXPORT
+Status FileWritev(int fd, const std::vector<io::BufferSpan>& spans);
+ARROW_EXPORT
 Status FileTruncate(int fd, const int64_t size);
 
 ARROW_EXPORT
@@ -46,6 +46,20 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   return strings;
 }
 
+// Integers of 8 digits or more, which are parsed 8 digits at a time
+template <typename c_int>
+static std::vector<std::string> MakeLongIntStrings(int32_t num_items) {
+  using c_int_limits = std::numeric_limits<c_int>;
+  std::vector<std::string> base_strings = {
+      "12345678", "87654321", c_int_limits::is_signed ? "-123456789" : "123456789",
+      "2000000000", std::to_string(c_int_limits::max())};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"0.0",         "5",        "-12.3",
                                            "98765430000", "3456.789", "0.0012345",
@@ -57,6 +71,18 @@ static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   return strings;
 }
 
+// Floats with too many significant digits for the exact fast path
+static std::vector<std::string> MakeLongFloatStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"0.30000000000000004", "3.141592653589793238",
+                                           "-1.2345678901234567e-100",
+                                           "9.87654321012345678e200"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"2018-11-13 17:11:10", "2018-11-13 11:22:33",
                                            "2016-02-29 11:22:33"};
@@ -69,8 +95,9 @@ static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
 }
 
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
-static void BM_IntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
-  auto strings = MakeIntStrings<C_TYPE>(1000);
+static void BenchmarkIntegerParsing(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::vector<std::string>& strings) {
   StringConverter<ARROW_TYPE> converter;
 
   while (state.KeepRunning()) {
@@ -89,8 +116,19 @@ static void BM_IntegerParsing(benchmark::State& state) {  // NOLINT non-const re
 }
 
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
-static void BM_FloatParsing(benchmark::State& state) {  // NOLINT non-const reference
-  auto strings = MakeFloatStrings(1000);
+static void BM_IntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkIntegerParsing<ARROW_TYPE>(state, MakeIntStrings<C_TYPE>(1000));
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void BM_LongIntegerParsing(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkIntegerParsing<ARROW_TYPE>(state, MakeLongIntStrings<C_TYPE>(1000));
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void BenchmarkFloatParsing(benchmark::State& state,  // NOLINT non-const reference
+                                  const std::vector<std::string>& strings) {
   StringConverter<ARROW_TYPE> converter;
 
   while (state.KeepRunning()) {
@@ -108,6 +146,16 @@ static void BM_FloatParsing(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE>
+static void BM_FloatParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFloatParsing<ARROW_TYPE>(state, MakeFloatStrings(1000));
+}
+
+template <typename ARROW_TYPE>
+static void BM_LongFloatParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFloatParsing<ARROW_TYPE>(state, MakeLongFloatStrings(1000));
+}
+
 template <TimeUnit::type UNIT>
 static void BM_TimestampParsing(benchmark::State& state) {  // NOLINT non-const reference
   using c_type = TimestampType::c_type;
@@ -140,8 +188,14 @@ BENCHMARK_TEMPLATE(BM_IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(BM_IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(BM_IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(BM_LongIntegerParsing, Int32Type);
+BENCHMARK_TEMPLATE(BM_LongIntegerParsing, Int64Type);
+BENCHMARK_TEMPLATE(BM_LongIntegerParsing, UInt32Type);
+BENCHMARK_TEMPLATE(BM_LongIntegerParsing, UInt64Type);
+
 BENCHMARK_TEMPLATE(BM_FloatParsing, FloatType);
 BENCHMARK_TEMPLATE(BM_FloatParsing, DoubleType);
+BENCHMARK_TEMPLATE(BM_LongFloatParsing, DoubleType);
 
 BENCHMARK_TEMPLATE(BM_TimestampParsing, TimeUnit::SECOND);
 BENCHMARK_TEMPLATE(BM_TimestampParsing, TimeUnit::MILLI);
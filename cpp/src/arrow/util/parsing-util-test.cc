@@ -15,7 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstdlib>
 #include <locale>
+#include <random>
 #include <stdexcept>
 #include <string>
 
@@ -98,6 +100,46 @@ TEST(StringConversion, ToDouble) {
   AssertConversionFails(converter, "e");
 }
 
+TEST(StringConversion, ToDoubleFastPath) {
+  StringConverter<DoubleType> converter;
+
+  // Strings handled by the fast path must give the correctly rounded result
+  for (const std::string s :
+       {"0.1", "-0.3", "123.456", "3.14159265358979", "9007199254740992", "1e22",
+        "1.5e-21", "123456789012345.6", "0.000001", "4.9E+5", "007.5"}) {
+    double expected = std::strtod(s.c_str(), nullptr);
+    double out;
+    ASSERT_TRUE(converter.ParseSimple(s.data(), s.length(), &out)) << s;
+    ASSERT_EQ(out, expected) << s;
+  }
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int64_t> mantissa_dist(0, (int64_t(1) << 53));
+  std::uniform_int_distribution<int32_t> exponent_dist(-22, 22);
+  for (int i = 0; i < 10000; ++i) {
+    const std::string s = std::to_string(mantissa_dist(gen)) + "e" +
+                          std::to_string(exponent_dist(gen));
+    double expected = std::strtod(s.c_str(), nullptr);
+    double out;
+    ASSERT_TRUE(converter.ParseSimple(s.data(), s.length(), &out)) << s;
+    ASSERT_EQ(out, expected) << s;
+  }
+  // Strings not handled by the fast path are still converted
+  for (const std::string s :
+       {"9007199254740993", "1e23", "1.5e-23", "12345678901234567890.5", "+1.5",
+        ".5", "5.", "inf", "-NaN", "2.2250738585072014e-308"}) {
+    double out;
+    ASSERT_FALSE(converter.ParseSimple(s.data(), s.length(), &out)) << s;
+  }
+  AssertConversion(converter, "9007199254740993", 9007199254740992.0);
+  AssertConversion(converter, "1e23", 1e23);
+  AssertConversion(converter, "+1.5", 1.5);
+  AssertConversion(converter, "2.2250738585072014e-308", 2.2250738585072014e-308);
+
+  AssertConversionFails(converter, "1.5x");
+  AssertConversionFails(converter, "1e");
+  AssertConversionFails(converter, "-");
+}
+
 TEST(StringConversion, ToFloatLocale) {
   // French locale uses the comma as decimal point
   LocaleGuard locale_guard("fr_FR.UTF-8");
@@ -222,6 +264,14 @@ TEST(StringConversion, ToUInt32) {
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "4294967296");
   AssertConversionFails(converter, "12345678901");
+  // Non-digits at all positions of long values
+  for (size_t i = 0; i < 10; ++i) {
+    for (const char c : {'/', ':', 'a', ' ', '\xb0'}) {
+      std::string s = "1234567890";
+      s[i] = c;
+      AssertConversionFails(converter, s);
+    }
+  }
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
@@ -252,11 +302,19 @@ TEST(StringConversion, ToUInt64) {
   StringConverter<UInt64Type> converter;
 
   AssertConversion(converter, "0", 0);
+  AssertConversion(converter, "12345678", 12345678ULL);
+  AssertConversion(converter, "123456789012345678", 123456789012345678ULL);
+  AssertConversion(converter, "9999999999999999999", 9999999999999999999ULL);
+  AssertConversion(converter, "10000000000000000000", 10000000000000000000ULL);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
+  AssertConversionFails(converter, "20000000000000000000");
+  AssertConversionFails(converter, "100000000000000000000");
+  AssertConversionFails(converter, "1844674407370955161x");
+  AssertConversionFails(converter, "18446744073709551x15");
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
@@ -284,9 +342,14 @@ TEST(StringConversion, ToTimestamp1) {
     // Invalid dates
     AssertConversionFails(converter, "1970-00-01");
     AssertConversionFails(converter, "1970-13-01");
+    AssertConversionFails(converter, "1970-01-00");
     AssertConversionFails(converter, "1970-01-32");
     AssertConversionFails(converter, "1970-02-29");
+    AssertConversionFails(converter, "1970-04-31");
     AssertConversionFails(converter, "2100-02-29");
+    AssertConversionFails(converter, "19a0-01-01");
+    AssertConversionFails(converter, "1970-0:-01");
+    AssertConversionFails(converter, "1970-01-0/");
   }
   {
     StringConverter<TimestampType> converter(timestamp(TimeUnit::MILLI));
@@ -324,6 +387,9 @@ TEST(StringConversion, ToTimestamp2) {
     AssertConversion(converter, "2018-11-13 17:11:10Z", 1542129070);
     AssertConversion(converter, "2018-11-13T17:11:10Z", 1542129070);
     AssertConversion(converter, "1900-02-28 12:34:56", -2203932304LL);
+    AssertConversion(converter, "2000-02-29 23:59:59", 951868799);
+    AssertConversion(converter, "0000-03-01 00:00:00", -62162035200LL);
+    AssertConversion(converter, "9999-12-31 23:59:59", 253402300799LL);
 
     // Invalid dates
     AssertConversionFails(converter, "1970-02-29 00:00:00");
@@ -332,6 +398,9 @@ TEST(StringConversion, ToTimestamp2) {
     AssertConversionFails(converter, "1970-01-01 24:00:00");
     AssertConversionFails(converter, "1970-01-01 00:60:00");
     AssertConversionFails(converter, "1970-01-01 00:00:60");
+    AssertConversionFails(converter, "1970-01-01 00-00-00");
+    AssertConversionFails(converter, "1970-01-01 0a:00:00");
+    AssertConversionFails(converter, "1970-01-01 00:00:0 ");
   }
   {
     StringConverter<TimestampType> converter(timestamp(TimeUnit::MILLI));
@@ -358,4 +427,39 @@ TEST(StringConversion, ToTimestamp2) {
   }
 }
 
+TEST(StringConversion, ToTimestampFraction) {
+  {
+    StringConverter<TimestampType> converter(timestamp(TimeUnit::SECOND));
+
+    // No fraction digits in seconds
+    AssertConversionFails(converter, "2018-11-13 17:11:10.1");
+  }
+  {
+    StringConverter<TimestampType> converter(timestamp(TimeUnit::MILLI));
+
+    AssertConversion(converter, "2018-11-13 17:11:10.123", 1542129070123LL);
+    AssertConversion(converter, "2018-11-13T17:11:10.1Z", 1542129070100LL);
+    AssertConversion(converter, "1900-02-28 12:34:56.789", -2203932303211LL);
+
+    AssertConversionFails(converter, "2018-11-13 17:11:10.");
+    AssertConversionFails(converter, "2018-11-13 17:11:10.1234");
+    AssertConversionFails(converter, "2018-11-13 17:11:10.1a");
+    AssertConversionFails(converter, "2018-11-13 17:11:10,123");
+  }
+  {
+    StringConverter<TimestampType> converter(timestamp(TimeUnit::MICRO));
+
+    AssertConversion(converter, "2018-11-13 17:11:10.000001", 1542129070000001LL);
+    AssertConversion(converter, "2018-11-13 17:11:10.25", 1542129070250000LL);
+    AssertConversionFails(converter, "2018-11-13 17:11:10.0000001");
+  }
+  {
+    StringConverter<TimestampType> converter(timestamp(TimeUnit::NANO));
+
+    AssertConversion(converter, "2018-11-13 17:11:10.123456789", 1542129070123456789LL);
+    AssertConversion(converter, "1969-12-31 23:59:59.999999999Z", -1LL);
+    AssertConversionFails(converter, "2018-11-13 17:11:10.1234567890");
+  }
+}
+
 }  // namespace arrow
@@ -21,7 +21,8 @@
 #define ARROW_UTIL_PARSING_H
 
 #include <cassert>
-#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <locale>
 #include <memory>
@@ -33,8 +34,9 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
-#include "arrow/vendored/date.h"
+#include "arrow/util/macros.h"
 
 namespace arrow {
 namespace internal {
@@ -102,6 +104,9 @@ class StringToFloatConverterMixin {
                             "nan") {}
 
   bool operator()(const char* s, size_t length, value_type* out) {
+    if (ARROW_PREDICT_TRUE(ParseSimple(s, length, out))) {
+      return true;
+    }
     value_type v;
     // double-conversion doesn't give us an error flag but signals parse
     // errors with sentinel values.  Since a sentinel value can appear as
@@ -118,7 +123,103 @@ class StringToFloatConverterMixin {
     return true;
   }
 
+  /// \brief Fast exact conversion of plain decimal numbers
+  ///
+  /// Only handles strings of the form [-]digits[.digits][(e|E)[+|-]digits]
+  /// whose value can be computed exactly with a single floating-point
+  /// operation (Clinger's fast path), i.e. most numbers found in text data.
+  /// Return false for any other string, which doesn't mean it is invalid.
+  bool ParseSimple(const char* s, size_t length, value_type* out) const {
+    // Largest integers and powers of ten that are exactly representable
+    static constexpr uint64_t max_mantissa = uint64_t(1)
+                                             << std::numeric_limits<value_type>::digits;
+    static constexpr int32_t max_exponent =
+        std::is_same<value_type, float>::value ? 10 : 22;
+
+    const char* p = s;
+    const char* end = s + length;
+    bool negative = false;
+    if (p < end && *p == '-') {
+      negative = true;
+      ++p;
+    }
+    uint64_t mantissa = 0;
+    int32_t num_digits = 0;
+    int32_t exponent = 0;
+    // Integral part
+    const char* digits_start = p;
+    while (p < end && static_cast<uint8_t>(*p - '0') <= 9) {
+      mantissa = mantissa * 10 + static_cast<uint8_t>(*p - '0');
+      num_digits += (mantissa != 0);
+      ++p;
+    }
+    if (ARROW_PREDICT_FALSE(p == digits_start)) {
+      return false;
+    }
+    // Fractional part
+    if (p < end && *p == '.') {
+      ++p;
+      const char* fraction_start = p;
+      while (p < end && static_cast<uint8_t>(*p - '0') <= 9) {
+        mantissa = mantissa * 10 + static_cast<uint8_t>(*p - '0');
+        num_digits += (mantissa != 0);
+        ++p;
+      }
+      if (ARROW_PREDICT_FALSE(p == fraction_start)) {
+        return false;
+      }
+      exponent = -static_cast<int32_t>(p - fraction_start);
+    }
+    // More than 19 significant digits could have overflowed the mantissa
+    if (ARROW_PREDICT_FALSE(num_digits > 19)) {
+      return false;
+    }
+    // Exponent
+    if (p < end && (*p == 'e' || *p == 'E')) {
+      ++p;
+      bool negative_exponent = false;
+      if (p < end && (*p == '-' || *p == '+')) {
+        negative_exponent = (*p == '-');
+        ++p;
+      }
+      const char* exponent_start = p;
+      int32_t explicit_exponent = 0;
+      while (p < end && static_cast<uint8_t>(*p - '0') <= 9) {
+        if (ARROW_PREDICT_FALSE(explicit_exponent > 10000)) {
+          return false;
+        }
+        explicit_exponent = explicit_exponent * 10 + static_cast<uint8_t>(*p - '0');
+        ++p;
+      }
+      if (ARROW_PREDICT_FALSE(p == exponent_start)) {
+        return false;
+      }
+      exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+    if (ARROW_PREDICT_FALSE(p != end)) {
+      return false;
+    }
+    if (ARROW_PREDICT_FALSE(mantissa > max_mantissa) ||
+        ARROW_PREDICT_FALSE(exponent < -max_exponent) ||
+        ARROW_PREDICT_FALSE(exponent > max_exponent)) {
+      return false;
+    }
+    // Both operands are exact, so the result is correctly rounded
+    value_type v = static_cast<value_type>(mantissa);
+    if (exponent < 0) {
+      v /= kPowersOfTen[-exponent];
+    } else {
+      v *= kPowersOfTen[exponent];
+    }
+    *out = negative ? -v : v;
+    return true;
+  }
+
  protected:
+  static constexpr value_type kPowersOfTen[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
   static const int flags_ =
       double_conversion::StringToDoubleConverter::ALLOW_CASE_INSENSIBILITY;
   // Two unlikely values to signal a parsing error
@@ -141,6 +242,10 @@ class StringToFloatConverterMixin {
   }
 };
 
+template <class ARROW_TYPE>
+constexpr
+    typename ARROW_TYPE::c_type StringToFloatConverterMixin<ARROW_TYPE>::kPowersOfTen[];
+
 template <>
 class StringConverter<FloatType> : public StringToFloatConverterMixin<FloatType> {};
 
@@ -211,7 +316,103 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
   return true;
 }
 
+// Parse exactly 8 decimal digits at once using SWAR (SIMD within a register)
+// arithmetic.  Return false if any of the characters is not a digit.
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t chunk;
+  std::memcpy(&chunk, s, sizeof(chunk));
+  chunk = BitUtil::FromLittleEndian(chunk);
+  // All bytes must be in the range 0x30-0x39
+  if (ARROW_PREDICT_FALSE((((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                            (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >>
+                             4)) != 0x3333333333333333ULL))) {
+    return false;
+  }
+  chunk -= 0x3030303030303030ULL;
+  // Combine adjacent digits into 2-digit, then 4-digit, then 8-digit numbers
+  chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FFULL;
+  chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFFULL;
+  chunk = (chunk * 10000 + (chunk >> 32)) & 0x00000000FFFFFFFFULL;
+  *out = static_cast<uint32_t>(chunk);
+  return true;
+}
+
+// Match the 8 characters at `s` against a fixed layout, given as the
+// little-endian packing of a template string where '0' stands for any decimal
+// digit and other characters must appear verbatim (e.g. "00:00:00").
+// `separators` has 0xFF in the bytes of the verbatim characters.  On success,
+// `*out` holds the value of each digit in its byte and zero elsewhere.
+inline bool MatchDigitLayout(const char* s, uint64_t layout, uint64_t separators,
+                             uint64_t* out) {
+  uint64_t chunk;
+  std::memcpy(&chunk, s, sizeof(chunk));
+  chunk = BitUtil::FromLittleEndian(chunk) ^ layout;
+  // Digit bytes must now be in the range 0-9, separator bytes must be 0
+  if (ARROW_PREDICT_FALSE(((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                           ((chunk + 0x0606060606060606ULL) & 0x1010101010101010ULL) |
+                           (chunk & separators)) != 0)) {
+    return false;
+  }
+  *out = chunk;
+  return true;
+}
+
+// Return the 2-digit number in bytes `i` and `i + 1` of a matched layout
+inline uint32_t LayoutTwoDigits(uint64_t chunk, int i) {
+  return static_cast<uint32_t>((chunk >> (8 * i)) & 0xFF) * 10U +
+         static_cast<uint32_t>((chunk >> (8 * i + 8)) & 0xFF);
+}
+
+// Parse a string of at least 8 digits, mostly 8 digits at a time
+template <typename C_TYPE>
+inline bool ParseLongUnsigned(const char* s, size_t length, C_TYPE* out) {
+  static_assert(sizeof(C_TYPE) >= 4, "only for 32- and 64-bit integers");
+  static constexpr size_t max_digits = std::numeric_limits<C_TYPE>::digits10 + 1;
+  // Up to 19 digits can be accumulated in a uint64_t without overflow
+  static constexpr size_t max_safe_digits = std::numeric_limits<uint64_t>::digits10;
+
+  if (ARROW_PREDICT_FALSE(length > max_digits)) {
+    return false;
+  }
+  const size_t safe_length = std::min(length, max_safe_digits);
+  uint64_t result = 0;
+  // Leading digits so that the rest is a multiple of 8
+  size_t i = 0;
+  for (; i < safe_length % 8; ++i) {
+    const uint8_t digit = ParseDecimalDigit(s[i]);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  for (; i < safe_length; i += 8) {
+    uint32_t digits;
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s + i, &digits))) {
+      return false;
+    }
+    result = result * 100000000U + digits;
+  }
+  if (ARROW_PREDICT_FALSE(length > safe_length)) {
+    // 20th digit of a uint64_t
+    const uint8_t digit = ParseDecimalDigit(s[i]);
+    static constexpr uint64_t max_result = std::numeric_limits<uint64_t>::max();
+    if (ARROW_PREDICT_FALSE(digit > 9U) ||
+        ARROW_PREDICT_FALSE(result > (max_result - digit) / 10U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  if (ARROW_PREDICT_FALSE(result > std::numeric_limits<C_TYPE>::max())) {
+    return false;
+  }
+  *out = static_cast<C_TYPE>(result);
+  return true;
+}
+
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  if (length >= 8) {
+    return ParseLongUnsigned(s, length, out);
+  }
   uint32_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -231,6 +432,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (length >= 8) {
+    return ParseLongUnsigned(s, length, out);
+  }
   uint64_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -367,23 +571,30 @@ class StringConverter<TimestampType> {
   using value_type = TimestampType::c_type;
 
   explicit StringConverter(const std::shared_ptr<DataType>& type)
-      : unit_(checked_cast<TimestampType*>(type.get())->unit()) {}
+      : unit_(checked_cast<TimestampType*>(type.get())->unit()),
+        multiplier_(UnitsPerSecond(unit_)) {}
 
   bool operator()(const char* s, size_t length, value_type* out) {
     // We allow the following formats:
     // - "YYYY-MM-DD"
     // - "YYYY-MM-DD[ T]hh:mm:ss"
-    // - "YYYY-MM-DD[ T]hh:mm:ssZ"
+    // - "YYYY-MM-DD[ T]hh:mm:ss.s[s...]", with at most as many fraction
+    //   digits as the unit has (3, 6 or 9)
+    // - any of the two latter, followed by "Z"
     // UTC is always assumed, and the DataType's timezone is ignored.
-    date::year_month_day ymd;
+    //
+    // All formats have a fixed layout, so the characters are validated and
+    // decoded 8 at a time, without any calendar library calls.
+    int64_t days;
     if (ARROW_PREDICT_FALSE(length < 10)) {
       return false;
     }
     if (length == 10) {
-      if (ARROW_PREDICT_FALSE(!ParseYYYY_MM_DD(s, &ymd))) {
+      if (ARROW_PREDICT_FALSE(!ParseYYYY_MM_DD(s, &days))) {
         return false;
       }
-      return ConvertTimePoint(date::sys_days(ymd), out);
+      *out = days * 86400 * multiplier_;
+      return true;
     }
     if (ARROW_PREDICT_FALSE(s[10] != ' ') && ARROW_PREDICT_FALSE(s[10] != 'T')) {
       return false;
@@ -391,76 +602,96 @@ class StringConverter<TimestampType> {
     if (s[length - 1] == 'Z') {
       --length;
     }
-    if (length == 19) {
-      if (ARROW_PREDICT_FALSE(!ParseYYYY_MM_DD(s, &ymd))) {
+    int64_t fraction = 0;
+    if (length > 19) {
+      if (ARROW_PREDICT_FALSE(s[19] != '.') ||
+          ARROW_PREDICT_FALSE(!ParseFraction(s + 20, length - 20, &fraction))) {
         return false;
       }
-      std::chrono::duration<value_type> seconds;
-      if (ARROW_PREDICT_FALSE(!ParseHH_MM_SS(s + 11, &seconds))) {
-        return false;
-      }
-      return ConvertTimePoint(date::sys_days(ymd) + seconds, out);
+    } else if (ARROW_PREDICT_FALSE(length != 19)) {
+      return false;
     }
-    return false;
+    int64_t seconds;
+    if (ARROW_PREDICT_FALSE(!ParseYYYY_MM_DD(s, &days))) {
+      return false;
+    }
+    if (ARROW_PREDICT_FALSE(!ParseHH_MM_SS(s + 11, &seconds))) {
+      return false;
+    }
+    *out = (days * 86400 + seconds) * multiplier_ + fraction;
+    return true;
   }
 
  protected:
-  template <class TimePoint>
-  bool ConvertTimePoint(TimePoint tp, value_type* out) {
-    auto duration = tp.time_since_epoch();
-    switch (unit_) {
+  static int64_t UnitsPerSecond(TimeUnit::type unit) {
+    switch (unit) {
       case TimeUnit::SECOND:
-        *out = std::chrono::duration_cast<std::chrono::seconds>(duration).count();
-        return true;
+        return 1;
       case TimeUnit::MILLI:
-        *out = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
-        return true;
+        return 1000;
       case TimeUnit::MICRO:
-        *out = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
-        return true;
+        return 1000000;
       case TimeUnit::NANO:
-        *out = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
-        return true;
+        return 1000000000;
     }
     // Unreachable, but suppress compiler warning
     assert(0);
-    *out = 0;
-    return true;
+    return 1;
   }
 
-  bool ParseYYYY_MM_DD(const char* s, date::year_month_day* out) {
-    uint16_t year;
-    uint8_t month, day;
-    if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 4, &year))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 5, 2, &month))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 8, 2, &day))) {
-      return false;
-    }
-    *out = {date::year{year}, date::month{month}, date::day{day}};
-    return out->ok();
+  static inline bool IsLeapYear(uint32_t year) {
+    return (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0);
+  }
+
+  // Number of days from 1970-01-01 to the given proleptic Gregorian date
+  // (see http://howardhinnant.github.io/date_algorithms.html#days_from_civil)
+  static inline int64_t DaysFromCivil(int64_t year, uint32_t month, uint32_t day) {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const uint32_t year_of_era = static_cast<uint32_t>(year - era * 400);
+    const uint32_t day_of_year =
+        (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const uint32_t day_of_era =
+        year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
   }
 
-  bool ParseHH_MM_SS(const char* s, std::chrono::duration<value_type>* out) {
-    uint8_t hours, minutes, seconds;
-    if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
+  bool ParseYYYY_MM_DD(const char* s, int64_t* out) {
+    static constexpr uint8_t days_in_month[] = {31, 28, 31, 30, 31, 30,
+                                                31, 31, 30, 31, 30, 31};
+    // "YYYY-MM-" and the overlapping "YY-MM-DD"
+    uint64_t head, tail;
+    if (ARROW_PREDICT_FALSE(!detail::MatchDigitLayout(s, 0x2D30302D30303030ULL,
+                                                      0xFF0000FF00000000ULL, &head)) ||
+        ARROW_PREDICT_FALSE(!detail::MatchDigitLayout(s + 2, 0x30302D30302D3030ULL,
+                                                      0x0000FF0000FF0000ULL, &tail))) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 2, &hours))) {
+    const uint32_t year =
+        detail::LayoutTwoDigits(head, 0) * 100U + detail::LayoutTwoDigits(head, 2);
+    const uint32_t month = detail::LayoutTwoDigits(head, 5);
+    const uint32_t day = detail::LayoutTwoDigits(tail, 6);
+    if (ARROW_PREDICT_FALSE(month - 1 >= 12U) || ARROW_PREDICT_FALSE(day == 0)) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 3, 2, &minutes))) {
+    if (ARROW_PREDICT_FALSE(day > days_in_month[month - 1]) &&
+        !(month == 2 && day == 29 && IsLeapYear(year))) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 6, 2, &seconds))) {
+    *out = DaysFromCivil(year, month, day);
+    return true;
+  }
+
+  bool ParseHH_MM_SS(const char* s, int64_t* out) {
+    // "hh:mm:ss"
+    uint64_t chunk;
+    if (ARROW_PREDICT_FALSE(!detail::MatchDigitLayout(s, 0x30303A30303A3030ULL,
+                                                      0x0000FF0000FF0000ULL, &chunk))) {
       return false;
     }
+    const uint32_t hours = detail::LayoutTwoDigits(chunk, 0);
+    const uint32_t minutes = detail::LayoutTwoDigits(chunk, 3);
+    const uint32_t seconds = detail::LayoutTwoDigits(chunk, 6);
     if (ARROW_PREDICT_FALSE(hours >= 24)) {
       return false;
     }
@@ -470,11 +701,32 @@ class StringConverter<TimestampType> {
     if (ARROW_PREDICT_FALSE(seconds >= 60)) {
       return false;
     }
-    *out = std::chrono::duration<value_type>(3600U * hours + 60U * minutes + seconds);
+    *out = 3600 * hours + 60 * minutes + seconds;
+    return true;
+  }
+
+  // Parse the digits of a fraction of second into a number of units
+  bool ParseFraction(const char* s, size_t length, int64_t* out) const {
+    if (ARROW_PREDICT_FALSE(length == 0)) {
+      return false;
+    }
+    int64_t value = 0;
+    int64_t scale = multiplier_;
+    for (size_t i = 0; i < length; ++i) {
+      const uint8_t digit = detail::ParseDecimalDigit(s[i]);
+      // Digits beyond the precision of the unit are rejected
+      if (ARROW_PREDICT_FALSE(digit > 9) || ARROW_PREDICT_FALSE(scale < 10)) {
+        return false;
+      }
+      scale /= 10;
+      value += digit * scale;
+    }
+    *out = value;
     return true;
   }
 
   const TimeUnit::type unit_;
+  const int64_t multiplier_;
 };
 
 }  // namespace internal
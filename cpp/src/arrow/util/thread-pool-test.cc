@@ -296,6 +296,16 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+TEST_F(TestThreadPool, OwnsThisThread) {
+  auto pool = this->MakeThreadPool(2);
+  auto other_pool = this->MakeThreadPool(1);
+  ASSERT_FALSE(pool->OwnsThisThread());
+
+  auto ThreadPoolOwnsThisThread = [](ThreadPool* pool) { return pool->OwnsThisThread(); };
+  ASSERT_TRUE(pool->Submit(ThreadPoolOwnsThisThread, pool.get()).get());
+  ASSERT_FALSE(pool->Submit(ThreadPoolOwnsThisThread, other_pool.get()).get());
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
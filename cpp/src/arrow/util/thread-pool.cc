@@ -31,6 +31,9 @@
 namespace arrow {
 namespace internal {
 
+// State of the pool whose worker is the current thread, if any
+static thread_local const void* current_thread_pool_state = NULLPTR;
+
 struct ThreadPool::State {
   State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
 
@@ -122,6 +125,8 @@ int ThreadPool::GetCapacity() {
   return state_->desired_capacity_;
 }
 
+bool ThreadPool::OwnsThisThread() { return current_thread_pool_state == state_; }
+
 int ThreadPool::GetActualCapacity() {
   ProtectAgainstFork();
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -173,6 +178,7 @@ void ThreadPool::WorkerLoop(std::shared_ptr<State> state,
   // Since we hold the lock, `it` now points to the correct thread object
   // (LaunchWorkersUnlocked has exited)
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  current_thread_pool_state = state.get();
 
   // If too many threads, we should secede from the pool
   const auto should_secede = [&]() -> bool {
@@ -302,6 +308,25 @@ ThreadPool* GetCpuThreadPool() {
   return singleton.get();
 }
 
+// I/O threads mostly wait on the device, so their number is not tied to the
+// number of cores
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+std::shared_ptr<ThreadPool> ThreadPool::MakeIOThreadPool() {
+  std::shared_ptr<ThreadPool> pool;
+  DCHECK_OK(ThreadPool::Make(kDefaultIOThreadPoolCapacity, &pool));
+  // See MakeCpuThreadPool
+#ifdef _WIN32
+  pool->shutdown_on_destroy_ = false;
+#endif
+  return pool;
+}
+
+ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeIOThreadPool();
+  return singleton.get();
+}
+
 }  // namespace internal
 
 int GetCpuThreadPoolCapacity() { return internal::GetCpuThreadPool()->GetCapacity(); }
@@ -310,4 +335,10 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace arrow
@@ -56,6 +56,19 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 /// The current number is returned by GetCpuThreadPoolCapacity().
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool on which Arrow
+/// performs blocking I/O, such as asynchronous file reads.
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// The I/O pool is separate from the CPU pool, so that threads blocked in
+/// system calls do not take up CPU workers. Its capacity bounds the number
+/// of blocking reads in flight.
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 namespace internal {
 
 namespace detail {
@@ -93,6 +106,11 @@ class ARROW_EXPORT ThreadPool {
   // thread count is fully adjusted.
   Status SetCapacity(int threads);
 
+  // Whether the calling thread is one of the worker threads of this pool.
+  // Tasks that would wait on other tasks of the same pool can use this to run
+  // them inline instead, since the pool may have no free worker left for them.
+  bool OwnsThisThread();
+
   // Heuristic for the default capacity of a thread pool for CPU-bound tasks.
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
@@ -138,6 +156,7 @@ class ARROW_EXPORT ThreadPool {
   FRIEND_TEST(TestThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend ARROW_EXPORT ThreadPool* GetIOThreadPool();
 
   struct State;
 
@@ -161,6 +180,7 @@ class ARROW_EXPORT ThreadPool {
                          std::list<std::thread>::iterator it);
 
   static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
+  static std::shared_ptr<ThreadPool> MakeIOThreadPool();
 
   std::shared_ptr<State> sp_state_;
   State* state_;
@@ -173,6 +193,9 @@ class ARROW_EXPORT ThreadPool {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+// Return the process-global thread pool for blocking I/O tasks.
+ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace arrow
 
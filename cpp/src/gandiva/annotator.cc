@@ -55,12 +55,15 @@ FieldDescriptorPtr Annotator::MakeDesc(FieldPtr field) {
 void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
                                        const arrow::ArrayData& array_data,
                                        EvalBatch* eval_batch) {
+  // The buffers of a slice are made to start at its first record.
+  const int64_t offset = array_data.offset;
+  DCHECK_EQ(offset % 8, 0);
   int buffer_idx = 0;
 
   // The validity buffer is optional. Use nullptr if it does not have one.
   if (array_data.buffers[buffer_idx]) {
     uint8_t* validity_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
-    eval_batch->SetBuffer(desc.validity_idx(), validity_buf);
+    eval_batch->SetBuffer(desc.validity_idx(), validity_buf + offset / 8);
   } else {
     eval_batch->SetBuffer(desc.validity_idx(), nullptr);
   }
@@ -68,15 +71,30 @@ void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
 
   if (desc.HasOffsetsIdx()) {
     uint8_t* offsets_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
-    eval_batch->SetBuffer(desc.offsets_idx(), offsets_buf);
+    eval_batch->SetBuffer(desc.offsets_idx(), offsets_buf + offset * sizeof(int32_t));
     ++buffer_idx;
   }
 
+  // The offsets point into the whole data buffer of variable-length arrays.
   uint8_t* data_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
+  if (!desc.HasOffsetsIdx() && offset != 0) {
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*desc.Type());
+    data_buf += offset / 8 * fw_type.bit_width();
+  }
   eval_batch->SetBuffer(desc.data_idx(), data_buf);
   ++buffer_idx;
 }
 
+Status Annotator::ValidateOffsets(const arrow::RecordBatch& record_batch) {
+  for (int i = 0; i < record_batch.num_columns(); ++i) {
+    int64_t offset = record_batch.column(i)->offset();
+    ARROW_RETURN_IF(offset % 8 != 0,
+                    Status::Invalid("Offset of column ", record_batch.column_name(i),
+                                    " must be a multiple of 8, got ", offset));
+  }
+  return Status::OK();
+}
+
 EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                          const ArrayDataVector& out_vector) {
   EvalBatchPtr eval_batch = std::make_shared<EvalBatch>(
@@ -51,6 +51,10 @@ class Annotator {
   EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                 const ArrayDataVector& out_vector);
 
+  /// Check that the offsets of the arrays in the record batch are supported : the
+  /// arrays may be slices, starting at a multiple of 8 records.
+  static Status ValidateOffsets(const arrow::RecordBatch& record_batch);
+
  private:
   /// Annotate a field and return the descriptor.
   FieldDescriptorPtr MakeDesc(FieldPtr field);
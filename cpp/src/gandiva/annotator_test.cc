@@ -99,4 +99,33 @@ TEST_F(TestAnnotator, TestAdd) {
   EXPECT_EQ(bitmaps, nullptr);
 }
 
+TEST_F(TestAnnotator, TestSlice) {
+  Annotator annotator;
+
+  auto field_a = arrow::field("a", arrow::int32());
+  auto in_schema = arrow::schema({field_a});
+  auto field_out = arrow::field("out", arrow::int32());
+  FieldDescriptorPtr desc_a = annotator.CheckAndAddInputFieldDescriptor(field_a);
+  annotator.AddOutputFieldDescriptor(field_out);
+
+  // the buffers of a slice start at its first record.
+  int num_records = 100;
+  auto arrow_v0 = MakeInt32Array(num_records);
+  auto record_batch = arrow::RecordBatch::Make(in_schema, num_records, {arrow_v0});
+  auto slice = record_batch->Slice(16, 64);
+  ASSERT_TRUE(Annotator::ValidateOffsets(*slice).ok());
+
+  auto arrow_out = MakeInt32Array(64);
+  EvalBatchPtr batch = annotator.PrepareEvalBatch(*slice, {arrow_out->data()});
+  EXPECT_EQ(batch->num_records(), 64);
+
+  auto buffers = batch->GetBufferArray();
+  EXPECT_EQ(buffers[desc_a->validity_idx()], arrow_v0->data()->buffers.at(0)->data() + 2);
+  EXPECT_EQ(buffers[desc_a->data_idx()],
+            arrow_v0->data()->buffers.at(1)->data() + 16 * sizeof(int32_t));
+
+  // slices must start at a multiple of 8 records.
+  EXPECT_TRUE(Annotator::ValidateOffsets(*record_batch->Slice(12)).IsInvalid());
+}
+
 }  // namespace gandiva
@@ -0,0 +1,49 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/cache.h"
+
+#include <string>
+
+#include "arrow/util/io-util.h"
+
+namespace gandiva {
+
+static const size_t kDefaultCacheCapacityBytes = 64 * 1024 * 1024;
+
+size_t GetCacheCapacityBytes() {
+  std::string str;
+  if (!arrow::internal::GetEnvVar("GANDIVA_CACHE_CAPACITY_BYTES", &str).ok()) {
+    return kDefaultCacheCapacityBytes;
+  }
+  try {
+    return static_cast<size_t>(std::stoull(str));
+  } catch (...) {
+    return kDefaultCacheCapacityBytes;
+  }
+}
+
+int CompileTimeBucket(int64_t compile_time_ms) {
+  int bucket = 0;
+  while (compile_time_ms > 0 && bucket < kNumCompileTimeBuckets - 1) {
+    compile_time_ms >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+}  // namespace gandiva
@@ -18,34 +18,135 @@
 #ifndef GANDIVA_MODULE_CACHE_H
 #define GANDIVA_MODULE_CACHE_H
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <vector>
 
+#include "gandiva/cache_stats.h"
 #include "gandiva/lru_cache.h"
 
 namespace gandiva {
 
+/// Default capacity of the caches, in bytes of generated code and data. Can be
+/// overridden with the GANDIVA_CACHE_CAPACITY_BYTES environment variable.
+size_t GetCacheCapacityBytes();
+
+constexpr int kNumCompileTimeBuckets = 16;
+
+/// Index of the compile time bucket in CacheStats::compile_time_histogram.
+int CompileTimeBucket(int64_t compile_time_ms);
+
+// Cache of built modules, bounded by the size of their generated code and data.
+// The entries are spread over shards by the hash of their key, each with its own lock,
+// so that concurrent lookups of different keys rarely contend. The capacity bounds the
+// total size of all the shards, so that a single module may use all of it.
 template <class KeyType, typename ValueType>
 class Cache {
  public:
-  explicit Cache(size_t capacity = CACHE_SIZE) : cache_(capacity) {}
-  ValueType GetModule(KeyType cache_key) {
+  explicit Cache(size_t capacity_bytes = GetCacheCapacityBytes())
+      : capacity_bytes_(capacity_bytes),
+        size_bytes_(0),
+        hits_(0),
+        misses_(0),
+        evictions_(0) {
+    for (auto& shard : shards_) {
+      shard.reset(new Shard(capacity_bytes));
+    }
+    for (auto& count : compile_time_histogram_) {
+      count = 0;
+    }
+  }
+
+  ValueType GetModule(const KeyType& cache_key) {
     boost::optional<ValueType> result;
-    mtx_.lock();
-    result = cache_.get(cache_key);
-    mtx_.unlock();
-    return result != boost::none ? *result : nullptr;
+    Shard& shard = ShardFor(cache_key);
+    {
+      std::lock_guard<std::mutex> lock(shard.mtx);
+      result = shard.cache.get(cache_key);
+    }
+    if (result == boost::none) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    return *result;
   }
 
-  void PutModule(KeyType cache_key, ValueType module) {
-    mtx_.lock();
-    cache_.insert(cache_key, module);
-    mtx_.unlock();
+  /// Put a module built in compile_time_ms, with size_bytes of code and data.
+  /// Modules larger than the capacity are not kept.
+  void PutModule(const KeyType& cache_key, ValueType module, size_t size_bytes,
+                 int64_t compile_time_ms) {
+    ++compile_time_histogram_[CompileTimeBucket(compile_time_ms)];
+    size_t weight = std::max<size_t>(size_bytes, 1);
+    const size_t shard_index = ShardIndex(cache_key);
+    {
+      Shard& shard = *shards_[shard_index];
+      std::lock_guard<std::mutex> lock(shard.mtx);
+      const size_t weight_before = shard.cache.weight();
+      evictions_ += shard.cache.insert(cache_key, module, weight);
+      size_bytes_ += static_cast<int64_t>(shard.cache.weight()) -
+                     static_cast<int64_t>(weight_before);
+    }
+
+    // Evict the least recently used modules until all the shards fit, from the shard
+    // of the new module first, but sparing the new module.
+    const int64_t capacity = static_cast<int64_t>(capacity_bytes_);
+    for (size_t i = 0; i < kNumShards && size_bytes_ > capacity; ++i) {
+      Shard& shard = *shards_[(shard_index + i) % kNumShards];
+      const size_t num_kept = i == 0 ? 1 : 0;
+      std::lock_guard<std::mutex> lock(shard.mtx);
+      while (size_bytes_ > capacity && shard.cache.size() > num_kept) {
+        const size_t weight_before = shard.cache.weight();
+        shard.cache.evict_lru();
+        size_bytes_ -= static_cast<int64_t>(weight_before - shard.cache.weight());
+        ++evictions_;
+      }
+    }
+  }
+
+  CacheStats GetStats() {
+    CacheStats stats;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.evictions = evictions_;
+    stats.capacity_bytes = static_cast<int64_t>(capacity_bytes_);
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mtx);
+      stats.num_entries += static_cast<int64_t>(shard->cache.size());
+      stats.size_bytes += static_cast<int64_t>(shard->cache.weight());
+    }
+    for (auto& count : compile_time_histogram_) {
+      stats.compile_time_histogram.push_back(count);
+    }
+    return stats;
   }
 
  private:
-  LruCache<KeyType, ValueType> cache_;
-  static const int CACHE_SIZE = 250;
-  std::mutex mtx_;
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    explicit Shard(size_t capacity_bytes) : cache(capacity_bytes) {}
+
+    std::mutex mtx;
+    LruCache<KeyType, ValueType> cache;
+  };
+
+  size_t ShardIndex(const KeyType& cache_key) { return cache_key.Hash() % kNumShards; }
+
+  Shard& ShardFor(const KeyType& cache_key) { return *shards_[ShardIndex(cache_key)]; }
+
+  size_t capacity_bytes_;
+  // total weight of the shards
+  std::atomic<int64_t> size_bytes_;
+  std::array<std::unique_ptr<Shard>, kNumShards> shards_;
+  std::atomic<int64_t> hits_;
+  std::atomic<int64_t> misses_;
+  std::atomic<int64_t> evictions_;
+  std::array<std::atomic<int64_t>, kNumCompileTimeBuckets> compile_time_histogram_;
 };
 }  // namespace gandiva
 #endif  // GANDIVA_MODULE_CACHE_H
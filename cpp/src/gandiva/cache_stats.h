@@ -0,0 +1,46 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_CACHE_STATS_H
+#define GANDIVA_CACHE_STATS_H
+
+#include <cstdint>
+#include <vector>
+
+namespace gandiva {
+
+/// \brief Statistics of the cache of built projectors or filters.
+struct CacheStats {
+  int64_t hits = 0;
+  int64_t misses = 0;
+  int64_t evictions = 0;
+  int64_t num_entries = 0;
+
+  /// Bytes of generated code and data held by the cached entries, and the
+  /// maximum the cache holds.
+  int64_t size_bytes = 0;
+  int64_t capacity_bytes = 0;
+
+  /// Number of entries built in each range of compile times : the first bucket
+  /// counts the times below 1ms, and bucket i the times in [2^(i-1), 2^i) ms.
+  /// The last bucket also counts all longer times.
+  std::vector<int64_t> compile_time_histogram;
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_CACHE_STATS_H
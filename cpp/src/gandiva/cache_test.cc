@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/cache.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace gandiva {
+
+class TestCacheKey {
+ public:
+  explicit TestCacheKey(int tmp) : tmp_(tmp) {}
+  std::size_t Hash() const { return tmp_; }
+  bool operator==(const TestCacheKey& other) const { return tmp_ == other.tmp_; }
+
+ private:
+  int tmp_;
+};
+
+TEST(TestCache, TestStats) {
+  Cache<TestCacheKey, std::shared_ptr<std::string>> cache(200);
+  auto value = std::make_shared<std::string>("hello");
+
+  ASSERT_EQ(cache.GetModule(TestCacheKey(1)), nullptr);
+  cache.PutModule(TestCacheKey(1), value, 60, 0);
+  ASSERT_EQ(cache.GetModule(TestCacheKey(1)), value);
+  cache.PutModule(TestCacheKey(2), value, 60, 3);
+  cache.PutModule(TestCacheKey(17), value, 60, 100);
+
+  // over the capacity: key 1, the least recently used of another shard, is evicted
+  cache.PutModule(TestCacheKey(3), value, 60, 100);
+  ASSERT_EQ(cache.GetModule(TestCacheKey(1)), nullptr);
+  ASSERT_EQ(cache.GetModule(TestCacheKey(3)), value);
+
+  // larger than the capacity, not kept
+  cache.PutModule(TestCacheKey(4), value, 300, 100000);
+  ASSERT_EQ(cache.GetModule(TestCacheKey(4)), nullptr);
+
+  auto stats = cache.GetStats();
+  EXPECT_EQ(stats.hits, 2);
+  EXPECT_EQ(stats.misses, 3);
+  EXPECT_EQ(stats.evictions, 1);
+  EXPECT_EQ(stats.num_entries, 3);
+  EXPECT_EQ(stats.size_bytes, 180);
+  EXPECT_EQ(stats.capacity_bytes, 200);
+
+  ASSERT_EQ(stats.compile_time_histogram.size(), kNumCompileTimeBuckets);
+  EXPECT_EQ(stats.compile_time_histogram[0], 1);
+  EXPECT_EQ(stats.compile_time_histogram[2], 1);
+  EXPECT_EQ(stats.compile_time_histogram[7], 2);
+  EXPECT_EQ(stats.compile_time_histogram[kNumCompileTimeBuckets - 1], 1);
+}
+
+TEST(TestCache, TestLargeModule) {
+  Cache<TestCacheKey, std::shared_ptr<std::string>> cache(1600);
+  auto value = std::make_shared<std::string>("hello");
+  cache.PutModule(TestCacheKey(1), value, 60, 0);
+  cache.PutModule(TestCacheKey(2), value, 60, 0);
+
+  // larger than a 16th of the capacity, still kept, by evicting the other modules
+  cache.PutModule(TestCacheKey(3), value, 1500, 0);
+  ASSERT_EQ(cache.GetModule(TestCacheKey(3)), value);
+  ASSERT_EQ(cache.GetModule(TestCacheKey(1)), nullptr);
+  ASSERT_EQ(cache.GetModule(TestCacheKey(2)), value);
+
+  // the whole capacity
+  cache.PutModule(TestCacheKey(4), value, 1600, 0);
+  ASSERT_EQ(cache.GetModule(TestCacheKey(4)), value);
+
+  auto stats = cache.GetStats();
+  EXPECT_EQ(stats.num_entries, 1);
+  EXPECT_EQ(stats.size_bytes, 1600);
+  EXPECT_EQ(stats.evictions, 3);
+}
+
+}  // namespace gandiva
@@ -25,12 +25,18 @@ const std::shared_ptr<Configuration> ConfigurationBuilder::default_configuration
     InitDefaultConfig();
 
 std::size_t Configuration::Hash() const {
-  boost::hash<std::string> string_hash;
-  return string_hash(byte_code_file_path_);
+  static constexpr size_t kHashSeed = 0;
+  size_t result = kHashSeed;
+  boost::hash_combine(result, byte_code_file_path_);
+  boost::hash_combine(result, object_cache_dir_);
+  boost::hash_combine(result, enable_profiling_);
+  return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return other.byte_code_file_path() == byte_code_file_path();
+  return other.byte_code_file_path() == byte_code_file_path() &&
+         other.object_cache_dir() == object_cache_dir() &&
+         other.enable_profiling() == enable_profiling();
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
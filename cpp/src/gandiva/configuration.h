@@ -38,15 +38,27 @@ class Configuration {
 
   const std::string& byte_code_file_path() const { return byte_code_file_path_; }
 
+  /// Directory where compiled machine code is cached across processes,
+  /// empty if the persistent cache is disabled.
+  const std::string& object_cache_dir() const { return object_cache_dir_; }
+
+  /// Whether projectors and filters record the batches they evaluate.
+  bool enable_profiling() const { return enable_profiling_; }
+
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
   bool operator!=(const Configuration& other) const;
 
  private:
-  explicit Configuration(const std::string& byte_code_file_path)
-      : byte_code_file_path_(byte_code_file_path) {}
+  Configuration(const std::string& byte_code_file_path,
+                const std::string& object_cache_dir, bool enable_profiling)
+      : byte_code_file_path_(byte_code_file_path),
+        object_cache_dir_(object_cache_dir),
+        enable_profiling_(enable_profiling) {}
 
   const std::string byte_code_file_path_;
+  const std::string object_cache_dir_;
+  const bool enable_profiling_;
 };
 
 /// \brief configuration builder for gandiva
@@ -55,15 +67,33 @@ class Configuration {
 /// to override specific values and build a custom instance
 class ConfigurationBuilder {
  public:
-  ConfigurationBuilder() : byte_code_file_path_(kByteCodeFilePath) {}
+  ConfigurationBuilder()
+      : byte_code_file_path_(kByteCodeFilePath), enable_profiling_(false) {}
 
   ConfigurationBuilder& set_byte_code_file_path(const std::string& byte_code_file_path) {
     byte_code_file_path_ = byte_code_file_path;
     return *this;
   }
 
+  /// Enable the persistent cache of compiled machine code in the given
+  /// directory (created if needed).  Projectors and filters built from the
+  /// same expressions, in this or another process, then skip optimization
+  /// and code generation.
+  ConfigurationBuilder& set_object_cache_dir(const std::string& object_cache_dir) {
+    object_cache_dir_ = object_cache_dir;
+    return *this;
+  }
+
+  /// Record the number of rows and the time of each batch evaluated, reported
+  /// along with the build timings by GetProfile() on projectors and filters.
+  ConfigurationBuilder& set_enable_profiling(bool enable_profiling) {
+    enable_profiling_ = enable_profiling;
+    return *this;
+  }
+
   std::shared_ptr<Configuration> build() {
-    std::shared_ptr<Configuration> configuration(new Configuration(byte_code_file_path_));
+    std::shared_ptr<Configuration> configuration(
+        new Configuration(byte_code_file_path_, object_cache_dir_, enable_profiling_));
     return configuration;
   }
 
@@ -73,9 +103,13 @@ class ConfigurationBuilder {
 
  private:
   std::string byte_code_file_path_;
+  std::string object_cache_dir_;
+  bool enable_profiling_;
 
   static std::shared_ptr<Configuration> InitDefaultConfig() {
-    std::shared_ptr<Configuration> configuration(new Configuration(kByteCodeFilePath));
+    std::shared_ptr<Configuration> configuration(
+        new Configuration(kByteCodeFilePath, "" /*object_cache_dir*/,
+                          false /*enable_profiling*/));
     return configuration;
   }
 
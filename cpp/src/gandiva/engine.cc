@@ -17,7 +17,9 @@
 
 #include "gandiva/engine.h"
 
+#include <chrono>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_set>
@@ -26,12 +28,15 @@
 #include <llvm/Analysis/Passes.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
+#include <llvm/ExecutionEngine/SectionMemoryManager.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Linker/Linker.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Transforms/IPO.h>
@@ -48,8 +53,36 @@ std::once_flag init_once_flag;
 
 bool Engine::init_once_done_ = false;
 std::set<std::string> Engine::loaded_libs_ = {};
+std::map<std::string, std::shared_ptr<llvm::MemoryBuffer>> Engine::byte_code_buffers_;
 std::mutex Engine::mtx_;
 
+namespace {
+
+// Memory manager that counts the bytes of the code and data sections it allocates.
+class SizeCountingMemoryManager : public llvm::SectionMemoryManager {
+ public:
+  explicit SizeCountingMemoryManager(size_t* size) : size_(size) {}
+
+  uint8_t* allocateCodeSection(uintptr_t size, unsigned alignment, unsigned section_id,
+                               llvm::StringRef section_name) override {
+    *size_ += size;
+    return llvm::SectionMemoryManager::allocateCodeSection(size, alignment, section_id,
+                                                           section_name);
+  }
+
+  uint8_t* allocateDataSection(uintptr_t size, unsigned alignment, unsigned section_id,
+                               llvm::StringRef section_name, bool is_read_only) override {
+    *size_ += size;
+    return llvm::SectionMemoryManager::allocateDataSection(
+        size, alignment, section_id, section_name, is_read_only);
+  }
+
+ private:
+  size_t* size_;
+};
+
+}  // namespace
+
 // One-time initializations.
 void Engine::InitOnce() {
   DCHECK_EQ(init_once_done_, false);
@@ -70,6 +103,7 @@ Status Engine::Make(std::shared_ptr<Configuration> config,
   std::unique_ptr<Engine> engine_obj(new Engine());
 
   std::call_once(init_once_flag, [&engine_obj] { engine_obj->InitOnce(); });
+  engine_obj->object_cache_dir_ = config->object_cache_dir();
   engine_obj->context_.reset(new llvm::LLVMContext());
   engine_obj->ir_builder_.reset(new llvm::IRBuilder<>(*(engine_obj->context())));
   engine_obj->types_.reset(new LLVMTypes(*(engine_obj->context())));
@@ -83,6 +117,8 @@ Status Engine::Make(std::shared_ptr<Configuration> config,
   engineBuilder.setEngineKind(llvm::EngineKind::JIT);
   engineBuilder.setOptLevel(llvm::CodeGenOpt::Aggressive);
   engineBuilder.setErrorStr(&(engine_obj->llvm_error_));
+  engineBuilder.setMCJITMemoryManager(std::unique_ptr<llvm::RTDyldMemoryManager>(
+      new SizeCountingMemoryManager(&engine_obj->code_size_)));
   engine_obj->execution_engine_.reset(engineBuilder.create());
   if (engine_obj->execution_engine_ == NULL) {
     engine_obj->module_ = NULL;
@@ -105,19 +141,28 @@ Status Engine::Make(std::shared_ptr<Configuration> config,
 
 // Handling for pre-compiled IR libraries.
 Status Engine::LoadPreCompiledIRFiles(const std::string& byte_code_file_path) {
-  /// Read from file into memory buffer.
-  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer_or_error =
-      llvm::MemoryBuffer::getFile(byte_code_file_path);
-  ARROW_RETURN_IF(
-      !buffer_or_error,
-      Status::CodeGenError("Could not load module from IR ", byte_code_file_path, ": ",
-                           buffer_or_error.getError().message()));
-
-  std::unique_ptr<llvm::MemoryBuffer> buffer = move(buffer_or_error.get());
+  std::shared_ptr<llvm::MemoryBuffer> buffer;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it = byte_code_buffers_.find(byte_code_file_path);
+    if (it != byte_code_buffers_.end()) {
+      buffer = it->second;
+    } else {
+      /// Read from file into memory buffer.
+      llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer_or_error =
+          llvm::MemoryBuffer::getFile(byte_code_file_path);
+      ARROW_RETURN_IF(
+          !buffer_or_error,
+          Status::CodeGenError("Could not load module from IR ", byte_code_file_path,
+                               ": ", buffer_or_error.getError().message()));
+      buffer = std::move(buffer_or_error.get());
+      byte_code_buffers_[byte_code_file_path] = buffer;
+    }
+  }
 
-  /// Parse the IR module.
+  /// Parse the IR module. Function bodies are only read when materialized.
   llvm::Expected<std::unique_ptr<llvm::Module>> module_or_error =
-      llvm::getOwningLazyBitcodeModule(move(buffer), *context());
+      llvm::getLazyBitcodeModule(buffer->getMemBufferRef(), *context());
   if (!module_or_error) {
     std::string error_string;
     llvm::handleAllErrors(module_or_error.takeError(), [&](llvm::ErrorInfoBase& eib) {
@@ -125,13 +170,28 @@ Status Engine::LoadPreCompiledIRFiles(const std::string& byte_code_file_path) {
     });
     return Status::CodeGenError(error_string);
   }
-  std::unique_ptr<llvm::Module> ir_module = move(module_or_error.get());
+  precompiled_module_ = move(module_or_error.get());
 
-  ARROW_RETURN_IF(llvm::verifyModule(*ir_module, &llvm::errs()),
-                  Status::CodeGenError("verify of IR Module failed"));
-  ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, move(ir_module)),
-                  Status::CodeGenError("failed to link IR Modules"));
+  // Declare the functions, so that calls to them can be generated.
+  for (auto& fn : *precompiled_module_) {
+    if (fn.hasLocalLinkage() || module_->getFunction(fn.getName()) != nullptr) {
+      continue;
+    }
+    llvm::Function::Create(fn.getFunctionType(), llvm::GlobalValue::ExternalLinkage,
+                           fn.getName(), module_);
+  }
+  return Status::OK();
+}
 
+Status Engine::LinkPreCompiledFunctions() {
+  // Only the functions declared in the main module are linked, so drop the
+  // unused declarations first.
+  auto status = RemoveUnusedFunctions();
+  ARROW_RETURN_NOT_OK(status);
+
+  ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, move(precompiled_module_),
+                                            llvm::Linker::Flags::LinkOnlyNeeded),
+                  Status::CodeGenError("failed to link IR Modules"));
   return Status::OK();
 }
 
@@ -159,16 +219,40 @@ Status Engine::RemoveUnusedFunctions() {
   return Status::OK();
 }
 
+std::string Engine::ObjectCacheKey(bool optimise_ir) {
+  std::string key;
+  llvm::raw_string_ostream stream(key);
+  stream << "LLVM " << LLVM_VERSION_STRING << ", target " << llvm::sys::getProcessTriple()
+         << " (" << llvm::sys::getHostCPUName() << ")"
+         << (optimise_ir ? ", optimised" : "") << "\n";
+  module_->print(stream, nullptr);
+  return stream.str();
+}
+
 // Optimise and compile the module.
 Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
-  auto status = RemoveUnusedFunctions();
+  auto start_time = std::chrono::steady_clock::now();
+  auto status = LinkPreCompiledFunctions();
   ARROW_RETURN_NOT_OK(status);
 
+  status = RemoveUnusedFunctions();
+  ARROW_RETURN_NOT_OK(status);
+  link_ns_ = NanosSince(start_time);
+
   if (dump_ir) {
     DumpIR("Before optimise");
   }
 
-  if (optimise_ir) {
+  if (!object_cache_dir_.empty()) {
+    // The JIT gets the machine code from the cache if it is there, or else
+    // stores the code it generates
+    object_cache_.reset(new ObjectCache(object_cache_dir_, ObjectCacheKey(optimise_ir)));
+    loaded_from_object_cache_ = object_cache_->Load();
+    execution_engine_->setObjectCache(object_cache_.get());
+  }
+
+  if (optimise_ir && !loaded_from_object_cache_) {
+    start_time = std::chrono::steady_clock::now();
     // misc passes to allow for inlining, vectorization, ..
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
@@ -191,6 +275,7 @@ Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
     pass_builder.OptLevel = 3;
     pass_builder.populateModulePassManager(*pass_manager);
     pass_manager->run(*module_);
+    optimization_ns_ = NanosSince(start_time);
 
     if (dump_ir) {
       DumpIR("After optimise");
@@ -201,12 +286,24 @@ Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
                   Status::CodeGenError("Module verification failed after optimizer"));
 
   // do the compilation
+  start_time = std::chrono::steady_clock::now();
   execution_engine_->finalizeObject();
+  code_emission_ns_ = NanosSince(start_time);
   module_finalized_ = true;
 
   return Status::OK();
 }
 
+BuildProfile Engine::build_profile() const {
+  BuildProfile profile;
+  profile.link_ns = link_ns_;
+  profile.optimization_ns = optimization_ns_;
+  profile.code_emission_ns = code_emission_ns_;
+  profile.code_size = static_cast<int64_t>(code_size_);
+  profile.loaded_from_object_cache = loaded_from_object_cache_;
+  return profile;
+}
+
 void* Engine::CompiledFunction(llvm::Function* irFunction) {
   DCHECK(module_finalized_);
   return execution_engine_->getPointerToFunction(irFunction);
@@ -221,6 +318,17 @@ void Engine::AddGlobalMappingForFunc(const std::string& name, llvm::Type* ret_ty
   execution_engine_->addGlobalMapping(fn, function_ptr);
 }
 
+llvm::Constant* Engine::ProcessAddressConstant(const void* address, llvm::Type* type) {
+  // Declared as an array of unknown size, so that accesses past the address
+  // aren't assumed out of bounds
+  auto global = new llvm::GlobalVariable(
+      *module_, llvm::ArrayType::get(types_->i8_type(), 0), false /*isConstant*/,
+      llvm::GlobalValue::ExternalLinkage, nullptr,
+      "gdv_process_address_" + std::to_string(num_process_addresses_++));
+  execution_engine_->addGlobalMapping(global, const_cast<void*>(address));
+  return llvm::ConstantExpr::getPointerCast(global, type);
+}
+
 void Engine::AddGlobalMappings() { ExportedFuncsRegistry::AddMappings(this); }
 
 void Engine::DumpIR(std::string prefix) {
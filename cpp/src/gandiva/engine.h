@@ -18,6 +18,7 @@
 #ifndef GANDIVA_ENGINE_H
 #define GANDIVA_ENGINE_H
 
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -34,6 +35,8 @@
 #include "gandiva/configuration.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/logging.h"
+#include "gandiva/object_cache.h"
+#include "gandiva/profile.h"
 
 namespace gandiva {
 
@@ -71,10 +74,26 @@ class Engine {
   void AddGlobalMappingForFunc(const std::string& name, llvm::Type* ret_type,
                                const std::vector<llvm::Type*>& args, void* func);
 
+  /// Return a constant of the given pointer or integer type for an address
+  /// in this process (e.g. a function holder).  The address is bound through
+  /// an external symbol when the code is loaded, so that the compiled code
+  /// doesn't depend on it and can be reused by other processes.
+  llvm::Constant* ProcessAddressConstant(const void* address, llvm::Type* type);
+
+  /// Whether the machine code was loaded from the persistent object cache.
+  bool loaded_from_object_cache() const { return loaded_from_object_cache_; }
+
+  /// Bytes of machine code and data loaded for the module, once finalized.
+  size_t code_size() const { return code_size_; }
+
+  /// Time spent in each phase of FinalizeModule, along with the code size.
+  /// The IR generation time is left to the caller.
+  BuildProfile build_profile() const;
+
  private:
   /// private constructor to ensure engine is created
   /// only through the factory.
-  Engine() : module_finalized_(false) {}
+  Engine() : module_finalized_(false), loaded_from_object_cache_(false) {}
 
   /// do one time inits.
   static void InitOnce();
@@ -82,9 +101,14 @@ class Engine {
 
   llvm::ExecutionEngine& execution_engine() { return *execution_engine_.get(); }
 
-  /// load pre-compiled IR modules and merge them into the main module.
+  /// load pre-compiled IR modules lazily, and declare their functions in the
+  /// main module.
   Status LoadPreCompiledIRFiles(const std::string& byte_code_file_path);
 
+  /// link the pre-compiled functions called from the main module, along with
+  /// their callees.  Only these are read from the bitcode.
+  Status LinkPreCompiledFunctions();
+
   // Create and add mappings for cpp functions that can be accessed from LLVM.
   void AddGlobalMappings();
 
@@ -94,7 +118,16 @@ class Engine {
   /// dump the IR code to stdout with the prefix string.
   void DumpIR(std::string prefix);
 
+  // Key of the module in the persistent object cache: the IR to compile,
+  // along with the LLVM version and target.
+  std::string ObjectCacheKey(bool optimise_ir);
+
+  // Must outlive the execution engine
+  std::unique_ptr<ObjectCache> object_cache_;
+
   std::unique_ptr<llvm::LLVMContext> context_;
+  // Pre-compiled functions, materialized from the bitcode when linked
+  std::unique_ptr<llvm::Module> precompiled_module_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
   std::unique_ptr<LLVMTypes> types_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
@@ -103,10 +136,20 @@ class Engine {
 
   std::vector<std::string> functions_to_compile_;
 
+  std::string object_cache_dir_;
+  int num_process_addresses_ = 0;
+  size_t code_size_ = 0;
+  int64_t link_ns_ = 0;
+  int64_t optimization_ns_ = 0;
+  int64_t code_emission_ns_ = 0;
+
   bool module_finalized_;
+  bool loaded_from_object_cache_;
   std::string llvm_error_;
 
   static std::set<std::string> loaded_libs_;
+  // Contents of the pre-compiled IR files, shared by all engines
+  static std::map<std::string, std::shared_ptr<llvm::MemoryBuffer>> byte_code_buffers_;
   static std::mutex mtx_;
 };
 
@@ -18,6 +18,7 @@
 #include "gandiva/engine.h"
 
 #include <gtest/gtest.h>
+#include <llvm/Support/FileSystem.h>
 #include "gandiva/llvm_types.h"
 #include "gandiva/tests/test_util.h"
 
@@ -130,6 +131,35 @@ TEST_F(TestEngine, TestAddOptimised) {
   EXPECT_EQ(add_func(my_array, 5), 17);
 }
 
+TEST_F(TestEngine, TestObjectCache) {
+  llvm::SmallString<128> cache_dir;
+  ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("gandiva-object-cache", cache_dir));
+  auto config = ConfigurationBuilder()
+                    .set_byte_code_file_path(GANDIVA_BYTE_COMPILE_FILE_PATH)
+                    .set_object_cache_dir(cache_dir.str().str())
+                    .build();
+
+  int64_t my_array[] = {1, 3, -5, 8, 10};
+  // The first engine compiles the module and stores the code, the second one
+  // loads it from the cache
+  for (bool expect_cached : {false, true}) {
+    std::unique_ptr<Engine> engine;
+    auto status = Engine::Make(config, &engine);
+    EXPECT_TRUE(status.ok()) << status.message();
+    LLVMTypes types(*engine->context());
+    llvm::Function* ir_func = BuildVecAdd(engine.get(), &types);
+    status = engine->FinalizeModule(true, false);
+    EXPECT_TRUE(status.ok()) << status.message();
+    EXPECT_EQ(engine->loaded_from_object_cache(), expect_cached);
+
+    add_vector_func_t add_func =
+        reinterpret_cast<add_vector_func_t>(engine->CompiledFunction(ir_func));
+    EXPECT_EQ(add_func(my_array, 5), 17);
+  }
+
+  llvm::sys::fs::remove_directories(cache_dir);
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
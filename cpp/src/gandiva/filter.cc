@@ -17,10 +17,14 @@
 
 #include "gandiva/filter.h"
 
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "arrow/table.h"
+
+#include "gandiva/annotator.h"
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/cache.h"
 #include "gandiva/condition.h"
@@ -31,11 +35,19 @@
 
 namespace gandiva {
 
-Filter::Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
-               std::shared_ptr<Configuration> configuration)
+using FilterCache = Cache<FilterCacheKey, std::shared_ptr<Filter>>;
+
+static FilterCache& GetFilterCache() {
+  static FilterCache cache;
+  return cache;
+}
+
+Filter::Filter(std::shared_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+               std::shared_ptr<Configuration> configuration, bool from_cache)
     : llvm_generator_(std::move(llvm_generator)),
       schema_(schema),
-      configuration_(configuration) {}
+      configuration_(configuration),
+      from_cache_(from_cache) {}
 
 Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
                     std::shared_ptr<Configuration> configuration,
@@ -45,15 +57,18 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
   ARROW_RETURN_IF(configuration == nullptr,
                   Status::Invalid("Configuration cannot be null"));
 
-  static Cache<FilterCacheKey, std::shared_ptr<Filter>> cache;
+  FilterCache& cache = GetFilterCache();
   FilterCacheKey cache_key(schema, configuration, *(condition.get()));
   auto cachedFilter = cache.GetModule(cache_key);
   if (cachedFilter != nullptr) {
-    *filter = cachedFilter;
+    // share the module, but not the evaluation counters
+    *filter = std::make_shared<Filter>(cachedFilter->llvm_generator_, schema,
+                                       configuration, true);
     return Status::OK();
   }
 
   // Build LLVM generator, and generate code for the specified expression
+  auto start_time = std::chrono::steady_clock::now();
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
 
@@ -62,14 +77,27 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
   ExprValidator expr_validator(llvm_gen->types(), schema);
   ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
   ARROW_RETURN_NOT_OK(llvm_gen->Build({condition}));
+  auto compile_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start_time);
+  size_t code_size = llvm_gen->code_size();
 
   // Instantiate the filter with the completely built llvm generator
   *filter = std::make_shared<Filter>(std::move(llvm_gen), schema, configuration);
-  cache.PutModule(cache_key, *filter);
+  cache.PutModule(cache_key, *filter, code_size, compile_time.count());
 
   return Status::OK();
 }
 
+CacheStats Filter::GetCacheStats() { return GetFilterCache().GetStats(); }
+
+Profile Filter::GetProfile() const {
+  Profile profile;
+  profile.build = llvm_generator_->build_profile();
+  profile.build.from_cache = from_cache_;
+  profile.evaluation = evaluation_counters_.ToProfile();
+  return profile;
+}
+
 Status Filter::Evaluate(const arrow::RecordBatch& batch,
                         std::shared_ptr<SelectionVector> out_selection) {
   const auto num_rows = batch.num_rows();
@@ -80,6 +108,7 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
                   Status::Invalid("out_selection must be non-null."));
   ARROW_RETURN_IF(out_selection->GetMaxSlots() < num_rows,
                   Status::Invalid("Output selection vector capacity too small"));
+  ARROW_RETURN_NOT_OK(Annotator::ValidateOffsets(batch));
 
   // Allocate three local_bitmaps (one for output, one for validity, one to compute the
   // intersection).
@@ -91,7 +120,8 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  ARROW_RETURN_NOT_OK(
+      llvm_generator_->Execute(batch, nullptr, {array_data}, &evaluation_counters_));
 
   // Compute the intersection of the value and validity.
   auto result = bitmaps.GetLocalBitMap(2);
@@ -101,4 +131,46 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   return out_selection->PopulateFromBitMap(result, bitmap_size, num_rows - 1);
 }
 
+Status Filter::Evaluate(const arrow::Table& table, arrow::MemoryPool* pool,
+                        std::shared_ptr<arrow::ChunkedArray>* out_indices,
+                        int64_t morsel_size) {
+  ARROW_RETURN_IF(!table.schema()->Equals(*schema_),
+                  Status::Invalid("Table schema must match filter schema"));
+  ARROW_RETURN_IF(out_indices == nullptr,
+                  Status::Invalid("out_indices must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  std::vector<std::shared_ptr<arrow::RecordBatch>> morsels;
+  ARROW_RETURN_NOT_OK(MakeMorsels(table, morsel_size, pool, &morsels));
+
+  // Offset of each morsel in the table.
+  std::vector<int64_t> morsel_offsets;
+  int64_t offset = 0;
+  for (const auto& morsel : morsels) {
+    morsel_offsets.push_back(offset);
+    offset += morsel->num_rows();
+  }
+
+  arrow::ArrayVector chunks(morsels.size());
+  ARROW_RETURN_NOT_OK(ParallelForMorsels(
+      static_cast<int64_t>(morsels.size()), [&](int64_t morsel_index) {
+        const auto& morsel = morsels[morsel_index];
+        std::shared_ptr<SelectionVector> selection;
+        ARROW_RETURN_NOT_OK(
+            SelectionVector::MakeInt64(morsel->num_rows(), pool, &selection));
+        ARROW_RETURN_NOT_OK(Evaluate(*morsel, selection));
+
+        // Make the indices relative to the table.
+        const uint64_t morsel_offset = morsel_offsets[morsel_index];
+        for (int64_t i = 0; i < selection->GetNumSlots(); ++i) {
+          selection->SetIndex(i, selection->GetIndex(i) + morsel_offset);
+        }
+        chunks[morsel_index] = selection->ToArray();
+        return Status::OK();
+      }));
+
+  *out_indices = std::make_shared<arrow::ChunkedArray>(chunks, arrow::uint64());
+  return Status::OK();
+}
+
 }  // namespace gandiva
@@ -26,8 +26,11 @@
 #include "arrow/status.h"
 
 #include "gandiva/arrow.h"
+#include "gandiva/cache_stats.h"
 #include "gandiva/condition.h"
 #include "gandiva/configuration.h"
+#include "gandiva/morsels.h"
+#include "gandiva/profile.h"
 #include "gandiva/selection_vector.h"
 
 namespace gandiva {
@@ -40,8 +43,8 @@ class LLVMGenerator;
 /// can be used to evaluate many row batches.
 class Filter {
  public:
-  Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
-         std::shared_ptr<Configuration> config);
+  Filter(std::shared_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+         std::shared_ptr<Configuration> config, bool from_cache = false);
 
   ~Filter() = default;
 
@@ -74,10 +77,34 @@ class Filter {
   Status Evaluate(const arrow::RecordBatch& batch,
                   std::shared_ptr<SelectionVector> out_selection);
 
+  /// Evaluate the specified table, and return the indices of the rows that match the
+  /// condition. The table is split in morsels of 'morsel_size' records, evaluated in
+  /// parallel on the CPU thread pool.
+  ///
+  /// \param[in] table the table. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate the indices.
+  /// \param[out] out_indices uint64 indices of the matching rows in the table, in
+  ///             increasing order.
+  /// \param[in] morsel_size number of records in a morsel.
+  Status Evaluate(const arrow::Table& table, arrow::MemoryPool* pool,
+                  std::shared_ptr<arrow::ChunkedArray>* out_indices,
+                  int64_t morsel_size = kDefaultMorselSize);
+
+  /// Statistics of the cache of built filters, shared by all threads.
+  static CacheStats GetCacheStats();
+
+  /// Timings of the build of this filter, and of the batches it evaluated if
+  /// profiling is enabled in its configuration. Each filter returned by Make() has
+  /// its own evaluation counters, even when it shares the cached module of an equal
+  /// filter.
+  Profile GetProfile() const;
+
  private:
-  const std::unique_ptr<LLVMGenerator> llvm_generator_;
+  const std::shared_ptr<LLVMGenerator> llvm_generator_;
   const SchemaPtr schema_;
   const std::shared_ptr<Configuration> configuration_;
+  const bool from_cache_;
+  EvaluationCounters evaluation_counters_;
 };
 
 }  // namespace gandiva
@@ -22,6 +22,8 @@
 #include <string>
 #include <unordered_set>
 
+#include "arrow/util/hashing.h"
+#include "arrow/util/string_view.h"
 #include "gandiva/arrow.h"
 #include "gandiva/gandiva_aliases.h"
 
@@ -44,6 +46,34 @@ class InHolder {
   std::unordered_set<Type> values_;
 };
 
+/// IN expressions on strings look up views of the data, so that they don't copy it.
+template <>
+class InHolder<std::string> {
+ public:
+  explicit InHolder(const std::unordered_set<std::string>& values) : values_(values) {
+    value_views_.max_load_factor(0.25f);
+    for (auto& value : values_) {
+      value_views_.insert(arrow::util::string_view(value));
+    }
+  }
+
+  bool HasValue(arrow::util::string_view value) const {
+    return value_views_.count(value) == 1;
+  }
+
+ private:
+  struct StringViewHash {
+    size_t operator()(arrow::util::string_view value) const {
+      return static_cast<size_t>(arrow::internal::ComputeStringHash<0>(
+          value.data(), static_cast<int64_t>(value.size())));
+    }
+  };
+
+  // owns the strings, whose views are looked up
+  std::unordered_set<std::string> values_;
+  std::unordered_set<arrow::util::string_view, StringViewHash> value_views_;
+};
+
 }  // namespace gandiva
 
 #endif  // GANDIVA_IN_HOLDER_H
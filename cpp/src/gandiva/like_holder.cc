@@ -17,6 +17,7 @@
 
 #include "gandiva/like_holder.h"
 
+#include <cstring>
 #include <regex>
 #include "gandiva/node.h"
 #include "gandiva/regex_util.h"
@@ -81,7 +82,10 @@ Status LikeHolder::Make(const std::string& sql_pattern,
   std::string pcre_pattern;
   ARROW_RETURN_NOT_OK(RegexUtil::SqlLikePatternToPcre(sql_pattern, pcre_pattern));
 
-  auto lholder = std::shared_ptr<LikeHolder>(new LikeHolder(pcre_pattern));
+  std::string literal;
+  auto match_kind = GetMatchKind(sql_pattern, &literal);
+  auto lholder =
+      std::shared_ptr<LikeHolder>(new LikeHolder(pcre_pattern, match_kind, literal));
   ARROW_RETURN_IF(!lholder->regex_.ok(),
                   Status::Invalid("Building RE2 pattern '", pcre_pattern, "' failed"));
 
@@ -89,4 +93,71 @@ Status LikeHolder::Make(const std::string& sql_pattern,
   return Status::OK();
 }
 
+LikeHolder::MatchKind LikeHolder::GetMatchKind(const std::string& sql_pattern,
+                                               std::string* literal) {
+  auto begin = sql_pattern.find_first_not_of('%');
+  if (begin == std::string::npos) {
+    // only wildcards, or empty
+    return sql_pattern.empty() ? MatchKind::kExact : MatchKind::kAny;
+  }
+  auto end = sql_pattern.find_last_not_of('%') + 1;
+  *literal = sql_pattern.substr(begin, end - begin);
+  if (literal->find_first_of("%_") != std::string::npos) {
+    literal->clear();
+    return MatchKind::kRegex;
+  }
+
+  bool any_before = begin > 0;
+  bool any_after = end < sql_pattern.length();
+  if (any_before && any_after) {
+    return MatchKind::kInfix;
+  } else if (any_before) {
+    return MatchKind::kSuffix;
+  } else if (any_after) {
+    return MatchKind::kPrefix;
+  }
+  return MatchKind::kExact;
+}
+
+// Look for the needle at each occurrence of its first byte, found with memchr.
+static bool ContainsBytes(const char* data, int32_t data_len, const std::string& needle) {
+  auto needle_len = static_cast<int32_t>(needle.length());
+  if (needle_len > data_len) {
+    return false;
+  }
+  const char* last = data + data_len - needle_len;
+  const char* pos = data;
+  while (pos <= last) {
+    pos = static_cast<const char*>(memchr(pos, needle[0], last - pos + 1));
+    if (pos == nullptr) {
+      return false;
+    }
+    if (memcmp(pos + 1, needle.data() + 1, needle_len - 1) == 0) {
+      return true;
+    }
+    ++pos;
+  }
+  return false;
+}
+
+bool LikeHolder::operator()(const char* data, int32_t data_len) {
+  auto literal_len = static_cast<int32_t>(literal_.length());
+  switch (match_kind_) {
+    case MatchKind::kAny:
+      return true;
+    case MatchKind::kExact:
+      return data_len == literal_len && memcmp(data, literal_.data(), data_len) == 0;
+    case MatchKind::kPrefix:
+      return data_len >= literal_len && memcmp(data, literal_.data(), literal_len) == 0;
+    case MatchKind::kSuffix:
+      return data_len >= literal_len &&
+             memcmp(data + data_len - literal_len, literal_.data(), literal_len) == 0;
+    case MatchKind::kInfix:
+      return ContainsBytes(data, data_len, literal_);
+    case MatchKind::kRegex:
+      break;
+  }
+  return RE2::FullMatch(re2::StringPiece(data, data_len), regex_);
+}
+
 }  // namespace gandiva
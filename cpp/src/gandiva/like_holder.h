@@ -18,6 +18,7 @@
 #ifndef GANDIVA_LIKE_HOLDER_H
 #define GANDIVA_LIKE_HOLDER_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -41,13 +42,26 @@ class LikeHolder : public FunctionHolder {
   static const FunctionNode TryOptimize(const FunctionNode& node);
 
   /// Return true if the data matches the pattern.
-  bool operator()(const std::string& data) { return RE2::FullMatch(data, regex_); }
+  bool operator()(const char* data, int32_t data_len);
+
+  bool operator()(const std::string& data) {
+    return (*this)(data.data(), static_cast<int32_t>(data.size()));
+  }
 
  private:
-  explicit LikeHolder(const std::string& pattern) : pattern_(pattern), regex_(pattern) {}
+  // How the data is matched : patterns made of a literal, with '%' wildcards only at
+  // its ends, are matched by comparing bytes instead of running the regex.
+  enum class MatchKind { kRegex, kAny, kExact, kPrefix, kSuffix, kInfix };
+
+  LikeHolder(const std::string& pattern, MatchKind match_kind, const std::string& literal)
+      : pattern_(pattern), regex_(pattern), match_kind_(match_kind), literal_(literal) {}
+
+  static MatchKind GetMatchKind(const std::string& sql_pattern, std::string* literal);
 
   std::string pattern_;  // posix pattern string, to help debugging
   RE2 regex_;            // compiled regex for the pattern
+  MatchKind match_kind_;
+  std::string literal_;  // literal part of the pattern, unless matched with the regex
 
   static RE2 starts_with_regex_;  // pre-compiled pattern for matching starts_with
   static RE2 ends_with_regex_;    // pre-compiled pattern for matching ends_with
@@ -76,6 +76,42 @@ TEST_F(TestLikeHolder, TestPcreSpecial) {
   EXPECT_FALSE(like("xxabc"));
 }
 
+TEST_F(TestLikeHolder, TestLiteralPatterns) {
+  // patterns matched without the regex
+  std::shared_ptr<LikeHolder> like_holder;
+
+  ASSERT_TRUE(LikeHolder::Make("a.c", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("a.c"));
+  EXPECT_FALSE((*like_holder)("abc"));
+  EXPECT_FALSE((*like_holder)("a.cd"));
+
+  ASSERT_TRUE(LikeHolder::Make("a(c%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("a(c"));
+  EXPECT_TRUE((*like_holder)("a(cde"));
+  EXPECT_FALSE((*like_holder)("a("));
+
+  ASSERT_TRUE(LikeHolder::Make("%a*c", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("xya*c"));
+  EXPECT_FALSE((*like_holder)("xya*cd"));
+  EXPECT_FALSE((*like_holder)("*c"));
+
+  ASSERT_TRUE(LikeHolder::Make("%%ab?%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("ab?"));
+  EXPECT_TRUE((*like_holder)("aaab?b"));
+  EXPECT_FALSE((*like_holder)("aab"));
+  EXPECT_FALSE((*like_holder)("ab"));
+  // only the given length of the data is matched
+  EXPECT_FALSE((*like_holder)("xxab?", 4));
+
+  ASSERT_TRUE(LikeHolder::Make("%%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)(""));
+  EXPECT_TRUE((*like_holder)("abc"));
+
+  ASSERT_TRUE(LikeHolder::Make("", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)(""));
+  EXPECT_FALSE((*like_holder)("a"));
+}
+
 TEST_F(TestLikeHolder, TestRegexEscape) {
   std::string res;
   auto status = RegexUtil::SqlLikePatternToPcre("#%hello#_abc_def##", '#', res);
@@ -17,6 +17,8 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <chrono>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -29,6 +31,7 @@
 #include "gandiva/expr_decomposer.h"
 #include "gandiva/expression.h"
 #include "gandiva/function_registry.h"
+#include "gandiva/local_bitmaps_holder.h"
 #include "gandiva/lvalue.h"
 
 namespace gandiva {
@@ -39,13 +42,19 @@ namespace gandiva {
   }
 
 LLVMGenerator::LLVMGenerator()
-    : dump_ir_(false), optimise_ir_(true), enable_ir_traces_(false) {}
+    : selection_vector_mode_(SelectionVector::MODE_NONE),
+      enable_profiling_(false),
+      ir_generation_ns_(0),
+      dump_ir_(false),
+      optimise_ir_(true),
+      enable_ir_traces_(false) {}
 
 Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
                            std::unique_ptr<LLVMGenerator>* llvm_generator) {
   std::unique_ptr<LLVMGenerator> llvmgen_obj(new LLVMGenerator());
 
   ARROW_RETURN_NOT_OK(Engine::Make(config, &(llvmgen_obj->engine_)));
+  llvmgen_obj->enable_profiling_ = config->enable_profiling();
   *llvm_generator = std::move(llvmgen_obj);
 
   return Status::OK();
@@ -72,11 +81,15 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
 }
 
 /// Build and optimise module for projection expression.
-Status LLVMGenerator::Build(const ExpressionVector& exprs) {
+Status LLVMGenerator::Build(const ExpressionVector& exprs,
+                            SelectionVector::Mode selection_vector_mode) {
+  selection_vector_mode_ = selection_vector_mode;
+  auto start_time = std::chrono::steady_clock::now();
   for (auto& expr : exprs) {
     auto output = annotator_.AddOutputFieldDescriptor(expr->result());
     ARROW_RETURN_NOT_OK(Add(expr, output));
   }
+  ir_generation_ns_ = NanosSince(start_time);
 
   // Optimize, compile and finalize the module
   ARROW_RETURN_NOT_OK(engine_->FinalizeModule(optimise_ir_, dump_ir_));
@@ -88,13 +101,46 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs) {
     compiled_expr->set_jit_function(fn);
   }
 
+  if (dump_ir_) {
+    Profile profile;
+    profile.build = build_profile();
+    std::cout << profile.ToString();
+  }
   return Status::OK();
 }
 
+BuildProfile LLVMGenerator::build_profile() const {
+  BuildProfile profile = engine_->build_profile();
+  profile.ir_generation_ns = ir_generation_ns_;
+  return profile;
+}
+
 /// Execute the compiled module against the provided vectors.
 Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) {
+  return Execute(record_batch, nullptr, output_vector);
+}
+
+Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
+                              const SelectionVector* selection_vector,
+                              const ArrayDataVector& output_vector,
+                              EvaluationCounters* counters) {
   DCHECK_GT(record_batch.num_rows(), 0);
+  DCHECK_EQ(selection_vector == nullptr,
+            selection_vector_mode_ == SelectionVector::MODE_NONE);
+  const bool profile = enable_profiling_ && counters != nullptr;
+  std::chrono::steady_clock::time_point start_time;
+  if (profile) {
+    start_time = std::chrono::steady_clock::now();
+  }
+
+  const uint8_t* selection_buffer = nullptr;
+  int64_t num_output_rows = record_batch.num_rows();
+  if (selection_vector != nullptr) {
+    DCHECK_EQ(selection_vector->GetMode(), selection_vector_mode_);
+    selection_buffer = selection_vector->GetBuffer()->data();
+    num_output_rows = selection_vector->GetNumSlots();
+  }
 
   auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
   DCHECK_GT(eval_batch->GetNumBuffers(), 0);
@@ -103,16 +149,20 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
     // generate data/offset vectors.
     EvalFunc jit_function = compiled_expr->jit_function();
     jit_function(eval_batch->GetBufferArray(), eval_batch->GetLocalBitMapArray(),
-                 (int64_t)eval_batch->GetExecutionContext(), record_batch.num_rows());
+                 selection_buffer, (int64_t)eval_batch->GetExecutionContext(),
+                 num_output_rows);
 
     ARROW_RETURN_IF(
         eval_batch->GetExecutionContext()->has_error(),
         Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
 
     // generate validity vectors.
-    ComputeBitMapsForExpr(*compiled_expr, *eval_batch);
+    ComputeBitMapsForExpr(*compiled_expr, *eval_batch, selection_vector);
   }
 
+  if (profile) {
+    counters->Add(num_output_rows, NanosSince(start_time));
+  }
   return Status::OK();
 }
 
@@ -163,13 +213,37 @@ llvm::Value* LLVMGenerator::GetLocalBitMapReference(llvm::Value* arg_bitmaps, in
                                       std::to_string(idx) + "_lbmap");
 }
 
+/// Get the position of the record in the selection vector, at index loop_var.
+llvm::Value* LLVMGenerator::GetSelectedPosition(llvm::Value* arg_selection_vector,
+                                                llvm::Value* loop_var) {
+  llvm::IRBuilder<>* builder = ir_builder();
+  llvm::Type* index_type;
+  switch (selection_vector_mode_) {
+    case SelectionVector::MODE_UINT16:
+      index_type = types()->i16_type();
+      break;
+    case SelectionVector::MODE_UINT32:
+      index_type = types()->i32_type();
+      break;
+    default:
+      DCHECK_EQ(selection_vector_mode_, SelectionVector::MODE_UINT64);
+      index_type = types()->i64_type();
+      break;
+  }
+  llvm::Value* indices = builder->CreateBitCast(
+      arg_selection_vector, types()->ptr_type(index_type), "selection_indices");
+  llvm::Value* slot = builder->CreateGEP(indices, loop_var);
+  llvm::Value* index = builder->CreateLoad(slot, "selection_index");
+  return builder->CreateZExtOrBitCast(index, types()->i64_type(), "position");
+}
+
 /// \brief Generate code for one expression.
 
 // Sample IR code for "c1:int + c2:int"
 //
 // The C-code equivalent is :
 // ------------------------------
-// int expr_0(int64_t *addrs, int64_t *local_bitmaps,
+// int expr_0(int64_t *addrs, int64_t *local_bitmaps, uint8_t *selection_vector,
 //            int64_t execution_context_ptr, int64_t nrecords) {
 //   int *outVec = (int *) addrs[5];
 //   int *c0Vec = (int *) addrs[1];
@@ -185,8 +259,8 @@ llvm::Value* LLVMGenerator::GetLocalBitMapReference(llvm::Value* arg_bitmaps, in
 // IR Code
 // --------
 //
-// define i32 @expr_0(i64* %args, i64* %local_bitmaps, i64 %execution_context_ptr, , i64
-// %nrecords) { entry:
+// define i32 @expr_0(i64* %args, i64* %local_bitmaps, i8* %selection_vector,
+// i64 %execution_context_ptr, i64 %nrecords) { entry:
 //   %outmemAddr = getelementptr i64, i64* %args, i32 5
 //   %outmem = load i64, i64* %outmemAddr
 //   %outVec = inttoptr i64 %outmem to i32*
@@ -212,16 +286,22 @@ llvm::Value* LLVMGenerator::GetLocalBitMapReference(llvm::Value* arg_bitmaps, in
 // exit:                                             ; preds = %loop
 //   ret i32 0
 // }
+//
+// With a selection vector, the inputs are read at the position in the selection
+// vector (selection_vector[loop_var]) instead of at loop_var, and the outputs are
+// still written at loop_var.
 
 Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr output,
                                        int suffix_idx, llvm::Function** fn) {
   llvm::IRBuilder<>* builder = ir_builder();
 
   // Create fn prototype :
-  //   int expr_1 (long **addrs, long **bitmaps, long *context_ptr, long nrec)
+  //   int expr_1 (long **addrs, long **bitmaps, char *selection_vector,
+  //               long *context_ptr, long nrec)
   std::vector<llvm::Type*> arguments;
   arguments.push_back(types()->i64_ptr_type());
   arguments.push_back(types()->i64_ptr_type());
+  arguments.push_back(types()->i8_ptr_type());
   arguments.push_back(types()->i64_type());
   arguments.push_back(types()->i64_type());
   llvm::FunctionType* prototype =
@@ -242,6 +322,9 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr out
   llvm::Value* arg_local_bitmaps = &*args;
   arg_local_bitmaps->setName("local_bitmaps");
   ++args;
+  llvm::Value* arg_selection_vector = &*args;
+  arg_selection_vector->setName("selection_vector");
+  ++args;
   llvm::Value* arg_context_ptr = &*args;
   arg_context_ptr->setName("context_ptr");
   ++args;
@@ -263,9 +346,15 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr out
   // define loop_var : start with 0, +1 after each iter
   llvm::PHINode* loop_var = builder->CreatePHI(types()->i64_type(), 2, "loop_var");
 
+  // position of the record in the input vectors.
+  llvm::Value* position_var = loop_var;
+  if (selection_vector_mode_ != SelectionVector::MODE_NONE) {
+    position_var = GetSelectedPosition(arg_selection_vector, loop_var);
+  }
+
   // The visitor can add code to both the entry/loop blocks.
   Visitor visitor(this, *fn, loop_entry, arg_addrs, arg_local_bitmaps, arg_context_ptr,
-                  loop_var);
+                  position_var);
   value_expr->Accept(visitor);
   LValuePtr output_value = visitor.result();
 
@@ -356,7 +445,8 @@ void LLVMGenerator::ClearPackedBitValueIfFalse(llvm::Value* bitmap, llvm::Value*
 
 /// Extract the bitmap addresses, and do an intersection.
 void LLVMGenerator::ComputeBitMapsForExpr(const CompiledExpr& compiled_expr,
-                                          const EvalBatch& eval_batch) {
+                                          const EvalBatch& eval_batch,
+                                          const SelectionVector* selection_vector) {
   auto validities = compiled_expr.value_validity()->validity_exprs();
 
   // Extract all the source bitmap addresses.
@@ -370,7 +460,24 @@ void LLVMGenerator::ComputeBitMapsForExpr(const CompiledExpr& compiled_expr,
   uint8_t* dst_bitmap = eval_batch.GetBuffer(out_idx);
 
   // Compute the destination bitmap.
-  accumulator.ComputeResult(dst_bitmap);
+  if (selection_vector == nullptr) {
+    accumulator.ComputeResult(dst_bitmap);
+    return;
+  }
+
+  // The input and local bitmaps cover all the records : intersect them into a
+  // temporary bitmap, then gather the bits of the selected records.
+  LocalBitMapsHolder bitmaps(eval_batch.num_records(), 1 /*local_bitmaps*/);
+  uint8_t* all_bitmap = bitmaps.GetLocalBitMap(0);
+  accumulator.ComputeResult(all_bitmap);
+
+  int64_t num_slots = selection_vector->GetNumSlots();
+  memset(dst_bitmap, 0, arrow::BitUtil::BytesForBits(num_slots));
+  for (int64_t i = 0; i < num_slots; ++i) {
+    if (arrow::BitUtil::GetBit(all_bitmap, selection_vector->GetIndex(i))) {
+      arrow::BitUtil::SetBit(dst_bitmap, i);
+    }
+  }
 }
 
 llvm::Value* LLVMGenerator::AddFunctionCall(const std::string& full_name,
@@ -574,8 +681,8 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = dex.holder().get<std::string>();
 
-      llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
-      value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
+      value = generator_->engine_->ProcessAddressConstant(str.c_str(),
+                                                          types->i8_ptr_type());
       len = types->i32_constant(static_cast<int32_t>(str.length()));
       break;
     }
@@ -915,8 +1022,8 @@ void LLVMGenerator::Visitor::VisitInExpression(const InExprDexBase<Type>& dex) {
 
   const InExprDex<Type>& dex_instance = dynamic_cast<const InExprDex<Type>&>(dex);
   /* add the holder at the beginning */
-  llvm::Constant* ptr_int_cast =
-      types->i64_constant((int64_t)(dex_instance.in_holder().get()));
+  llvm::Constant* ptr_int_cast = generator_->engine_->ProcessAddressConstant(
+      dex_instance.in_holder().get(), types->i64_type());
   params.push_back(ptr_int_cast);
 
   /* eval expr result */
@@ -1072,7 +1179,7 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer.
   if (holder != nullptr) {
-    auto ptr = types->i64_constant((int64_t)holder);
+    auto ptr = generator_->engine_->ProcessAddressConstant(holder, types->i64_type());
     params.push_back(ptr);
   }
 
@@ -1214,9 +1321,8 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
 
   // cast this to an llvm pointer.
   const char* str = trace_strings_.back().c_str();
-  llvm::Constant* str_int_cast = types()->i64_constant((int64_t)str);
   llvm::Constant* str_ptr_cast =
-      llvm::ConstantExpr::getIntToPtr(str_int_cast, types()->i8_ptr_type());
+      engine_->ProcessAddressConstant(str, types()->i8_ptr_type());
 
   std::vector<llvm::Value*> args;
   args.push_back(str_ptr_cast);
@@ -35,6 +35,8 @@
 #include "gandiva/gandiva_aliases.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/lvalue.h"
+#include "gandiva/profile.h"
+#include "gandiva/selection_vector.h"
 #include "gandiva/value_validity_pair.h"
 
 namespace gandiva {
@@ -50,12 +52,32 @@ class LLVMGenerator {
 
   /// \brief Build the code for the expression trees. Each element in the vector
   /// represents an expression tree
-  Status Build(const ExpressionVector& exprs);
+  ///
+  /// With a selection vector mode, the code evaluates the expressions for the
+  /// records of a selection vector of that type only.
+  Status Build(const ExpressionVector& exprs,
+               SelectionVector::Mode selection_vector_mode = SelectionVector::MODE_NONE);
 
   /// \brief Execute the built expression against the provided arguments.
   Status Execute(const arrow::RecordBatch& record_batch,
                  const ArrayDataVector& output_vector);
 
+  /// \brief Execute the built expression for the records in the selection vector.
+  /// The outputs have one entry for each slot of the selection vector. The execution
+  /// is added to 'counters' if profiling is enabled.
+  Status Execute(const arrow::RecordBatch& record_batch,
+                 const SelectionVector* selection_vector,
+                 const ArrayDataVector& output_vector,
+                 EvaluationCounters* counters = NULLPTR);
+
+  SelectionVector::Mode selection_vector_mode() const { return selection_vector_mode_; }
+
+  /// Bytes of machine code and data generated for the expressions.
+  size_t code_size() const { return engine_->code_size(); }
+
+  /// Timings of the build.
+  BuildProfile build_profile() const;
+
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
 
@@ -164,6 +186,10 @@ class LLVMGenerator {
   /// Generate code to load the vector at specified index and cast it as offsets array.
   llvm::Value* GetOffsetsReference(llvm::Value* arg_addrs, int idx, FieldPtr field);
 
+  /// Generate code to load the record position at 'loop_var' in the selection vector.
+  llvm::Value* GetSelectedPosition(llvm::Value* arg_selection_vector,
+                                   llvm::Value* loop_var);
+
   /// Generate code for the value array of one expression.
   Status CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr output, int suffix_idx,
                           llvm::Function** fn);
@@ -199,8 +225,10 @@ class LLVMGenerator {
   /// \param[in] compiled_expr the compiled expression (includes the bitmap indices to be
   ///            used for computing the validity bitmap of the result).
   /// \param[in] eval_batch (includes input/output buffer addresses)
+  /// \param[in] selection_vector the selected records, or null for all the records.
   void ComputeBitMapsForExpr(const CompiledExpr& compiled_expr,
-                             const EvalBatch& eval_batch);
+                             const EvalBatch& eval_batch,
+                             const SelectionVector* selection_vector);
 
   /// Replace the %T in the trace msg with the correct type corresponding to 'type'
   /// eg. %d for int32, %ld for int64, ..
@@ -214,6 +242,11 @@ class LLVMGenerator {
   std::vector<std::unique_ptr<CompiledExpr>> compiled_exprs_;
   FunctionRegistry function_registry_;
   Annotator annotator_;
+  SelectionVector::Mode selection_vector_mode_;
+
+  // profiling
+  bool enable_profiling_;
+  int64_t ir_generation_ns_;
 
   // used for debug
   bool dump_ir_;
@@ -89,6 +89,11 @@ TEST_F(TestLLVMGenerator, TestAdd) {
   status = generator->CodeGenExprValue(func_dex, desc_sum, 0, &ir_func);
   EXPECT_TRUE(status.ok()) << status.message();
 
+  // The pre-compiled function is only linked when the module is finalized
+  llvm::Function* pc_func = generator->module()->getFunction(native_func->pc_name());
+  ASSERT_NE(pc_func, nullptr);
+  EXPECT_TRUE(pc_func->isDeclaration());
+
   status = generator->engine_->FinalizeModule(true, false);
   EXPECT_TRUE(status.ok()) << status.message();
 
@@ -107,7 +112,8 @@ TEST_F(TestLLVMGenerator, TestAdd) {
       reinterpret_cast<uint8_t*>(a1),  reinterpret_cast<uint8_t*>(&in_bitmap),
       reinterpret_cast<uint8_t*>(out), reinterpret_cast<uint8_t*>(&out_bitmap),
   };
-  eval_func(addrs, nullptr, 0 /* dummy context ptr */, num_records);
+  eval_func(addrs, nullptr, nullptr /* selection vector */, 0 /* dummy context ptr */,
+            num_records);
 
   uint32_t expected[] = {6, 8, 10, 12};
   for (int i = 0; i < num_records; i++) {
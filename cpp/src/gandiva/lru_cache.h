@@ -27,7 +27,8 @@
 // modified from boost LRU cache -> the boost cache supported only an
 // ordered map.
 namespace gandiva {
-// a cache which evicts the least recently used item when it is full
+// a cache which evicts the least recently used items when it is full. Each item has a
+// weight (e.g. its size in bytes), and the capacity bounds the total weight.
 template <class Key, class Value>
 class LruCache {
  public:
@@ -40,11 +41,14 @@ class LruCache {
       return i.Hash();
     }
   };
-  using map_type =
-      std::unordered_map<key_type, std::pair<value_type, typename list_type::iterator>,
-                         hasher>;
+  struct entry_type {
+    value_type value;
+    typename list_type::iterator position_in_lru_list;
+    size_t weight;
+  };
+  using map_type = std::unordered_map<key_type, entry_type, hasher>;
 
-  explicit LruCache(size_t capacity) : cache_capacity_(capacity) {}
+  explicit LruCache(size_t capacity) : cache_capacity_(capacity), total_weight_(0) {}
 
   ~LruCache() {}
 
@@ -52,23 +56,32 @@ class LruCache {
 
   size_t capacity() const { return cache_capacity_; }
 
+  // total weight of the items in the cache.
+  size_t weight() const { return total_weight_; }
+
   bool empty() const { return map_.empty(); }
 
   bool contains(const key_type& key) { return map_.find(key) != map_.end(); }
 
-  void insert(const key_type& key, const value_type& value) {
+  // insert the item, unless it is already in the cache or heavier than the capacity.
+  // Returns the number of items evicted to make room for it.
+  size_t insert(const key_type& key, const value_type& value, size_t weight = 1) {
+    size_t num_evicted = 0;
     typename map_type::iterator i = map_.find(key);
-    if (i == map_.end()) {
+    if (i == map_.end() && weight <= cache_capacity_) {
       // insert item into the cache, but first check if it is full
-      if (size() >= cache_capacity_) {
+      while (total_weight_ + weight > cache_capacity_) {
         // cache is full, evict the least recently used item
         evict();
+        ++num_evicted;
       }
 
       // insert the new item
       lru_list_.push_front(key);
-      map_[key] = std::make_pair(value, lru_list_.begin());
+      map_[key] = entry_type{value, lru_list_.begin(), weight};
+      total_weight_ += weight;
     }
+    return num_evicted;
   }
 
   boost::optional<value_type> get(const key_type& key) {
@@ -81,36 +94,34 @@ class LruCache {
 
     // return the value, but first update its place in the most
     // recently used list
-    typename list_type::iterator postition_in_lru_list = value_for_key->second.second;
-    if (postition_in_lru_list != lru_list_.begin()) {
+    entry_type& entry = value_for_key->second;
+    if (entry.position_in_lru_list != lru_list_.begin()) {
       // move item to the front of the most recently used list
-      lru_list_.erase(postition_in_lru_list);
-      lru_list_.push_front(key);
+      lru_list_.splice(lru_list_.begin(), lru_list_, entry.position_in_lru_list);
+    }
+    return entry.value;
+  }
 
-      // update iterator in map
-      postition_in_lru_list = lru_list_.begin();
-      const value_type& value = value_for_key->second.first;
-      map_[key] = std::make_pair(value, postition_in_lru_list);
-
-      // return the value
-      return value;
-    } else {
-      // the item is already at the front of the most recently
-      // used list so just return it
-      return value_for_key->second.first;
+  // evict the least recently used item, if any.
+  void evict_lru() {
+    if (!map_.empty()) {
+      evict();
     }
   }
 
   void clear() {
     map_.clear();
     lru_list_.clear();
+    total_weight_ = 0;
   }
 
  private:
   void evict() {
     // evict item from the end of most recently used list
     typename list_type::iterator i = --lru_list_.end();
-    map_.erase(*i);
+    typename map_type::iterator entry = map_.find(*i);
+    total_weight_ -= entry->second.weight;
+    map_.erase(entry);
     lru_list_.erase(i);
   }
 
@@ -118,6 +129,7 @@ class LruCache {
   map_type map_;
   list_type lru_list_;
   size_t cache_capacity_;
+  size_t total_weight_;
 };
 }  // namespace gandiva
 #endif  // LRU_CACHE_H
@@ -61,4 +61,27 @@ TEST_F(TestLruCache, TestLruBehavior) {
   // should have evicted key 2.
   ASSERT_EQ(*cache_.get(TestCacheKey(1)), "hello");
 }
+
+TEST(TestWeightedLruCache, TestEvictByWeight) {
+  LruCache<TestCacheKey, std::string> cache(10);
+  ASSERT_EQ(0, cache.insert(TestCacheKey(1), "hello", 4));
+  ASSERT_EQ(0, cache.insert(TestCacheKey(2), "hello", 4));
+  ASSERT_EQ(8, cache.weight());
+
+  // should evict key 1, the least recently used
+  ASSERT_EQ(1, cache.insert(TestCacheKey(3), "hello", 4));
+  ASSERT_EQ(cache.get(TestCacheKey(1)), boost::none);
+  ASSERT_EQ(8, cache.weight());
+
+  // should evict keys 2 and 3
+  cache.get(TestCacheKey(2));
+  ASSERT_EQ(2, cache.insert(TestCacheKey(4), "hello", 9));
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(9, cache.weight());
+
+  // items heavier than the capacity are not kept
+  ASSERT_EQ(0, cache.insert(TestCacheKey(5), "hello", 11));
+  ASSERT_EQ(cache.get(TestCacheKey(5)), boost::none);
+  ASSERT_EQ(*cache.get(TestCacheKey(4)), "hello");
+}
 }  // namespace gandiva
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/morsels.h"
+
+#include <memory>
+#include <vector>
+
+#include "arrow/util/bit-util.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+
+namespace gandiva {
+
+namespace {
+
+// Bitmaps are copied to start on a byte; the other buffers are sliced to start at
+// the first record.
+Status RealignArrayData(const arrow::ArrayData& data, arrow::MemoryPool* pool,
+                        std::shared_ptr<arrow::ArrayData>* out) {
+  const int64_t offset = data.offset;
+  const int64_t length = data.length;
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers(data.buffers.size());
+
+  if (data.buffers[0]) {
+    ARROW_RETURN_NOT_OK(arrow::internal::CopyBitmap(pool, data.buffers[0]->data(),
+                                                    offset, length, &buffers[0]));
+  }
+
+  if (arrow::is_binary_like(data.type->id())) {
+    // The offsets keep pointing into the whole data buffer.
+    buffers[1] = arrow::SliceBuffer(data.buffers[1], offset * sizeof(int32_t),
+                                    (length + 1) * sizeof(int32_t));
+    buffers[2] = data.buffers[2];
+  } else {
+    const auto* fw_type = dynamic_cast<const arrow::FixedWidthType*>(data.type.get());
+    ARROW_RETURN_IF(fw_type == nullptr,
+                    Status::Invalid("Cannot realign array of type ",
+                                    data.type->ToString()));
+    const int bit_width = fw_type->bit_width();
+    if (bit_width % 8 == 0) {
+      buffers[1] = arrow::SliceBuffer(data.buffers[1], offset * bit_width / 8,
+                                      length * bit_width / 8);
+    } else {
+      ARROW_RETURN_NOT_OK(arrow::internal::CopyBitmap(pool, data.buffers[1]->data(),
+                                                      offset, length, &buffers[1]));
+    }
+  }
+
+  *out = arrow::ArrayData::Make(data.type, length, std::move(buffers), data.null_count,
+                                /*offset=*/0);
+  return Status::OK();
+}
+
+// The slices of the columns do not start on a byte of their bitmaps when the chunks
+// of the table are themselves unaligned slices, or end at different records in
+// different columns.  Such columns are realigned.
+Status RealignMorsel(arrow::MemoryPool* pool,
+                     std::shared_ptr<arrow::RecordBatch>* morsel) {
+  std::vector<std::shared_ptr<arrow::Array>> columns;
+  bool realigned = false;
+  for (int i = 0; i < (*morsel)->num_columns(); ++i) {
+    auto column = (*morsel)->column(i);
+    if (column->offset() % 8 != 0) {
+      std::shared_ptr<arrow::ArrayData> data;
+      ARROW_RETURN_NOT_OK(RealignArrayData(*column->data(), pool, &data));
+      column = arrow::MakeArray(data);
+      realigned = true;
+    }
+    columns.push_back(column);
+  }
+  if (realigned) {
+    *morsel = arrow::RecordBatch::Make((*morsel)->schema(), (*morsel)->num_rows(),
+                                       std::move(columns));
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status MakeMorsels(const arrow::Table& table, int64_t morsel_size,
+                   arrow::MemoryPool* pool,
+                   std::vector<std::shared_ptr<arrow::RecordBatch>>* morsels) {
+  ARROW_RETURN_IF(morsel_size <= 0, Status::Invalid("Morsel size must be positive"));
+
+  // Slices starting at multiples of 64 records keep the bitmaps of aligned chunks
+  // aligned.
+  morsel_size = (morsel_size + 63) / 64 * 64;
+
+  morsels->clear();
+  arrow::TableBatchReader reader(table);
+  reader.set_chunksize(morsel_size);
+  std::shared_ptr<arrow::RecordBatch> morsel;
+  while (true) {
+    ARROW_RETURN_NOT_OK(reader.ReadNext(&morsel));
+    if (morsel == nullptr) {
+      break;
+    }
+    if (morsel->num_rows() > 0) {
+      ARROW_RETURN_NOT_OK(RealignMorsel(pool, &morsel));
+      morsels->push_back(morsel);
+    }
+  }
+  return Status::OK();
+}
+
+Status ParallelForMorsels(int64_t num_morsels,
+                          const std::function<Status(int64_t morsel_index)>& func) {
+  // A task of the CPU pool waiting on other tasks of it could deadlock, so evaluate
+  // serially there
+  auto cpu_pool = arrow::internal::GetCpuThreadPool();
+  auto task_group = cpu_pool->OwnsThisThread()
+                        ? arrow::internal::TaskGroup::MakeSerial()
+                        : arrow::internal::TaskGroup::MakeThreaded(cpu_pool);
+  for (int64_t i = 0; i < num_morsels && task_group->ok(); ++i) {
+    task_group->Append([&func, i] { return func(i); });
+  }
+  return task_group->Finish();
+}
+
+}  // namespace gandiva
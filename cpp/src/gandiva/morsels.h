@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_MORSELS_H
+#define GANDIVA_MORSELS_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "arrow/table.h"
+
+#include "gandiva/arrow.h"
+
+namespace gandiva {
+
+/// Default number of records in a morsel : the buffers of a few columns fit in
+/// the L2 cache.
+constexpr int64_t kDefaultMorselSize = 16 * 1024;
+
+/// \brief Split a table in morsels for evaluation.
+///
+/// The morsels are slices of the table, of at most 'morsel_size' records (rounded up
+/// to a multiple of 64), in the order of the table.  They also end at the boundaries
+/// of the chunks of the table.  The bitmaps of the columns whose slice does not start
+/// on a byte are copied from 'pool'; the other buffers are not copied.
+Status MakeMorsels(const arrow::Table& table, int64_t morsel_size,
+                   arrow::MemoryPool* pool,
+                   std::vector<std::shared_ptr<arrow::RecordBatch>>* morsels);
+
+/// \brief Call 'func' with the index of each morsel, from the CPU thread pool, or
+/// serially when called from a task of that pool.
+///
+/// Returns once all the calls are done, or the status of the first failed call.
+Status ParallelForMorsels(int64_t num_morsels,
+                          const std::function<Status(int64_t morsel_index)>& func);
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_MORSELS_H
@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_cache.h"
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+
+namespace gandiva {
+
+// Cache files start with this magic, followed by the key, a NUL byte and
+// the object code.
+static const char kObjectCacheMagic[] = "GANDIVA-OBJECT-1\n";
+static const size_t kObjectCacheMagicLength = sizeof(kObjectCacheMagic) - 1;
+
+static std::string KeyDigest(const std::string& key) {
+  llvm::MD5 hasher;
+  hasher.update(key);
+  llvm::MD5::MD5Result result;
+  hasher.final(result);
+  llvm::SmallString<32> digest;
+  llvm::MD5::stringifyResult(result, digest);
+  return digest.str().str();
+}
+
+ObjectCache::ObjectCache(const std::string& directory, const std::string& key)
+    : directory_(directory), key_(key) {
+  llvm::SmallString<256> path(directory_);
+  llvm::sys::path::append(path, KeyDigest(key_) + ".o");
+  path_ = path.str().str();
+}
+
+bool ObjectCache::Load() {
+  auto buffer_or_error = llvm::MemoryBuffer::getFile(path_);
+  if (!buffer_or_error) {
+    return false;
+  }
+  std::unique_ptr<llvm::MemoryBuffer> buffer = std::move(buffer_or_error.get());
+  llvm::StringRef contents = buffer->getBuffer();
+  const size_t header_length = kObjectCacheMagicLength + key_.size() + 1;
+  if (contents.size() <= header_length ||
+      !contents.startswith(llvm::StringRef(kObjectCacheMagic, kObjectCacheMagicLength)) ||
+      contents.substr(kObjectCacheMagicLength, key_.size()) != key_ ||
+      contents[header_length - 1] != '\0') {
+    // Collision or corrupt file
+    return false;
+  }
+  object_ = llvm::MemoryBuffer::getMemBufferCopy(contents.substr(header_length),
+                                                 buffer->getBufferIdentifier());
+  return true;
+}
+
+void ObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                       llvm::MemoryBufferRef object) {
+  if (llvm::sys::fs::create_directories(directory_)) {
+    return;
+  }
+  // Write to a unique file, then rename it so that concurrent readers
+  // never see a partial object
+  int fd;
+  llvm::SmallString<256> temp_path;
+  if (llvm::sys::fs::createUniqueFile(path_ + ".%%%%%%%%.tmp", fd, temp_path)) {
+    return;
+  }
+  bool ok;
+  {
+    llvm::raw_fd_ostream out(fd, /*shouldClose=*/true);
+    out.write(kObjectCacheMagic, kObjectCacheMagicLength);
+    out << key_;
+    out.write('\0');
+    out << object.getBuffer();
+    out.close();
+    ok = !out.has_error();
+    out.clear_error();
+  }
+  if (!ok || llvm::sys::fs::rename(temp_path, path_)) {
+    llvm::sys::fs::remove(temp_path);
+  }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> ObjectCache::getObject(const llvm::Module* module) {
+  if (object_ == nullptr) {
+    return nullptr;
+  }
+  return llvm::MemoryBuffer::getMemBufferCopy(object_->getBuffer(),
+                                              object_->getBufferIdentifier());
+}
+
+}  // namespace gandiva
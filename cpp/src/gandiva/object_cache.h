@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_OBJECT_CACHE_H
+#define GANDIVA_OBJECT_CACHE_H
+
+#include <memory>
+#include <string>
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include "arrow/util/macros.h"
+
+namespace gandiva {
+
+/// \brief LLVM object cache persisting the machine code of a module on disk.
+///
+/// An instance serves the single module of an engine, whose code is identified
+/// by a key string.  The object is stored in the cache directory under a
+/// digest of the key, together with the key itself so that digest collisions
+/// are detected.  The cache is best effort: I/O errors only cause misses.
+class ObjectCache : public llvm::ObjectCache {
+ public:
+  ObjectCache(const std::string& directory, const std::string& key);
+
+  /// Look up the object for the key.  If found, it is returned to the JIT
+  /// instead of compiling the module.
+  bool Load();
+
+  /// Path of the cache file for the key.
+  const std::string& path() const { return path_; }
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override;
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+ private:
+  std::string directory_;
+  std::string key_;
+  std::string path_;
+  std::unique_ptr<llvm::MemoryBuffer> object_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ObjectCache);
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_OBJECT_CACHE_H
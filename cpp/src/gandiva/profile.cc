@@ -0,0 +1,43 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/profile.h"
+
+#include <sstream>
+
+namespace gandiva {
+
+std::string Profile::ToString() const {
+  std::stringstream ss;
+  ss << "build: ir_generation=" << build.ir_generation_ns << "ns"
+     << " link=" << build.link_ns << "ns"
+     << " optimization=" << build.optimization_ns << "ns"
+     << " code_emission=" << build.code_emission_ns << "ns"
+     << " code_size=" << build.code_size << "B"
+     << (build.loaded_from_object_cache ? " (object cache)" : "")
+     << (build.from_cache ? " (cached module)" : "") << "\n";
+  ss << "evaluation: batches=" << evaluation.num_batches
+     << " rows=" << evaluation.num_rows << " time=" << evaluation.total_ns << "ns";
+  if (evaluation.num_rows > 0) {
+    ss << " (" << static_cast<double>(evaluation.total_ns) / evaluation.num_rows
+       << "ns/row)";
+  }
+  ss << "\n";
+  return ss.str();
+}
+
+}  // namespace gandiva
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_PROFILE_H
+#define GANDIVA_PROFILE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace gandiva {
+
+/// \brief Time spent in each phase of building a projector or filter.
+struct BuildProfile {
+  /// Generating the IR for the expressions.
+  int64_t ir_generation_ns = 0;
+  /// Linking the pre-compiled functions and removing the unused ones.
+  int64_t link_ns = 0;
+  /// Running the optimization passes, skipped for code in the object cache.
+  int64_t optimization_ns = 0;
+  /// Emitting or loading the machine code.
+  int64_t code_emission_ns = 0;
+  /// Bytes of machine code and data.
+  int64_t code_size = 0;
+  bool loaded_from_object_cache = false;
+  /// Make() returned a module built by an earlier Make() of an equal projector or
+  /// filter; the timings above are those of that build.
+  bool from_cache = false;
+};
+
+/// \brief Batches evaluated by a projector or filter, and the time spent on them.
+/// Only recorded when profiling is enabled in the configuration.
+struct EvaluationProfile {
+  int64_t num_batches = 0;
+  int64_t num_rows = 0;
+  int64_t total_ns = 0;
+};
+
+/// \brief Evaluation counters of one projector or filter returned by Make(). The
+/// morsels of a table update them concurrently.
+class EvaluationCounters {
+ public:
+  void Add(int64_t num_rows, int64_t ns) {
+    ++num_batches_;
+    num_rows_ += num_rows;
+    total_ns_ += ns;
+  }
+
+  EvaluationProfile ToProfile() const {
+    EvaluationProfile profile;
+    profile.num_batches = num_batches_;
+    profile.num_rows = num_rows_;
+    profile.total_ns = total_ns_;
+    return profile;
+  }
+
+ private:
+  std::atomic<int64_t> num_batches_{0};
+  std::atomic<int64_t> num_rows_{0};
+  std::atomic<int64_t> total_ns_{0};
+};
+
+/// \brief Profile of a projector or filter.
+struct Profile {
+  BuildProfile build;
+  EvaluationProfile evaluation;
+
+  std::string ToString() const;
+};
+
+/// Nanoseconds elapsed since 'start'.
+inline int64_t NanosSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_PROFILE_H
@@ -17,10 +17,14 @@
 
 #include "gandiva/projector.h"
 
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "arrow/table.h"
+
+#include "gandiva/annotator.h"
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
@@ -28,13 +32,21 @@
 
 namespace gandiva {
 
-Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+using ProjectorCache = Cache<ProjectorCacheKey, std::shared_ptr<Projector>>;
+
+static ProjectorCache& GetProjectorCache() {
+  static ProjectorCache cache;
+  return cache;
+}
+
+Projector::Projector(std::shared_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                      const FieldVector& output_fields,
-                     std::shared_ptr<Configuration> configuration)
+                     std::shared_ptr<Configuration> configuration, bool from_cache)
     : llvm_generator_(std::move(llvm_generator)),
       schema_(schema),
       output_fields_(output_fields),
-      configuration_(configuration) {}
+      configuration_(configuration),
+      from_cache_(from_cache) {}
 
 Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
                        std::shared_ptr<Projector>* projector) {
@@ -45,21 +57,33 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
                        std::shared_ptr<Configuration> configuration,
                        std::shared_ptr<Projector>* projector) {
+  return Projector::Make(schema, exprs, SelectionVector::MODE_NONE, configuration,
+                         projector);
+}
+
+Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
+                       SelectionVector::Mode selection_vector_mode,
+                       std::shared_ptr<Configuration> configuration,
+                       std::shared_ptr<Projector>* projector) {
   ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
   ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
   ARROW_RETURN_IF(configuration == nullptr,
                   Status::Invalid("Configuration cannot be null"));
 
   // see if equivalent projector was already built
-  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
-  ProjectorCacheKey cache_key(schema, configuration, exprs);
+  ProjectorCache& cache = GetProjectorCache();
+  ProjectorCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
   std::shared_ptr<Projector> cached_projector = cache.GetModule(cache_key);
   if (cached_projector != nullptr) {
-    *projector = cached_projector;
+    // share the module, but not the evaluation counters
+    *projector = std::shared_ptr<Projector>(
+        new Projector(cached_projector->llvm_generator_, schema,
+                      cached_projector->output_fields_, configuration, true));
     return Status::OK();
   }
 
   // Build LLVM generator, and generate code for the specified expressions
+  auto start_time = std::chrono::steady_clock::now();
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
 
@@ -71,7 +95,10 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
     ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
   }
 
-  ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs));
+  ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
+  auto compile_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start_time);
+  size_t code_size = llvm_gen->code_size();
 
   // save the output field types. Used for validation at Evaluate() time.
   std::vector<FieldPtr> output_fields;
@@ -82,19 +109,54 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   // Instantiate the projector with the completely built llvm generator
   *projector = std::shared_ptr<Projector>(
-      new Projector(std::move(llvm_gen), schema, output_fields, configuration));
-  cache.PutModule(cache_key, *projector);
+      new Projector(std::move(llvm_gen), schema, output_fields, configuration, false));
+  cache.PutModule(cache_key, *projector, code_size, compile_time.count());
 
   return Status::OK();
 }
 
+CacheStats Projector::GetCacheStats() { return GetProjectorCache().GetStats(); }
+
+Profile Projector::GetProfile() const {
+  Profile profile;
+  profile.build = llvm_generator_->build_profile();
+  profile.build.from_cache = from_cache_;
+  profile.evaluation = evaluation_counters_.ToProfile();
+  return profile;
+}
+
+Status Projector::Evaluate(const arrow::RecordBatch& batch,
+                           const ArrayDataVector& output_data_vecs) {
+  return EvaluateIntoArrays(batch, nullptr, output_data_vecs);
+}
+
+Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                           arrow::ArrayVector* output) {
+  return EvaluateIntoNewArrays(batch, nullptr, pool, output);
+}
+
 Status Projector::Evaluate(const arrow::RecordBatch& batch,
+                           const SelectionVector& selection_vector,
                            const ArrayDataVector& output_data_vecs) {
-  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+  return EvaluateIntoArrays(batch, &selection_vector, output_data_vecs);
+}
+
+Status Projector::Evaluate(const arrow::RecordBatch& batch,
+                           const SelectionVector& selection_vector,
+                           arrow::MemoryPool* pool, arrow::ArrayVector* output) {
+  return EvaluateIntoNewArrays(batch, &selection_vector, pool, output);
+}
+
+Status Projector::EvaluateIntoArrays(const arrow::RecordBatch& batch,
+                                     const SelectionVector* selection_vector,
+                                     const ArrayDataVector& output_data_vecs) {
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch, selection_vector));
   ARROW_RETURN_IF(
       output_data_vecs.size() != output_fields_.size(),
       Status::Invalid("Number of output buffers must match number of fields"));
 
+  int64_t num_output_rows =
+      selection_vector != nullptr ? selection_vector->GetNumSlots() : batch.num_rows();
   int idx = 0;
   for (auto& array_data : output_data_vecs) {
     const auto output_field = output_fields_[idx];
@@ -104,32 +166,43 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
     }
 
     ARROW_RETURN_NOT_OK(
-        ValidateArrayDataCapacity(*array_data, *output_field, batch.num_rows()));
+        ValidateArrayDataCapacity(*array_data, *output_field, num_output_rows));
     ++idx;
   }
 
-  return llvm_generator_->Execute(batch, output_data_vecs);
+  if (num_output_rows == 0) {
+    return Status::OK();
+  }
+  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs,
+                                  &evaluation_counters_);
 }
 
-Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
-                           arrow::ArrayVector* output) {
-  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+Status Projector::EvaluateIntoNewArrays(const arrow::RecordBatch& batch,
+                                        const SelectionVector* selection_vector,
+                                        arrow::MemoryPool* pool,
+                                        arrow::ArrayVector* output) {
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch, selection_vector));
   ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
   ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
 
   // Allocate the output data vecs.
+  int64_t num_output_rows =
+      selection_vector != nullptr ? selection_vector->GetNumSlots() : batch.num_rows();
   ArrayDataVector output_data_vecs;
   output_data_vecs.reserve(output_fields_.size());
   for (auto& field : output_fields_) {
     ArrayDataPtr output_data;
 
     ARROW_RETURN_NOT_OK(
-        AllocArrayData(field->type(), batch.num_rows(), pool, &output_data));
+        AllocArrayData(field->type(), num_output_rows, pool, &output_data));
     output_data_vecs.push_back(output_data);
   }
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, output_data_vecs));
+  if (num_output_rows > 0) {
+    ARROW_RETURN_NOT_OK(llvm_generator_->Execute(
+        batch, selection_vector, output_data_vecs, &evaluation_counters_));
+  }
 
   // Create and return array arrays.
   output->clear();
@@ -140,6 +213,42 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* p
   return Status::OK();
 }
 
+Status Projector::Evaluate(const arrow::Table& table, arrow::MemoryPool* pool,
+                           std::shared_ptr<arrow::Table>* output, int64_t morsel_size) {
+  ARROW_RETURN_IF(!table.schema()->Equals(*schema_),
+                  Status::Invalid("Schema in Table must match schema in Make()"));
+  ARROW_RETURN_IF(llvm_generator_->selection_vector_mode() != SelectionVector::MODE_NONE,
+                  Status::Invalid("Projector was built for a selection vector"));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  std::vector<std::shared_ptr<arrow::RecordBatch>> morsels;
+  ARROW_RETURN_NOT_OK(MakeMorsels(table, morsel_size, pool, &morsels));
+
+  // Each evaluation has its own execution context, so the morsels can be evaluated
+  // concurrently.
+  std::vector<arrow::ArrayVector> morsel_outputs(morsels.size());
+  ARROW_RETURN_NOT_OK(ParallelForMorsels(
+      static_cast<int64_t>(morsels.size()), [&](int64_t morsel_index) {
+        return Evaluate(*morsels[morsel_index], pool, &morsel_outputs[morsel_index]);
+      }));
+
+  // Assemble the outputs in the order of the morsels.
+  std::vector<std::shared_ptr<arrow::Column>> columns;
+  for (size_t field_idx = 0; field_idx < output_fields_.size(); ++field_idx) {
+    const auto& field = output_fields_[field_idx];
+    arrow::ArrayVector chunks;
+    chunks.reserve(morsel_outputs.size());
+    for (auto& arrays : morsel_outputs) {
+      chunks.push_back(arrays[field_idx]);
+    }
+    columns.push_back(std::make_shared<arrow::Column>(
+        field, std::make_shared<arrow::ChunkedArray>(chunks, field->type())));
+  }
+  *output = arrow::Table::Make(arrow::schema(output_fields_), columns, table.num_rows());
+  return Status::OK();
+}
+
 // TODO : handle variable-len vectors
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
                                  arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
@@ -165,11 +274,29 @@ Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
   return Status::OK();
 }
 
-Status Projector::ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch) {
+Status Projector::ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch,
+                                             const SelectionVector* selection_vector) {
   ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
                   Status::Invalid("Schema in RecordBatch must match schema in Make()"));
   ARROW_RETURN_IF(batch.num_rows() == 0,
                   Status::Invalid("RecordBatch must be non-empty."));
+  ARROW_RETURN_NOT_OK(Annotator::ValidateOffsets(batch));
+
+  auto mode = llvm_generator_->selection_vector_mode();
+  if (selection_vector == nullptr) {
+    ARROW_RETURN_IF(mode != SelectionVector::MODE_NONE,
+                    Status::Invalid("Projector was built for a selection vector"));
+  } else {
+    ARROW_RETURN_IF(
+        selection_vector->GetMode() != mode,
+        Status::Invalid("Selection vector type must match the one in Make()"));
+    // The generated code reads the selected records without bounds checks
+    const uint64_t max_index = selection_vector->GetMaxIndex();
+    ARROW_RETURN_IF(max_index >= static_cast<uint64_t>(batch.num_rows()),
+                    Status::Invalid("Selection vector index ", max_index,
+                                    " is out of bounds for a record batch of ",
+                                    batch.num_rows(), " records"));
+  }
 
   return Status::OK();
 }
@@ -26,8 +26,12 @@
 #include "arrow/status.h"
 
 #include "gandiva/arrow.h"
+#include "gandiva/cache_stats.h"
 #include "gandiva/configuration.h"
 #include "gandiva/expression.h"
+#include "gandiva/morsels.h"
+#include "gandiva/profile.h"
+#include "gandiva/selection_vector.h"
 
 namespace gandiva {
 
@@ -59,6 +63,21 @@ class Projector {
                      std::shared_ptr<Configuration> configuration,
                      std::shared_ptr<Projector>* projector);
 
+  /// Build a projector for the given schema to evaluate the vector of expressions,
+  /// for the records of selection vectors of the given type (e.g. the output of a
+  /// Filter). Customize the projector with runtime configuration.
+  ///
+  /// \param[in] schema schema for the record batches, and the expressions.
+  /// \param[in] exprs vector of expressions.
+  /// \param[in] selection_vector_mode type of the selection vectors passed to
+  ///            Evaluate(), or MODE_NONE to evaluate all the records.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] projector the returned projector object
+  static Status Make(SchemaPtr schema, const ExpressionVector& exprs,
+                     SelectionVector::Mode selection_vector_mode,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<Projector>* projector);
+
   /// Evaluate the specified record batch, and return the allocated and populated output
   /// arrays. The output arrays will be allocated from the memory pool 'pool', and added
   /// to the vector 'output'.
@@ -77,9 +96,60 @@ class Projector {
   ///                populated by Evaluate.
   Status Evaluate(const arrow::RecordBatch& batch, const ArrayDataVector& output);
 
+  /// Evaluate the records of the specified record batch that are in the selection
+  /// vector, and return the allocated and populated output arrays. The output arrays
+  /// have one entry for each slot of the selection vector, and are allocated from
+  /// the memory pool 'pool'. The projector must be built for the type of the
+  /// selection vector.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] selection_vector the indices of the records to evaluate, all of them
+  ///            less than the number of records in the batch.
+  /// \param[in] pool memory pool used to allocate output arrays (if required).
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch,
+                  const SelectionVector& selection_vector, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output);
+
+  /// Evaluate the records of the specified record batch that are in the selection
+  /// vector, and populate the output arrays. The output arrays, with capacity for
+  /// the slots of the selection vector, must be allocated by the caller.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] selection_vector the indices of the records to evaluate, all of them
+  ///            less than the number of records in the batch.
+  /// \param[in,out] output vector of arrays, the arrays are allocated by the caller and
+  ///                populated by Evaluate.
+  Status Evaluate(const arrow::RecordBatch& batch,
+                  const SelectionVector& selection_vector,
+                  const ArrayDataVector& output);
+
+  /// Evaluate the specified table, and return a table of the outputs. The table is
+  /// split in morsels of 'morsel_size' records, evaluated in parallel on the CPU
+  /// thread pool; the output columns have one chunk for each morsel. The output
+  /// arrays are allocated from the memory pool 'pool'.
+  ///
+  /// \param[in] table the table. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays.
+  /// \param[out] output the table of the output fields.
+  /// \param[in] morsel_size number of records in a morsel.
+  Status Evaluate(const arrow::Table& table, arrow::MemoryPool* pool,
+                  std::shared_ptr<arrow::Table>* output,
+                  int64_t morsel_size = kDefaultMorselSize);
+
+  /// Statistics of the cache of built projectors, shared by all threads.
+  static CacheStats GetCacheStats();
+
+  /// Timings of the build of this projector, and of the batches it evaluated if
+  /// profiling is enabled in its configuration. Each projector returned by Make()
+  /// has its own evaluation counters, even when it shares the cached module of an
+  /// equal projector.
+  Profile GetProfile() const;
+
  private:
-  Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
-            const FieldVector& output_fields, std::shared_ptr<Configuration>);
+  Projector(std::shared_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+            const FieldVector& output_fields, std::shared_ptr<Configuration>,
+            bool from_cache);
 
   /// Allocate an ArrowData of length 'length'.
   Status AllocArrayData(const DataTypePtr& type, int64_t length, arrow::MemoryPool* pool,
@@ -90,12 +160,25 @@ class Projector {
                                    const arrow::Field& field, int64_t num_records);
 
   /// Validate the common args for Evaluate() APIs.
-  Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
+  Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch,
+                                    const SelectionVector* selection_vector);
+
+  /// Validate the output arrays, and evaluate the expressions.
+  Status EvaluateIntoArrays(const arrow::RecordBatch& batch,
+                            const SelectionVector* selection_vector,
+                            const ArrayDataVector& output);
+
+  /// Allocate the output arrays, evaluate the expressions and return the arrays.
+  Status EvaluateIntoNewArrays(const arrow::RecordBatch& batch,
+                               const SelectionVector* selection_vector,
+                               arrow::MemoryPool* pool, arrow::ArrayVector* output);
 
-  const std::unique_ptr<LLVMGenerator> llvm_generator_;
+  const std::shared_ptr<LLVMGenerator> llvm_generator_;
   const SchemaPtr schema_;
   const FieldVector output_fields_;
   const std::shared_ptr<Configuration> configuration_;
+  const bool from_cache_;
+  EvaluationCounters evaluation_counters_;
 };
 
 }  // namespace gandiva
@@ -31,8 +31,22 @@ namespace gandiva {
 /// backed by an arrow-array.
 class SelectionVector {
  public:
+  /// Type of the indices in a selection vector.
+  enum Mode : int {
+    MODE_NONE,
+    MODE_UINT16,
+    MODE_UINT32,
+    MODE_UINT64,
+  };
+
   virtual ~SelectionVector() = default;
 
+  /// Get the type of the indices.
+  virtual Mode GetMode() const = 0;
+
+  /// Get the buffer holding the indices.
+  virtual const std::shared_ptr<arrow::Buffer>& GetBuffer() const = 0;
+
   /// Get the value at a given index.
   virtual uint64_t GetIndex(int64_t index) const = 0;
 
@@ -51,6 +65,9 @@ class SelectionVector {
   /// Set the number of slots in the selection vector.
   virtual void SetNumSlots(int64_t num_slots) = 0;
 
+  /// The largest value in the slots of the selection vector, 0 if there are none.
+  virtual uint64_t GetMaxIndex() const = 0;
+
   /// Convert to arrow-array.
   virtual ArrayPtr ToArray() const = 0;
 
@@ -18,6 +18,7 @@
 #ifndef GANDIVA_SELECTION_VECTOR_IMP_H
 #define GANDIVA_SELECTION_VECTOR_IMP_H
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 
@@ -32,7 +33,7 @@ namespace gandiva {
 
 /// \brief template implementation of selection vector with a specific ctype and arrow
 /// type.
-template <typename C_TYPE, typename A_TYPE>
+template <typename C_TYPE, typename A_TYPE, SelectionVector::Mode MODE>
 class SelectionVectorImpl : public SelectionVector {
  public:
   SelectionVectorImpl(int64_t max_slots, std::shared_ptr<arrow::Buffer> buffer)
@@ -40,6 +41,10 @@ class SelectionVectorImpl : public SelectionVector {
     raw_data_ = reinterpret_cast<C_TYPE*>(buffer->mutable_data());
   }
 
+  Mode GetMode() const override { return MODE; }
+
+  const std::shared_ptr<arrow::Buffer>& GetBuffer() const override { return buffer_; }
+
   uint64_t GetIndex(int64_t index) const override { return raw_data_[index]; }
 
   void SetIndex(int64_t index, uint64_t value) override {
@@ -57,6 +62,10 @@ class SelectionVectorImpl : public SelectionVector {
     num_slots_ = num_slots;
   }
 
+  uint64_t GetMaxIndex() const override {
+    return num_slots_ == 0 ? 0 : *std::max_element(raw_data_, raw_data_ + num_slots_);
+  }
+
   uint64_t GetMaxSupportedValue() const override {
     return std::numeric_limits<C_TYPE>::max();
   }
@@ -77,16 +86,19 @@ class SelectionVectorImpl : public SelectionVector {
   C_TYPE* raw_data_;
 };
 
-template <typename C_TYPE, typename A_TYPE>
-ArrayPtr SelectionVectorImpl<C_TYPE, A_TYPE>::ToArray() const {
+template <typename C_TYPE, typename A_TYPE, SelectionVector::Mode MODE>
+ArrayPtr SelectionVectorImpl<C_TYPE, A_TYPE, MODE>::ToArray() const {
   auto data_type = arrow::TypeTraits<A_TYPE>::type_singleton();
   auto array_data = arrow::ArrayData::Make(data_type, num_slots_, {NULLPTR, buffer_});
   return arrow::MakeArray(array_data);
 }
 
-using SelectionVectorInt16 = SelectionVectorImpl<uint16_t, arrow::UInt16Type>;
-using SelectionVectorInt32 = SelectionVectorImpl<uint32_t, arrow::UInt32Type>;
-using SelectionVectorInt64 = SelectionVectorImpl<uint64_t, arrow::UInt64Type>;
+using SelectionVectorInt16 =
+    SelectionVectorImpl<uint16_t, arrow::UInt16Type, SelectionVector::MODE_UINT16>;
+using SelectionVectorInt32 =
+    SelectionVectorImpl<uint32_t, arrow::UInt32Type, SelectionVector::MODE_UINT32>;
+using SelectionVectorInt64 =
+    SelectionVectorImpl<uint64_t, arrow::UInt64Type, SelectionVector::MODE_UINT64>;
 
 }  // namespace gandiva
 
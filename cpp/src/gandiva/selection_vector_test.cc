@@ -54,6 +54,8 @@ TEST_F(TestSelectionVector, TestInt16Make) {
   EXPECT_EQ(status.ok(), true) << status.message();
   EXPECT_EQ(selection2->GetMaxSlots(), max_slots);
   EXPECT_EQ(selection2->GetNumSlots(), 0);
+  EXPECT_EQ(selection2->GetMode(), SelectionVector::MODE_UINT16);
+  EXPECT_EQ(selection2->GetBuffer(), buffer);
 }
 
 TEST_F(TestSelectionVector, TestInt16MakeNegative) {
@@ -292,4 +292,87 @@ TEST_F(TestFilter, TestSimpleSVInt32) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestFilterTable) {
+  // schema for input fields
+  auto field0 = field("f0", arrow::int64());
+  auto schema = arrow::schema({field0});
+
+  // Build condition f0 % 7 == 0
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto mod_func = TreeExprBuilder::MakeFunction(
+      "mod", {node_f0, TreeExprBuilder::MakeLiteral((int64_t)7)}, arrow::int64());
+  auto equal_0 = TreeExprBuilder::MakeFunction(
+      "equal", {mod_func, TreeExprBuilder::MakeLiteral((int64_t)0)}, arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(equal_0);
+
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, TestConfiguration(), &filter);
+  ASSERT_OK(status);
+
+  // Create a table of two chunks, with several morsels each
+  std::vector<int64_t> values;
+  std::vector<uint64_t> expected;
+  for (int64_t i = 0; i < 1000; ++i) {
+    values.push_back(i);
+    if (i % 7 == 0) {
+      expected.push_back(i);
+    }
+  }
+  auto array0 = MakeArrowArrayInt64(values);
+  auto column0 = std::make_shared<arrow::Column>(
+      field0, arrow::ArrayVector{array0->Slice(0, 320), array0->Slice(320)});
+  auto table = arrow::Table::Make(schema, {column0});
+
+  std::shared_ptr<arrow::ChunkedArray> indices;
+  status = filter->Evaluate(*table, pool_, &indices, 100 /*morsel_size*/);
+  ASSERT_OK(status);
+
+  // the morsel size is rounded up to 128 records
+  ASSERT_EQ(indices->num_chunks(), 9);
+  auto exp = MakeArrowArrayUint64(expected);
+  EXPECT_TRUE(indices->Equals(arrow::ChunkedArray({exp})));
+}
+
+
+TEST_F(TestFilter, TestFilterTableUnalignedChunks) {
+  // schema for input fields
+  auto field0 = field("f0", arrow::int64());
+  auto schema = arrow::schema({field0});
+
+  // Build condition f0 % 7 == 0
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto mod_func = TreeExprBuilder::MakeFunction(
+      "mod", {node_f0, TreeExprBuilder::MakeLiteral((int64_t)7)}, arrow::int64());
+  auto equal_0 = TreeExprBuilder::MakeFunction(
+      "equal", {mod_func, TreeExprBuilder::MakeLiteral((int64_t)0)}, arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(equal_0);
+
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, TestConfiguration(), &filter);
+  ASSERT_OK(status);
+
+  // The second chunk is a slice starting in the middle of a byte of the bitmap.
+  std::vector<int64_t> values;
+  std::vector<bool> validity;
+  std::vector<uint64_t> expected;
+  for (int64_t i = 0; i < 1000; ++i) {
+    values.push_back(i);
+    validity.push_back(i % 2 == 0);
+    if (i % 14 == 0) {
+      expected.push_back(i);
+    }
+  }
+  auto array0 = MakeArrowArrayInt64(values, validity);
+  auto column0 = std::make_shared<arrow::Column>(
+      field0, arrow::ArrayVector{array0->Slice(0, 3), array0->Slice(3)});
+  auto table = arrow::Table::Make(schema, {column0});
+
+  std::shared_ptr<arrow::ChunkedArray> indices;
+  status = filter->Evaluate(*table, pool_, &indices, 100 /*morsel_size*/);
+  ASSERT_OK(status);
+
+  auto exp = MakeArrowArrayUint64(expected);
+  EXPECT_TRUE(indices->Equals(arrow::ChunkedArray({exp})));
+}
+
 }  // namespace gandiva
@@ -18,6 +18,8 @@
 #include "gandiva/projector.h"
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
+#include "arrow/util/thread-pool.h"
+#include "gandiva/filter.h"
 #include "gandiva/tests/test_util.h"
 #include "gandiva/tree_expr_builder.h"
 
@@ -26,6 +28,7 @@ namespace gandiva {
 using arrow::boolean;
 using arrow::float32;
 using arrow::int32;
+using arrow::int64;
 
 class TestProjector : public ::testing::Test {
  public:
@@ -97,6 +100,33 @@ TEST_F(TestProjector, TestProjectCache) {
   EXPECT_NE(projector, should_be_new_projector2);
 }
 
+TEST_F(TestProjector, TestProjectCacheStats) {
+  auto field0 = field("stats_f0", int32());
+  auto schema = arrow::schema({field0});
+  auto field_cast = field("stats_cast", int64());
+  auto cast_expr = TreeExprBuilder::MakeExpression("castBIGINT", {field0}, field_cast);
+
+  auto before = Projector::GetCacheStats();
+
+  // first build misses the cache, the second one hits it.
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {cast_expr}, TestConfiguration(), &projector));
+  ASSERT_OK(Projector::Make(schema, {cast_expr}, TestConfiguration(), &projector));
+
+  auto after = Projector::GetCacheStats();
+  EXPECT_EQ(after.misses, before.misses + 1);
+  EXPECT_EQ(after.hits, before.hits + 1);
+  EXPECT_EQ(after.num_entries, before.num_entries + 1);
+  EXPECT_GT(after.size_bytes, before.size_bytes);
+  EXPECT_LE(after.size_bytes, after.capacity_bytes);
+
+  int64_t num_built = 0;
+  for (size_t i = 0; i < after.compile_time_histogram.size(); ++i) {
+    num_built += after.compile_time_histogram[i] - before.compile_time_histogram[i];
+  }
+  EXPECT_EQ(num_built, 1);
+}
+
 TEST_F(TestProjector, TestProjectCacheFieldNames) {
   // schema for input fields
   auto field0 = field("f0", int32());
@@ -210,6 +240,56 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestProfile) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto field_sum = field("add", int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  auto configuration =
+      ConfigurationBuilder()
+          .set_byte_code_file_path(TestConfiguration()->byte_code_file_path())
+          .set_enable_profiling(true)
+          .build();
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &projector));
+
+  auto profile = projector->GetProfile();
+  EXPECT_GT(profile.build.ir_generation_ns, 0);
+  EXPECT_GT(profile.build.code_emission_ns, 0);
+  EXPECT_GT(profile.build.code_size, 0);
+  EXPECT_EQ(profile.evaluation.num_batches, 0);
+
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, 4, {array0, array1});
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  ASSERT_OK(projector->Evaluate(*in_batch->Slice(0, 3), pool_, &outputs));
+
+  profile = projector->GetProfile();
+  EXPECT_EQ(profile.evaluation.num_batches, 2);
+  EXPECT_EQ(profile.evaluation.num_rows, 7);
+  EXPECT_GT(profile.evaluation.total_ns, 0);
+
+  // an equal projector shares the cached module, but has its own counters
+  std::shared_ptr<Projector> cached_projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &cached_projector));
+  profile = cached_projector->GetProfile();
+  EXPECT_TRUE(profile.build.from_cache);
+  EXPECT_GT(profile.build.code_size, 0);
+  EXPECT_EQ(profile.evaluation.num_batches, 0);
+  ASSERT_OK(cached_projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_EQ(cached_projector->GetProfile().evaluation.num_rows, 4);
+  EXPECT_EQ(projector->GetProfile().evaluation.num_rows, 7);
+
+  // without profiling, the evaluations are not recorded
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, TestConfiguration(), &projector));
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_EQ(projector->GetProfile().evaluation.num_batches, 0);
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
@@ -651,4 +731,221 @@ TEST_F(TestProjector, TestModZero) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_mod, outputs.at(0));
 }
 
+TEST_F(TestProjector, TestProjectSelectionVector) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+  auto field_less = field("less_than", boolean());
+
+  // Build expressions
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  auto less_expr =
+      TreeExprBuilder::MakeExpression("less_than", {field0, field1}, field_less);
+
+  // Build a filter f0 > 2, and a projector for its output
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto literal_2 = TreeExprBuilder::MakeLiteral((int32_t)2);
+  auto condition = TreeExprBuilder::MakeCondition(
+      TreeExprBuilder::MakeFunction("greater_than", {node_f0, literal_2}, boolean()));
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, TestConfiguration(), &filter);
+  ASSERT_OK(status);
+
+  std::shared_ptr<Projector> projector;
+  status = Projector::Make(schema, {sum_expr, less_expr}, SelectionVector::MODE_UINT16,
+                           TestConfiguration(), &projector);
+  ASSERT_OK(status);
+
+  // Create a row-batch with some sample data
+  int num_records = 6;
+  auto array0 =
+      MakeArrowArrayInt32({1, 3, 2, 4, 5, 6}, {true, true, true, true, true, true});
+  auto array1 =
+      MakeArrowArrayInt32({10, 20, 30, 1, 50, 60}, {true, true, true, true, false, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt16(num_records, pool_, &selection_vector);
+  ASSERT_OK(status);
+  status = filter->Evaluate(*in_batch, selection_vector);
+  ASSERT_OK(status);
+
+  // Evaluate expressions for the selected records 1, 3, 4, 5
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, *selection_vector, pool_, &outputs);
+  ASSERT_OK(status);
+
+  auto exp_sum = MakeArrowArrayInt32({23, 5, 0, 66}, {true, true, false, true});
+  auto exp_less =
+      MakeArrowArrayBool({true, false, false, true}, {true, true, false, true});
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_less, outputs.at(1));
+
+  // Empty selection
+  selection_vector->SetNumSlots(0);
+  status = projector->Evaluate(*in_batch, *selection_vector, pool_, &outputs);
+  ASSERT_OK(status);
+  EXPECT_EQ(outputs.at(0)->length(), 0);
+
+  // The type of selection vector must match the one in Make()
+  std::shared_ptr<SelectionVector> selection_vector32;
+  status = SelectionVector::MakeInt32(num_records, pool_, &selection_vector32);
+  ASSERT_OK(status);
+  status = projector->Evaluate(*in_batch, *selection_vector32, pool_, &outputs);
+  EXPECT_EQ(status.code(), StatusCode::Invalid);
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  EXPECT_EQ(status.code(), StatusCode::Invalid);
+
+  // Indices must be within the record batch
+  selection_vector->SetNumSlots(2);
+  selection_vector->SetIndex(0, 1);
+  selection_vector->SetIndex(1, num_records);
+  status = projector->Evaluate(*in_batch, *selection_vector, pool_, &outputs);
+  EXPECT_EQ(status.code(), StatusCode::Invalid);
+  selection_vector->SetIndex(1, num_records - 1);
+  status = projector->Evaluate(*in_batch, *selection_vector, pool_, &outputs);
+  ASSERT_OK(status);
+  EXPECT_EQ(outputs.at(0)->length(), 2);
+}
+
+TEST_F(TestProjector, TestProjectTable) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {sum_expr}, TestConfiguration(), &projector);
+  ASSERT_OK(status);
+
+  // Create a table of two chunks, with several morsels each
+  std::vector<int32_t> values0, values1, expected;
+  std::vector<bool> validity0, expected_validity;
+  for (int32_t i = 0; i < 500; ++i) {
+    values0.push_back(i);
+    validity0.push_back(i % 3 != 0);
+    values1.push_back(2 * i);
+    expected.push_back(validity0.back() ? 3 * i : 0);
+    expected_validity.push_back(validity0.back());
+  }
+  auto array0 = MakeArrowArrayInt32(values0, validity0);
+  auto array1 = MakeArrowArrayInt32(values1);
+  auto column0 = std::make_shared<arrow::Column>(
+      field0, arrow::ArrayVector{array0->Slice(0, 200), array0->Slice(200)});
+  auto column1 = std::make_shared<arrow::Column>(
+      field1, arrow::ArrayVector{array1->Slice(0, 200), array1->Slice(200)});
+  auto table = arrow::Table::Make(schema, {column0, column1});
+
+  std::shared_ptr<arrow::Table> output;
+  status = projector->Evaluate(*table, pool_, &output, 64 /*morsel_size*/);
+  ASSERT_OK(status);
+
+  ASSERT_EQ(output->num_rows(), 500);
+  ASSERT_TRUE(output->schema()->Equals(*arrow::schema({field_sum})));
+  auto chunks = output->column(0)->data();
+  ASSERT_EQ(chunks->num_chunks(), 9);
+  auto exp_sum = MakeArrowArrayInt32(expected, expected_validity);
+  EXPECT_TRUE(chunks->Equals(arrow::ChunkedArray({exp_sum})));
+}
+
+
+TEST_F(TestProjector, TestProjectTableUnalignedChunks) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {sum_expr}, TestConfiguration(), &projector);
+  ASSERT_OK(status);
+
+  // The columns have different chunks, so the morsels of the second chunk of f0
+  // start in the middle of a byte of the bitmaps of f1.
+  std::vector<int32_t> values0, values1, expected;
+  std::vector<bool> validity0, validity1, expected_validity;
+  for (int32_t i = 0; i < 500; ++i) {
+    values0.push_back(i);
+    validity0.push_back(i % 3 != 0);
+    values1.push_back(2 * i);
+    validity1.push_back(i % 5 != 0);
+    expected_validity.push_back(validity0.back() && validity1.back());
+    expected.push_back(expected_validity.back() ? 3 * i : 0);
+  }
+  auto array0 = MakeArrowArrayInt32(values0, validity0);
+  auto array1 = MakeArrowArrayInt32(values1, validity1);
+  auto column0 = std::make_shared<arrow::Column>(
+      field0, arrow::ArrayVector{array0->Slice(0, 100), array0->Slice(100)});
+  auto column1 = std::make_shared<arrow::Column>(field1, arrow::ArrayVector{array1});
+  auto table = arrow::Table::Make(schema, {column0, column1});
+
+  std::shared_ptr<arrow::Table> output;
+  status = projector->Evaluate(*table, pool_, &output, 64 /*morsel_size*/);
+  ASSERT_OK(status);
+
+  ASSERT_EQ(output->num_rows(), 500);
+  auto exp_sum = MakeArrowArrayInt32(expected, expected_validity);
+  EXPECT_TRUE(output->column(0)->data()->Equals(arrow::ChunkedArray({exp_sum})));
+}
+
+
+TEST_F(TestProjector, TestProjectTableFromCpuPool) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto schema = arrow::schema({field0});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field0}, field_sum);
+
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {sum_expr}, TestConfiguration(), &projector);
+  ASSERT_OK(status);
+
+  std::vector<int32_t> values, expected;
+  for (int32_t i = 0; i < 500; ++i) {
+    values.push_back(i);
+    expected.push_back(2 * i);
+  }
+  auto array0 = MakeArrowArrayInt32(values);
+  auto column0 = std::make_shared<arrow::Column>(field0, arrow::ArrayVector{array0});
+  auto table = arrow::Table::Make(schema, {column0});
+  auto exp_sum = MakeArrowArrayInt32(expected);
+
+  // Occupy every thread of the CPU pool with an evaluation of the table: the morsels
+  // must not wait for threads of the pool.
+  auto cpu_pool = arrow::internal::GetCpuThreadPool();
+  std::vector<std::future<Status>> futures;
+  for (int i = 0; i < cpu_pool->GetCapacity(); ++i) {
+    futures.push_back(cpu_pool->Submit([&]() {
+      std::shared_ptr<arrow::Table> output;
+      ARROW_RETURN_NOT_OK(projector->Evaluate(*table, pool_, &output, 64));
+      if (!output->column(0)->data()->Equals(arrow::ChunkedArray({exp_sum}))) {
+        return Status::Invalid("Unexpected output");
+      }
+      return Status::OK();
+    }));
+  }
+  for (auto& future : futures) {
+    ASSERT_OK(future.get());
+  }
+}
+
 }  // namespace gandiva
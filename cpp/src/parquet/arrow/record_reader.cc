@@ -28,6 +28,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/memory_pool.h"
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
@@ -46,6 +47,12 @@ namespace internal {
 
 namespace BitUtil = ::arrow::BitUtil;
 
+// Decoded values and levels are attributed to this tag in TaggingMemoryPool
+static const ::arrow::MemoryTag& DecodeMemoryTag() {
+  static const ::arrow::MemoryTag tag("parquet.decode");
+  return tag;
+}
+
 // PLAIN_DICTIONARY is deprecated but used to be used as a dictionary index
 // encoding.
 static bool IsDictionaryIndexEncoding(const Encoding::type& e) {
@@ -301,6 +308,7 @@ class RecordReader::RecordReaderImpl {
   void ReserveLevels(int64_t capacity) {
     if (descr_->max_definition_level() > 0 &&
         (levels_written_ + capacity > levels_capacity_)) {
+      ::arrow::ScopedMemoryTag tag(DecodeMemoryTag());
       int64_t new_levels_capacity = BitUtil::NextPower2(levels_capacity_ + 1);
       while (levels_written_ + capacity > new_levels_capacity) {
         new_levels_capacity = BitUtil::NextPower2(new_levels_capacity + 1);
@@ -316,6 +324,7 @@ class RecordReader::RecordReaderImpl {
   }
 
   void ReserveValues(int64_t capacity) {
+    ::arrow::ScopedMemoryTag tag(DecodeMemoryTag());
     if (values_written_ + capacity > values_capacity_) {
       int64_t new_values_capacity = BitUtil::NextPower2(values_capacity_ + 1);
       while (values_written_ + capacity > new_values_capacity) {
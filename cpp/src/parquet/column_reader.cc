@@ -23,6 +23,7 @@
 #include <memory>
 
 #include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/compression.h"
@@ -200,6 +201,10 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       ParquetException::EofException(ss.str());
     }
 
+    // Page buffers are attributed to decompression in TaggingMemoryPool
+    static const ::arrow::MemoryTag kDecompressTag("parquet.decompress");
+    ::arrow::ScopedMemoryTag tag(kDecompressTag);
+
     // Decrypt it if we need to
     if (encryption_ != nullptr) {
       decryption_buffer_->Resize(encryption_->CalculatePlainSize(compressed_len), false);
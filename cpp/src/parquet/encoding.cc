@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/builder.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
@@ -856,8 +857,15 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   ::arrow::util::RleDecoder idx_decoder_;
 };
 
+// Decoded dictionaries are attributed to this tag in TaggingMemoryPool
+static const ::arrow::MemoryTag& DictDecoderMemoryTag() {
+  static const ::arrow::MemoryTag tag("parquet.dictionary");
+  return tag;
+}
+
 template <typename Type>
 inline void DictDecoderImpl<Type>::SetDict(TypedDecoder<Type>* dictionary) {
+  ::arrow::ScopedMemoryTag tag(DictDecoderMemoryTag());
   int num_dictionary_values = dictionary->values_left();
   dictionary_.Resize(num_dictionary_values);
   dictionary->Decode(dictionary_.data(), num_dictionary_values);
@@ -871,6 +879,7 @@ inline void DictDecoderImpl<BooleanType>::SetDict(TypedDecoder<BooleanType>* dic
 template <>
 inline void DictDecoderImpl<ByteArrayType>::SetDict(
     TypedDecoder<ByteArrayType>* dictionary) {
+  ::arrow::ScopedMemoryTag tag(DictDecoderMemoryTag());
   int num_dictionary_values = dictionary->values_left();
   dictionary_.Resize(num_dictionary_values);
   dictionary->Decode(&dictionary_[0], num_dictionary_values);
@@ -894,6 +903,7 @@ inline void DictDecoderImpl<ByteArrayType>::SetDict(
 
 template <>
 inline void DictDecoderImpl<FLBAType>::SetDict(TypedDecoder<FLBAType>* dictionary) {
+  ::arrow::ScopedMemoryTag tag(DictDecoderMemoryTag());
   int num_dictionary_values = dictionary->values_left();
   dictionary_.Resize(num_dictionary_values);
   dictionary->Decode(&dictionary_[0], num_dictionary_values);